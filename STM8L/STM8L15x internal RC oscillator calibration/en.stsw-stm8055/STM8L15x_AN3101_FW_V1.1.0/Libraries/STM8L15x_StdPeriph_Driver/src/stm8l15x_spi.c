@@ -227,7 +227,7 @@ void SPI_CalculateCRCCmd(SPI_TypeDef* SPIx, FunctionalState NewState)
   assert_param(IS_FUNCTIONAL_STATE(NewState));
 
   /* SPI must be disable forcorrect operation od Hardware CRC calculation */
-  SPI_Cmd(SPI1, DISABLE);
+  SPI_Cmd(SPIx, DISABLE);
 
   if (NewState != DISABLE)
   {
@@ -291,9 +291,8 @@ void DisaplyFrequencies(void)
   LCDString1[13] = (uint8_t)((uint8_t)(frequency2) + ASCII_NUM_0);
   LCDString1[14] = (uint8_t)((uint8_t)(frequency1) + ASCII_NUM_0);
 
-  /* Display default HSI frequency value before calibration on LCD*/
-  LCD_SetCursorPos(LCD_LINE1, 0);
-  LCD_Print(LCDString1);
+  /* Update default HSI frequency value before calibration in LCD shadow buffer */
+  LCD_ShadowPrint(LCD_LINE1, 0, LCDString1);
 
   frequency8 = (uint8_t) (HSIFrequencyAfterCalib / 10000000);
   frequency7 = (uint8_t) (HSIFrequencyAfterCalib % 10000000 / 1000000);
@@ -313,9 +312,11 @@ void DisaplyFrequencies(void)
   LCDString2[13] = (uint8_t)((uint8_t)(frequency2) + ASCII_NUM_0);
   LCDString2[14] = (uint8_t)((uint8_t)(frequency1) + ASCII_NUM_0);
 
-  /* Display the HSI frequency value after calibration on LCD */
-  LCD_SetCursorPos(LCD_LINE2, 0);
-  LCD_Print(LCDString2);
+  /* Update the HSI frequency value after calibration in LCD shadow buffer */
+  LCD_ShadowPrint(LCD_LINE2, 0, LCDString2);
+
+  /* Display on LCD only the characters which have changed */
+  LCD_ShadowFlush();
 }
 
 #ifdef  USE_FULL_ASSERT
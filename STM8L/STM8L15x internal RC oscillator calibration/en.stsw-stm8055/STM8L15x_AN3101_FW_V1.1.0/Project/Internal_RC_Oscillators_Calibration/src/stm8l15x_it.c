@@ -21,6 +21,9 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm8l15x_it.h"
+#include "stm8_eval_lcd.h"
+#include "stm8_eval_glass_lcd.h"
+#include "stm8_eval_i2c.h"
 
 /** @addtogroup InternalRCCalibration
   * @{
@@ -258,6 +261,9 @@ INTERRUPT_HANDLER(LCD_AES_IRQHandler, 16)
   /* In order to detect unexpected events during development,
      it is recommended to set a breakpoint on the following instruction.
   */
+#ifdef USE_LCD_GLASS_SOF_COMMIT
+  LCD_GLASS_IRQHandler();
+#endif /* USE_LCD_GLASS_SOF_COMMIT */
 }
 
 /**
@@ -398,6 +404,10 @@ INTERRUPT_HANDLER(TIM4_UPD_OVF_TRG_IRQHandler, 25)
   /* In order to detect unexpected events during development,
      it is recommended to set a breakpoint on the following instruction.
   */
+#ifdef USE_LCD_ASYNC
+  /* LCD processing delay elapsed */
+  LCD_TIM_IRQHandler();
+#endif /* USE_LCD_ASYNC */
 }
 
 /**
@@ -410,6 +420,10 @@ INTERRUPT_HANDLER(SPI1_IRQHandler, 26)
   /* In order to detect unexpected events during development,
      it is recommended to set a breakpoint on the following instruction.
   */
+#if defined (USE_LCD_ASYNC) && defined (USE_STM8L1526_EVAL)
+  /* LCD SPI transmit buffer empty */
+  LCD_SPI_IRQHandler();
+#endif /* USE_LCD_ASYNC && USE_STM8L1526_EVAL */
 }
 
 /**
@@ -446,6 +460,15 @@ INTERRUPT_HANDLER(I2C1_SPI2_IRQHandler, 29)
   /* In order to detect unexpected events during development,
      it is recommended to set a breakpoint on the following instruction.
   */
+#if defined (USE_LCD_ASYNC) && defined (USE_STM8L1528_EVAL)
+  /* LCD SPI transmit buffer empty */
+  LCD_SPI_IRQHandler();
+#endif /* USE_LCD_ASYNC && USE_STM8L1528_EVAL */
+
+#ifdef USE_I2CM
+  /* I2C EEPROM and temperature sensor transfers */
+  I2CM_IRQHandler();
+#endif /* USE_I2CM */
 }
 
 /**
@@ -0,0 +1,555 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_block.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   This file provides a common sector access to the SD card and the
+  *          SPI FLASH of the STM8-EVAL boards, through a RAM cache of the
+  *          last sectors used.
+  *
+  *          @note A device is a storage driver seen as an array of
+  *                BLOCK_SECTOR_SIZE byte sectors: BLOCK_SDDevice (SD card) and
+  *                BLOCK_sFLASHDevice (SPI FLASH, 512-byte sectors of the
+  *                memory array) are provided. The drivers must have been
+  *                initialized by SD_Init() and sFLASH_Init().
+  *
+  *          @note The cache holds BLOCK_CACHE_SIZE sectors, of any device. A
+  *                read of a cached sector does not access the device, and the
+  *                least recently used sector is replaced on a miss. When a
+  *                read misses the sector following the previous one read, the
+  *                next sector is also read, by the same device command, in
+  *                the adjacent entry: a sequential read then costs a device
+  *                command every two sectors.
+  *
+  *          @note The writes go through the cache to the device. A SPI FLASH
+  *                sector is only written as such once erased, by
+  *                sFLASH_EraseSector(): BLOCK_Invalidate() must be called
+  *                after the erase for the cache to drop the old data.
+  *                Programming a sector not erased only clears bits, so the
+  *                SPI FLASH sectors written are dropped from the cache and
+  *                read again from the device.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_block.h"
+#include "stm8_eval_spi_sd.h"
+#include "stm8_eval_spi_flash.h"
+
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_BLOCK
+  * @brief      This file includes the sector cache of the SD card and SPI
+  *             FLASH of STM8-EVAL boards.
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_BLOCK_Private_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Private_Defines
+  * @{
+  */
+#if (BLOCK_CACHE_SIZE < 1) || (BLOCK_CACHE_SIZE > 4)
+ #error "BLOCK_CACHE_SIZE must be 1 to 4 (in stm8_eval_block.h file)"
+#endif
+
+#define BLOCK_NO_ENTRY            BLOCK_CACHE_SIZE
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Private_Macros
+  * @{
+  */
+#ifdef BLOCK_USE_STATISTICS
+#define BLOCK_STATISTICS_ADD(Counter, Value)  (BLOCKStatistics.Counter += (Value))
+#else
+#define BLOCK_STATISTICS_ADD(Counter, Value)
+#endif /* BLOCK_USE_STATISTICS */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Private_Variables
+  * @{
+  */
+static uint8_t BLOCKCache[BLOCK_CACHE_SIZE][BLOCK_SECTOR_SIZE];
+static const BLOCK_Device_TypeDef* BLOCKCacheDevice[BLOCK_CACHE_SIZE]; /* 0: entry free */
+static uint32_t BLOCKCacheSector[BLOCK_CACHE_SIZE];
+static uint8_t BLOCKCacheAge[BLOCK_CACHE_SIZE];  /* 0: most recently used entry */
+
+/* Last sector read, to detect the sequential reads */
+static const BLOCK_Device_TypeDef* BLOCKLastDevice = 0;
+static uint32_t BLOCKLastSector = 0;
+
+#ifdef BLOCK_USE_STATISTICS
+static BLOCK_Statistics_TypeDef BLOCKStatistics;
+#endif /* BLOCK_USE_STATISTICS */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Private_Function_Prototypes
+  * @{
+  */
+static uint8_t BLOCK_Find(const BLOCK_Device_TypeDef* Device, uint32_t Sector);
+static void BLOCK_Touch(uint8_t Entry);
+static uint8_t BLOCK_GetVictim(void);
+#if (BLOCK_CACHE_SIZE > 1)
+static uint8_t BLOCK_GetVictimPair(void);
+#endif /* BLOCK_CACHE_SIZE > 1 */
+static ErrorStatus BLOCK_SDReadSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb);
+static ErrorStatus BLOCK_SDWriteSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb);
+static ErrorStatus BLOCK_sFLASHReadSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb);
+static ErrorStatus BLOCK_sFLASHWriteSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb);
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Devices
+  * @{
+  */
+const BLOCK_Device_TypeDef BLOCK_SDDevice =
+{
+  BLOCK_SDReadSectors,
+  BLOCK_SDWriteSectors,
+  ENABLE
+};
+
+const BLOCK_Device_TypeDef BLOCK_sFLASHDevice =
+{
+  BLOCK_sFLASHReadSectors,
+  BLOCK_sFLASHWriteSectors,
+  DISABLE
+};
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Empties the cache. Must be called before any other function of
+  *         the module.
+  * @param  None
+  * @retval None
+  */
+void BLOCK_Init(void)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < BLOCK_CACHE_SIZE; i++)
+  {
+    BLOCKCacheDevice[i] = 0;
+    BLOCKCacheAge[i] = i;
+  }
+  BLOCKLastDevice = 0;
+
+#ifdef BLOCK_USE_STATISTICS
+  BLOCK_ClearStatistics();
+#endif /* BLOCK_USE_STATISTICS */
+}
+
+/**
+  * @brief  Returns a sector from the cache, reading it from the device on a
+  *         miss.
+  * @param  Device: the device holding the sector.
+  * @param  Sector: sector number.
+  * @retval Pointer to the BLOCK_SECTOR_SIZE bytes of the sector in the cache,
+  *         valid until the next call of a function of the module, or 0 on a
+  *         read error.
+  */
+uint8_t* BLOCK_Get(const BLOCK_Device_TypeDef* Device, uint32_t Sector)
+{
+  uint8_t entry = 0;
+  FlagStatus sequential = RESET;
+
+  if ((Device == BLOCKLastDevice) && (Sector == (BLOCKLastSector + 1)))
+  {
+    sequential = SET;
+  }
+  BLOCKLastDevice = Device;
+  BLOCKLastSector = Sector;
+
+  entry = BLOCK_Find(Device, Sector);
+  if (entry != BLOCK_NO_ENTRY)
+  {
+    BLOCK_STATISTICS_ADD(HitNb, 1);
+    BLOCK_Touch(entry);
+    return BLOCKCache[entry];
+  }
+
+  BLOCK_STATISTICS_ADD(MissNb, 1);
+
+#if (BLOCK_CACHE_SIZE > 1)
+  if ((sequential != RESET) && (BLOCK_Find(Device, Sector + 1) == BLOCK_NO_ENTRY))
+  {
+    /*!< Sequential read: the next sector is read by the same command, into
+         the adjacent entry */
+    entry = BLOCK_GetVictimPair();
+    BLOCKCacheDevice[entry] = 0;
+    BLOCKCacheDevice[entry + 1] = 0;
+    /*!< When the pair cannot be read, Sector + 1 may be past the end of the
+         device: Sector is then read alone */
+    if (Device->ReadSectors(BLOCKCache[entry], Sector, 2) == SUCCESS)
+    {
+      BLOCKCacheDevice[entry + 1] = Device;
+      BLOCKCacheSector[entry + 1] = Sector + 1;
+      BLOCK_Touch(entry + 1);
+      BLOCK_STATISTICS_ADD(PrefetchNb, 1);
+    }
+    else if (Device->ReadSectors(BLOCKCache[entry], Sector, 1) != SUCCESS)
+    {
+      return 0;
+    }
+  }
+  else
+#endif /* BLOCK_CACHE_SIZE > 1 */
+  {
+    entry = BLOCK_GetVictim();
+    BLOCKCacheDevice[entry] = 0;
+    if (Device->ReadSectors(BLOCKCache[entry], Sector, 1) != SUCCESS)
+    {
+      return 0;
+    }
+  }
+
+  BLOCKCacheDevice[entry] = Device;
+  BLOCKCacheSector[entry] = Sector;
+  BLOCK_Touch(entry);
+
+  return BLOCKCache[entry];
+}
+
+/**
+  * @brief  Reads a sector, from the cache if possible.
+  * @param  Device: the device holding the sector.
+  * @param  Sector: sector number.
+  * @param  pBuffer: pointer to the BLOCK_SECTOR_SIZE bytes receiving the
+  *         sector.
+  * @retval SUCCESS or ERROR on a read error
+  */
+ErrorStatus BLOCK_Read(const BLOCK_Device_TypeDef* Device, uint32_t Sector, uint8_t* pBuffer)
+{
+  uint8_t* pData = BLOCK_Get(Device, Sector);
+  uint16_t i = 0;
+
+  if (pData == 0)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < BLOCK_SECTOR_SIZE; i++)
+  {
+    pBuffer[i] = pData[i];
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Writes a sector to the device, updating its cached copy.
+  * @note   pBuffer may be the pointer returned by BLOCK_Get() for the same
+  *         sector, modified in place. The cached copy of a device without
+  *         WriteThrough is dropped instead: the device content may differ
+  *         from pBuffer.
+  * @param  Device: the device holding the sector.
+  * @param  Sector: sector number.
+  * @param  pBuffer: pointer to the BLOCK_SECTOR_SIZE bytes to write.
+  * @retval SUCCESS or ERROR on a write error
+  */
+ErrorStatus BLOCK_Write(const BLOCK_Device_TypeDef* Device, uint32_t Sector, uint8_t* pBuffer)
+{
+  uint8_t entry = BLOCK_Find(Device, Sector);
+  uint16_t i = 0;
+
+  BLOCK_STATISTICS_ADD(WriteNb, 1);
+
+  if (Device->WriteSectors(pBuffer, Sector, 1) != SUCCESS)
+  {
+    if (entry != BLOCK_NO_ENTRY)
+    {
+      /*!< Content of the sector unknown */
+      BLOCKCacheDevice[entry] = 0;
+    }
+    return ERROR;
+  }
+
+  if ((entry != BLOCK_NO_ENTRY) && (Device->WriteThrough == DISABLE))
+  {
+    /*!< The sector is read again from the device on the next access */
+    BLOCKCacheDevice[entry] = 0;
+  }
+  else if ((entry != BLOCK_NO_ENTRY) && (pBuffer != BLOCKCache[entry]))
+  {
+    for (i = 0; i < BLOCK_SECTOR_SIZE; i++)
+    {
+      BLOCKCache[entry][i] = pBuffer[i];
+    }
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Drops the cached sectors of a device, to be called when the device
+  *         is modified without BLOCK_Write().
+  * @param  Device: the device.
+  * @retval None
+  */
+void BLOCK_Invalidate(const BLOCK_Device_TypeDef* Device)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < BLOCK_CACHE_SIZE; i++)
+  {
+    if (BLOCKCacheDevice[i] == Device)
+    {
+      BLOCKCacheDevice[i] = 0;
+    }
+  }
+
+  if (BLOCKLastDevice == Device)
+  {
+    BLOCKLastDevice = 0;
+  }
+}
+
+#ifdef BLOCK_USE_STATISTICS
+/**
+  * @brief  Returns the counters of the sector reads since the last
+  *         BLOCK_ClearStatistics().
+  * @param  Statistics: pointer to the structure that receives the counters.
+  * @retval None
+  */
+void BLOCK_GetStatistics(BLOCK_Statistics_TypeDef* Statistics)
+{
+  *Statistics = BLOCKStatistics;
+}
+
+/**
+  * @brief  Clears the counters of the sector reads.
+  * @param  None
+  * @retval None
+  */
+void BLOCK_ClearStatistics(void)
+{
+  BLOCKStatistics.HitNb = 0;
+  BLOCKStatistics.MissNb = 0;
+  BLOCKStatistics.PrefetchNb = 0;
+  BLOCKStatistics.WriteNb = 0;
+}
+#endif /* BLOCK_USE_STATISTICS */
+
+/**
+  * @brief  Looks for a sector in the cache.
+  * @param  Device: the device holding the sector.
+  * @param  Sector: sector number.
+  * @retval The cache entry, or BLOCK_NO_ENTRY if the sector is not cached.
+  */
+static uint8_t BLOCK_Find(const BLOCK_Device_TypeDef* Device, uint32_t Sector)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < BLOCK_CACHE_SIZE; i++)
+  {
+    if ((BLOCKCacheDevice[i] == Device) && (BLOCKCacheSector[i] == Sector))
+    {
+      return i;
+    }
+  }
+
+  return BLOCK_NO_ENTRY;
+}
+
+/**
+  * @brief  Marks a cache entry as the most recently used.
+  * @param  Entry: the cache entry.
+  * @retval None
+  */
+static void BLOCK_Touch(uint8_t Entry)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < BLOCK_CACHE_SIZE; i++)
+  {
+    if (BLOCKCacheAge[i] < BLOCKCacheAge[Entry])
+    {
+      BLOCKCacheAge[i]++;
+    }
+  }
+  BLOCKCacheAge[Entry] = 0;
+}
+
+/**
+  * @brief  Returns the cache entry to replace: a free entry, or else the least
+  *         recently used one.
+  * @param  None
+  * @retval The cache entry.
+  */
+static uint8_t BLOCK_GetVictim(void)
+{
+  uint8_t i = 0, entry = 0;
+
+  for (i = 0; i < BLOCK_CACHE_SIZE; i++)
+  {
+    if (BLOCKCacheDevice[i] == 0)
+    {
+      return i;
+    }
+    if (BLOCKCacheAge[i] == (BLOCK_CACHE_SIZE - 1))
+    {
+      entry = i;
+    }
+  }
+
+  return entry;
+}
+
+#if (BLOCK_CACHE_SIZE > 1)
+/**
+  * @brief  Returns the first of the two adjacent cache entries to replace:
+  *         the pair whose most recently used entry is the oldest.
+  * @param  None
+  * @retval The first cache entry of the pair.
+  */
+static uint8_t BLOCK_GetVictimPair(void)
+{
+  uint8_t i = 0, entry = 0, age = 0, oldest = 0;
+
+  for (i = 0; i < (BLOCK_CACHE_SIZE - 1); i++)
+  {
+    /*!< A free entry counts as the oldest */
+    age = (BLOCKCacheDevice[i] == 0) ? BLOCK_CACHE_SIZE : BLOCKCacheAge[i];
+    if ((BLOCKCacheDevice[i + 1] != 0) && (BLOCKCacheAge[i + 1] < age))
+    {
+      age = BLOCKCacheAge[i + 1];
+    }
+    if (age >= oldest)
+    {
+      oldest = age;
+      entry = i;
+    }
+  }
+
+  return entry;
+}
+#endif /* BLOCK_CACHE_SIZE > 1 */
+
+/**
+  * @brief  Reads consecutive sectors of the SD card.
+  * @param  pBuffer: pointer to the buffer that receives the sectors.
+  * @param  Sector: first sector number.
+  * @param  SectorNb: number of sectors to read.
+  * @retval SUCCESS or ERROR
+  */
+static ErrorStatus BLOCK_SDReadSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb)
+{
+  if (SD_ReadSectors(pBuffer, Sector, SectorNb) != SD_RESPONSE_NO_ERROR)
+  {
+    return ERROR;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Writes consecutive sectors of the SD card.
+  * @param  pBuffer: pointer to the sectors to write.
+  * @param  Sector: first sector number.
+  * @param  SectorNb: number of sectors to write.
+  * @retval SUCCESS or ERROR
+  */
+static ErrorStatus BLOCK_SDWriteSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb)
+{
+  if (SD_WriteSectors(pBuffer, Sector, SectorNb) != SD_RESPONSE_NO_ERROR)
+  {
+    return ERROR;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reads consecutive sectors of the SPI FLASH.
+  * @param  pBuffer: pointer to the buffer that receives the sectors.
+  * @param  Sector: first sector number.
+  * @param  SectorNb: number of sectors to read.
+  * @retval SUCCESS
+  */
+static ErrorStatus BLOCK_sFLASHReadSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb)
+{
+  sFLASH_ReadBuffer(pBuffer, Sector * BLOCK_SECTOR_SIZE, (uint16_t)SectorNb * BLOCK_SECTOR_SIZE);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Programs consecutive sectors of the SPI FLASH, previously erased:
+  *         the bits already cleared in the FLASH stay cleared.
+  * @param  pBuffer: pointer to the sectors to write.
+  * @param  Sector: first sector number.
+  * @param  SectorNb: number of sectors to write.
+  * @retval SUCCESS
+  */
+static ErrorStatus BLOCK_sFLASHWriteSectors(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb)
+{
+  sFLASH_WriteBuffer(pBuffer, Sector * BLOCK_SECTOR_SIZE, (uint16_t)SectorNb * BLOCK_SECTOR_SIZE);
+
+  return SUCCESS;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
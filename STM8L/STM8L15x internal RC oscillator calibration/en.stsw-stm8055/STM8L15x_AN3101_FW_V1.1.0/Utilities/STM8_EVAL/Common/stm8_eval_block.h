@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_block.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header for stm8_eval_block.c module
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8_EVAL_BLOCK_H
+#define __STM8_EVAL_BLOCK_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval.h"
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_BLOCK
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_BLOCK_Exported_Types
+  * @{
+  */
+/**
+  * @brief  Storage driver seen as an array of BLOCK_SECTOR_SIZE byte sectors
+  */
+typedef struct
+{
+  ErrorStatus (*ReadSectors)(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb);
+  ErrorStatus (*WriteSectors)(uint8_t* pBuffer, uint32_t Sector, uint8_t SectorNb);
+  FunctionalState WriteThrough; /*!< ENABLE when a write replaces the sector
+                                     content, kept in the cache. DISABLE when
+                                     it is combined with the previous content
+                                     (FLASH programmed without erase): the
+                                     sector is then dropped from the cache */
+}BLOCK_Device_TypeDef;
+
+/**
+  * @brief  Sector reads counted since the last BLOCK_ClearStatistics()
+  */
+typedef struct
+{
+  uint32_t HitNb;         /*!< Sectors read from the cache */
+  uint32_t MissNb;        /*!< Sectors read from the device */
+  uint32_t PrefetchNb;    /*!< Sectors read ahead of a sequential read */
+  uint32_t WriteNb;       /*!< Sectors written to the device */
+}BLOCK_Statistics_TypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_BLOCK_Exported_Constants
+  * @{
+  */
+#define BLOCK_SECTOR_SIZE         0x200
+
+/* Number of sectors of the cache, 1 to 4. From 2 sectors, a sequential read
+   also reads the next sector in the same device command */
+#define BLOCK_CACHE_SIZE          2
+
+/* Uncomment the line below to count the cache hits and misses, to tune
+   BLOCK_CACHE_SIZE: see BLOCK_GetStatistics() */
+/* #define BLOCK_USE_STATISTICS */
+
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_BLOCK_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_BLOCK_Exported_Functions
+  * @{
+  */
+extern const BLOCK_Device_TypeDef BLOCK_SDDevice;
+extern const BLOCK_Device_TypeDef BLOCK_sFLASHDevice;
+
+void BLOCK_Init(void);
+uint8_t* BLOCK_Get(const BLOCK_Device_TypeDef* Device, uint32_t Sector);
+ErrorStatus BLOCK_Read(const BLOCK_Device_TypeDef* Device, uint32_t Sector, uint8_t* pBuffer);
+ErrorStatus BLOCK_Write(const BLOCK_Device_TypeDef* Device, uint32_t Sector, uint8_t* pBuffer);
+void BLOCK_Invalidate(const BLOCK_Device_TypeDef* Device);
+#ifdef BLOCK_USE_STATISTICS
+void BLOCK_GetStatistics(BLOCK_Statistics_TypeDef* Statistics);
+void BLOCK_ClearStatistics(void);
+#endif /* BLOCK_USE_STATISTICS */
+
+#endif /* __STM8_EVAL_BLOCK_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
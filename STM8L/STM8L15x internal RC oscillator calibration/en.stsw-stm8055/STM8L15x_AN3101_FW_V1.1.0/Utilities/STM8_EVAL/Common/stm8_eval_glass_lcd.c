@@ -0,0 +1,809 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_glass_lcd.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   This file provides the glass LCD engine shared by the glass LCD
+  *          drivers of the STM8L1526-EVAL and STM8L1528-EVAL boards.
+  *          The board driver configures the LCD peripheral and describes its
+  *          glass (GLASS_Board_TypeDef): glyph map and LCD RAM location of the
+  *          segments of each character. This engine renders the characters
+  *          from this description into an LCD RAM shadow, copied into the
+  *          LCD RAM once an update is done.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_glass_lcd.h"
+
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_GLASS_LCD
+  * @brief      This file includes the glass LCD engine of STM8-EVAL boards.
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Private_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Private_Defines
+  * @{
+  */
+#define GLASS_REGISTER ((uint8_t)0x7F)
+
+#ifdef USE_LCD_GLASS_ADAPTIVE_DRIVE
+/* Factory conversions at VDD = 3 V, LSB of the 12-bit ADC1 result. 0 when the
+   device has not been calibrated, the typical values are then used */
+#define VREFINT_FACTORY_CONV  (*(__IO uint8_t*)0x4910)
+#define TS_FACTORY_CONV_V90   (*(__IO uint8_t*)0x4911)
+#define VREFINT_FACTORY_MSB   ((uint16_t)0x0600)
+#define TS_FACTORY_MSB        ((uint16_t)0x0300)
+
+#define VREFINT_TYPICAL_MV    ((uint16_t)1224) /* Internal reference voltage */
+#define TS_TYPICAL_V90_UV     ((uint32_t)597000) /* Sensor voltage at 90 C */
+#define TS_AVG_SLOPE_UV       ((int32_t)1620)  /* Sensor slope, per degree */
+#define FACTORY_VDD_MV        ((uint32_t)3000)
+#endif /* USE_LCD_GLASS_ADAPTIVE_DRIVE */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Private_Macros
+  * @{
+  */
+/* Register of the LCD RAM shadow, marked as modified. The bank is selected by
+   the GLASS_PAGE2 bit of Register */
+#define SHADOW_RAM(Register) \
+  ShadowRAM[(Register) >> 7][(ShadowDirty[(Register) >> 7][((Register) & GLASS_REGISTER) >> 3] |= \
+                              (uint8_t)(1 << ((Register) & 0x07)), (Register) & GLASS_REGISTER)]
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Private_Variables
+  * @{
+  */
+static __CONST GLASS_Board_TypeDef* Board = 0;
+
+/* LCD RAM shadow: the glass LCD functions update it and LCD_GLASS_Commit()
+   copies the modified registers into the LCD RAM */
+static uint8_t ShadowRAM[2][GLASS_RAM_NB];
+static uint8_t ShadowDirty[2][3];      /* One bit per modified register */
+static __IO uint8_t ShadowLock = 0;    /* Updates in progress */
+
+/* Non blocking scroll: text, blank padded, and characters displayed */
+static uint8_t ScrollText[LCD_GLASS_SCROLL_MAX_LENGTH];
+static uint8_t ScrollDisplayed[GLASS_CHAR_MAX_NB];
+static __IO uint8_t ScrollLength = 0; /* 0 when the scroll is stopped */
+static uint8_t ScrollOffset = 0;      /* Text character at position 0 */
+static uint8_t ScrollSpeed = 1;       /* Ticks per scroll step */
+static uint8_t ScrollTick = 0;        /* Ticks before the next step */
+static uint16_t ScrollCount = 0;      /* Remaining scrolls, 0: until stopped */
+static void (*ScrollCallback)(void) = 0;
+
+/* Drive settings applied, 0xFF before the first one */
+static uint8_t DriveIndex = 0xFF;
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Private_Function_Prototypes
+  * @{
+  */
+static void ShadowFill(uint8_t Value);
+static void ScrollDisplay(void);
+static void DriveApply(uint8_t Index);
+#ifdef USE_LCD_GLASS_ADAPTIVE_DRIVE
+static uint16_t DriveConvert(ADC_Channel_TypeDef Channel);
+#endif /* USE_LCD_GLASS_ADAPTIVE_DRIVE */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Selects the glass LCD description, configures the LCD drive and
+  *         blanks the LCD RAM, to be called by the board LCD_GLASS_Init()
+  *         before enabling the LCD.
+  * @note   The drive is selected from the measured VDD and temperature when
+  *         USE_LCD_GLASS_ADAPTIVE_DRIVE is defined, otherwise the drive valid
+  *         in the whole operating range is used.
+  * @param  GlassBoard: Pointer to the glass LCD description of the board.
+  * @retval None
+  */
+void GLASS_Init(__CONST GLASS_Board_TypeDef* GlassBoard)
+{
+  Board = GlassBoard;
+
+  DriveIndex = 0xFF;
+#ifdef USE_LCD_GLASS_ADAPTIVE_DRIVE
+  LCD_GLASS_DriveAdjust();
+#else
+  DriveApply((uint8_t)(Board->DriveNb - 1));
+#endif /* USE_LCD_GLASS_ADAPTIVE_DRIVE */
+
+  /* Start from a blank LCD RAM and its shadow */
+  ShadowFill(LCD_RAM_RESET_VALUE);
+  LCD_GLASS_Commit();
+}
+
+/**
+  * @brief  Starts an update of the LCD RAM shadow: it is not copied into the
+  *         LCD RAM until the matching GLASS_End(), updates can be nested.
+  * @param  None
+  * @retval None
+  */
+void GLASS_Begin(void)
+{
+  ShadowLock++;
+}
+
+/**
+  * @brief  Ends an update of the LCD RAM shadow and, once the outer update is
+  *         done, requests its copy into the LCD RAM.
+  * @param  None
+  * @retval None
+  */
+void GLASS_End(void)
+{
+  if (--ShadowLock == 0)
+  {
+#ifdef USE_LCD_GLASS_SOF_COMMIT
+    /* Copy at the next start of frame */
+    LCD_ITConfig(ENABLE);
+#else
+    LCD_GLASS_Commit();
+#endif /* USE_LCD_GLASS_SOF_COMMIT */
+  }
+}
+
+/**
+  * @brief  Gives access to a register of the LCD RAM shadow, which is marked
+  *         as modified. To be used between GLASS_Begin() and GLASS_End().
+  * @param  Register: LCD RAM register, GLASS_PAGE2 set for the second bank.
+  * @retval Pointer to the register of the LCD RAM shadow
+  */
+uint8_t* GLASS_Register(uint8_t Register)
+{
+  return &SHADOW_RAM(Register);
+}
+
+/**
+  * @brief  Writes a character on the glass LCD: every segment of the position
+  *         is set or cleared as defined by the glyph of the character.
+  * @param  Char: Character to display, non printable ones are displayed as
+  *         a space.
+  * @param  Flags: GLASS_POINT and/or GLASS_EXTRA to add the point or the
+  *         second character flag segment, 0 for none.
+  * @param  Position: Position of the character, ignored if out of the glass.
+  * @retval None
+  */
+void GLASS_WriteChar(uint8_t Char, uint8_t Flags, uint8_t Position)
+{
+  __CONST GLASS_Segment_TypeDef* segment;
+  __CONST uint8_t* glyph;
+  uint8_t bits[GLASS_GLYPH_MAX_SIZE];
+  uint8_t index = 0, counter = 0, mask = 0, reg = 0, bit = 0;
+
+  if (Position >= Board->CharNb)
+  {
+    return;
+  }
+
+  /* The character is a printable ascii character, other ones are displayed
+     as a space */
+  if ((Char > (uint8_t)0x20) && (Char < (uint8_t)0x7F))
+  {
+    index = (uint8_t)(Char - (uint8_t)0x20);
+  }
+
+  glyph = &Board->GlyphMap[(uint16_t)index * Board->GlyphSize];
+  for (counter = 0; counter < Board->GlyphSize; counter++)
+  {
+    bits[counter] = glyph[counter];
+  }
+
+  if ((Flags & GLASS_POINT) != 0)
+  {
+    bits[Board->PointSegment >> 3] |= (uint8_t)(1 << (Board->PointSegment & 0x07));
+  }
+  if ((Flags & GLASS_EXTRA) != 0)
+  {
+    bits[Board->ExtraSegment >> 3] |= (uint8_t)(1 << (Board->ExtraSegment & 0x07));
+  }
+
+  GLASS_Begin();
+
+  /* Walk the segments of the position along the glyph bits */
+  segment = &Board->CharMap[(uint16_t)Position * (uint8_t)(Board->GlyphSize << 3)];
+  index = 0;
+  bit = 0x01;
+  for (counter = (uint8_t)(Board->GlyphSize << 3); counter != 0; counter--)
+  {
+    mask = segment->Mask;
+    if (mask != 0)
+    {
+      reg = segment->Register;
+      if ((bits[index] & bit) != 0)
+      {
+        SHADOW_RAM(reg) |= mask;
+      }
+      else
+      {
+        SHADOW_RAM(reg) &= (uint8_t)(~mask);
+      }
+    }
+    segment++;
+
+    bit <<= 1;
+    if (bit == 0)
+    {
+      bit = 0x01;
+      index++;
+    }
+  }
+
+  GLASS_End();
+}
+
+/**
+  * @brief  This function Clear a character on the LCD Glass.
+  * @param  Position: position in the LCD of the character to Clear, ignored
+  *         if out of the glass.
+  * @retval None
+  */
+void LCD_GLASS_ClearChar(uint8_t Position)
+{
+  __CONST GLASS_Segment_TypeDef* segment;
+  uint8_t counter = 0, reg = 0;
+
+  if (Position >= Board->CharNb)
+  {
+    return;
+  }
+
+  GLASS_Begin();
+
+  segment = &Board->CharMap[(uint16_t)Position * (uint8_t)(Board->GlyphSize << 3)];
+  for (counter = (uint8_t)(Board->GlyphSize << 3); counter != 0; counter--)
+  {
+    if (segment->Mask != 0)
+    {
+      reg = segment->Register;
+      SHADOW_RAM(reg) &= (uint8_t)(~segment->Mask);
+    }
+    segment++;
+  }
+
+  GLASS_End();
+}
+
+/**
+  * @brief  This function Clears the LCD display memory.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_Clear(void)
+{
+  GLASS_Begin();
+
+  ShadowFill(LCD_RAM_RESET_VALUE);
+
+  GLASS_End();
+}
+
+/**
+  * @brief  Writes a String on the LCD Glass.
+  * @param  ptr: Pointer to the string to display on the LCD Glass.
+  * @retval None
+  */
+void LCD_GLASS_DisplayString(uint8_t* ptr)
+{
+  uint8_t i = 0x00;
+
+  GLASS_Begin();
+
+  /* Send the string character by character on lCD */
+  while ((*ptr != 0) && (i < Board->CharNb))
+  {
+    /* Display one character on LCD */
+    GLASS_WriteChar(*ptr, 0, i);
+
+    /* Point to the next character */
+    ptr++;
+
+    /* Increment the character counter */
+    i++;
+  }
+
+  GLASS_End();
+}
+
+/**
+  * @brief  Start scrolling a string without blocking the CPU: the string is
+  *         shifted by one character to the left every Speed calls of
+  *         LCD_GLASS_ScrollTick() and restarts from its first character once
+  *         it has entirely scrolled out of the LCD Glass.
+  * @note   LCD_GLASS_ScrollTick() can be called from a timer interrupt routine
+  *         or from the LCD start of frame interrupt routine (LCD_ITConfig()).
+  *         Only the characters changed by a scroll step are rewritten. A step
+  *         due while the application updates the LCD Glass is postponed to
+  *         the next call.
+  * @param  ptr: Pointer to the string to display, it is copied (at most
+  *         LCD_GLASS_SCROLL_MAX_LENGTH - 1 characters).
+  * @param  Speed: Number of LCD_GLASS_ScrollTick() calls per scroll step (>= 1)
+  *         LCD_GLASS_SCROLL_SPEED_FAST, LCD_GLASS_SCROLL_SPEED_MEDIUM,
+  *         LCD_GLASS_SCROLL_SPEED_SLOW or any other value.
+  * @param  nScroll: Specifies how many times the string will be scrolled, 0 to
+  *         scroll it until LCD_GLASS_ScrollStop() is called.
+  * @retval None
+  */
+void LCD_GLASS_ScrollStart(uint8_t* ptr, uint8_t Speed, uint16_t nScroll)
+{
+  uint8_t length = 0;
+
+  /* Stop the current scroll while the text buffer is updated */
+  ScrollLength = 0;
+
+  while ((*ptr != 0) && (length < (uint8_t)(LCD_GLASS_SCROLL_MAX_LENGTH - 1)))
+  {
+    ScrollText[length++] = *ptr++;
+  }
+
+  /* Blank padding: at least one separator and the whole LCD Glass */
+  do
+  {
+    ScrollText[length++] = ' ';
+  }
+  while (length < Board->CharNb);
+
+  /* Force the display of all the characters */
+  for (ScrollOffset = 0; ScrollOffset < Board->CharNb; ScrollOffset++)
+  {
+    ScrollDisplayed[ScrollOffset] = 0;
+  }
+
+  ScrollOffset = 0;
+  ScrollSpeed = (Speed != 0) ? Speed : (uint8_t)1;
+  ScrollTick = ScrollSpeed;
+  ScrollCount = nScroll;
+  ScrollLength = length;
+
+  ScrollDisplay();
+}
+
+/**
+  * @brief  Stop the scroll, the string is left as currently displayed.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_ScrollStop(void)
+{
+  ScrollLength = 0;
+}
+
+/**
+  * @brief  Check whether a string is scrolling.
+  * @param  None
+  * @retval SET while the string is scrolling, RESET otherwise
+  */
+FlagStatus LCD_GLASS_ScrollGetStatus(void)
+{
+  return ((ScrollLength != 0) ? SET : RESET);
+}
+
+/**
+  * @brief  Set the function called by LCD_GLASS_ScrollTick() when the string
+  *         has been scrolled nScroll times.
+  * @param  Callback: function to call, 0 for none
+  * @retval None
+  */
+void LCD_GLASS_ScrollSetCallback(void (*Callback)(void))
+{
+  ScrollCallback = Callback;
+}
+
+/**
+  * @brief  Scroll time base, to be called periodically.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_ScrollTick(void)
+{
+  if ((ScrollLength != 0) && (--ScrollTick == 0))
+  {
+    if (ShadowLock != 0)
+    {
+      /* Interrupted LCD RAM shadow update: do the step on the next call */
+      ScrollTick = 1;
+      return;
+    }
+
+    ScrollTick = ScrollSpeed;
+
+    if (++ScrollOffset == ScrollLength)
+    {
+      /* String scrolled once: back to its first character */
+      ScrollOffset = 0;
+
+      if ((ScrollCount != 0) && (--ScrollCount == 0))
+      {
+        ScrollDisplay();
+        ScrollLength = 0;
+
+        if (ScrollCallback != 0)
+        {
+          ScrollCallback();
+        }
+        return;
+      }
+    }
+    ScrollDisplay();
+  }
+}
+
+/**
+  * @brief  Copies the modified registers of the LCD RAM shadow into the LCD
+  *         RAM, each LCD RAM bank being selected once.
+  * @note   The glass LCD functions call it once their update is done, unless
+  *         USE_LCD_GLASS_SOF_COMMIT is defined: the copy is then done by
+  *         LCD_GLASS_IRQHandler() at the next LCD start of frame.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_Commit(void)
+{
+  uint8_t page = 0, counter = 0, mask = 0;
+
+  for (page = 0; page < Board->PageNb; page++)
+  {
+    if ((ShadowDirty[page][0] | ShadowDirty[page][1] | ShadowDirty[page][2]) != 0)
+    {
+      /* The LCD RAM bank is only selected by the glasses using both */
+      if (Board->PageNb > 1)
+      {
+        if (page == 0)
+        {
+          /* Enable the write access on the LCD RAM first bank */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+        }
+        else
+        {
+          /* Enable the write access on the LCD RAM second bank */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+        }
+      }
+
+      mask = 0x01;
+      for (counter = 0; counter < Board->RegisterNb; counter++)
+      {
+        if ((ShadowDirty[page][counter >> 3] & mask) != 0)
+        {
+          LCD->RAM[counter] = ShadowRAM[page][counter];
+        }
+        mask = (uint8_t)((mask << 1) | (mask >> 7));
+      }
+
+      ShadowDirty[page][0] = 0;
+      ShadowDirty[page][1] = 0;
+      ShadowDirty[page][2] = 0;
+    }
+  }
+}
+
+/**
+  * @brief  LCD start of frame interrupt routine, to be called from the LCD
+  *         interrupt handler when USE_LCD_GLASS_SOF_COMMIT is defined.
+  * @note   The LCD RAM shadow is copied into the LCD RAM at the start of a
+  *         frame, so an update is never displayed half done. The interrupt
+  *         is enabled by the glass LCD functions and disabled once the shadow
+  *         has been copied.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_IRQHandler(void)
+{
+  if (LCD_GetITStatus() != RESET)
+  {
+    LCD_ClearITPendingBit();
+
+    /* Wait for the next frame if an update is in progress */
+    if (ShadowLock == 0)
+    {
+      LCD_GLASS_Commit();
+      LCD_ITConfig(DISABLE);
+    }
+  }
+}
+
+/**
+  * @brief  Configures the lowest glass LCD drive keeping the segments readable
+  *         at the given VDD and temperature, as defined by the drive table of
+  *         the board. The LCD registers are only written when the drive
+  *         changes.
+  * @param  VddmV: VDD, in mV.
+  * @param  Temperature: Temperature, in degrees Celsius.
+  * @retval None
+  */
+void LCD_GLASS_DriveConfig(uint16_t VddmV, int8_t Temperature)
+{
+  __CONST GLASS_Drive_TypeDef* drive = Board->DriveMap;
+  uint8_t index = 0;
+
+  /* The last drive is valid in the whole operating range */
+  while ((index < (uint8_t)(Board->DriveNb - 1)) &&
+         ((VddmV < drive->VddMin) ||
+          (Temperature < drive->TemperatureMin) ||
+          (Temperature > drive->TemperatureMax)))
+  {
+    drive++;
+    index++;
+  }
+
+  DriveApply(index);
+}
+
+#ifdef USE_LCD_GLASS_ADAPTIVE_DRIVE
+/**
+  * @brief  Measures VDD with the internal reference voltage and the
+  *         temperature with the internal sensor, using the factory
+  *         conversions when the device has been calibrated.
+  * @note   ADC1 is configured for the measure, then its configuration and
+  *         clock are restored so that it can be shared with the application.
+  * @param  VddmV: Pointer to the measured VDD, in mV.
+  * @param  Temperature: Pointer to the measured temperature, in degrees
+  *         Celsius.
+  * @retval None
+  */
+void LCD_GLASS_DriveMeasure(uint16_t* VddmV, int8_t* Temperature)
+{
+  uint32_t vdd = 0, v90 = 0, vsensor = 0;
+  int32_t temperature = 0;
+  uint16_t conversion = 0;
+  uint8_t clock = 0, cr1 = 0, cr2 = 0, cr3 = 0, trigr1 = 0;
+
+  /* Save the ADC1 state of the application */
+  clock = (uint8_t)(CLK->PCKENR2 & CLK_PCKENR2_ADC1);
+  CLK_PeripheralClockConfig(CLK_Peripheral_ADC1, ENABLE);
+  cr1 = (uint8_t)(ADC1->CR1 & (uint8_t)~ADC_CR1_START);
+  cr2 = ADC1->CR2;
+  cr3 = ADC1->CR3;
+  trigr1 = ADC1->TRIGR[0];
+
+  ADC_Init(ADC1, ADC_ConversionMode_Single, ADC_Resolution_12Bit,
+           ADC_Prescaler_2);
+  /* The internal reference and sensor need a sampling time over 10 us */
+  ADC_SamplingTimeConfig(ADC1, ADC_Group_FastChannels,
+                         ADC_SamplingTime_384Cycles);
+  ADC_Cmd(ADC1, ENABLE);
+
+  /* VDD = VREFINT / conversion * 4096 */
+  ADC_VrefintCmd(ENABLE);
+  conversion = DriveConvert(ADC_Channel_Vrefint);
+  ADC_VrefintCmd(DISABLE);
+
+  if (conversion == 0)
+  {
+    conversion = 1;
+  }
+  if (VREFINT_FACTORY_CONV != 0)
+  {
+    vdd = (FACTORY_VDD_MV * (VREFINT_FACTORY_MSB | VREFINT_FACTORY_CONV)) /
+          conversion;
+  }
+  else
+  {
+    vdd = ((uint32_t)VREFINT_TYPICAL_MV << 12) / conversion;
+  }
+
+  /* Sensor voltage, in uV, against its voltage at 90 C. x * 1000 / 4096 is
+     computed as x * 125 / 512 to stay within 32 bits */
+  ADC_TempSensorCmd(ENABLE);
+  conversion = DriveConvert(ADC_Channel_TempSensor);
+  ADC_TempSensorCmd(DISABLE);
+
+  vsensor = ((uint32_t)conversion * vdd * 125) >> 9;
+  if (TS_FACTORY_CONV_V90 != 0)
+  {
+    v90 = (FACTORY_VDD_MV * 125 * (TS_FACTORY_MSB | TS_FACTORY_CONV_V90)) >> 9;
+  }
+  else
+  {
+    v90 = TS_TYPICAL_V90_UV;
+  }
+  temperature = 90 + ((int32_t)(vsensor - v90) / TS_AVG_SLOPE_UV);
+
+  /* Restore the ADC1 state of the application */
+  ADC1->TRIGR[0] = trigr1;
+  ADC1->CR3 = cr3;
+  ADC1->CR2 = cr2;
+  ADC1->CR1 = cr1;
+  if (clock == 0)
+  {
+    CLK_PeripheralClockConfig(CLK_Peripheral_ADC1, DISABLE);
+  }
+
+  if (temperature < -128)
+  {
+    temperature = -128;
+  }
+  else if (temperature > 127)
+  {
+    temperature = 127;
+  }
+
+  *VddmV = (uint16_t)vdd;
+  *Temperature = (int8_t)temperature;
+}
+
+/**
+  * @brief  Measures VDD and the temperature and configures the lowest glass
+  *         LCD drive keeping the segments readable, to be called periodically
+  *         (each few seconds is enough) to follow the battery discharge and
+  *         the temperature changes.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_DriveAdjust(void)
+{
+  uint16_t vdd = 0;
+  int8_t temperature = 0;
+
+  LCD_GLASS_DriveMeasure(&vdd, &temperature);
+  LCD_GLASS_DriveConfig(vdd, temperature);
+}
+#endif /* USE_LCD_GLASS_ADAPTIVE_DRIVE */
+
+/**
+  * @brief  Fills the LCD RAM shadow, all registers are marked as modified.
+  * @param  Value: value written in all the registers
+  * @retval None
+  */
+static void ShadowFill(uint8_t Value)
+{
+  uint8_t counter = 0;
+
+  for (counter = 0; counter < GLASS_RAM_NB; counter++)
+  {
+    ShadowRAM[0][counter] = Value;
+    ShadowRAM[1][counter] = Value;
+  }
+
+  for (counter = 0; counter < 3; counter++)
+  {
+    ShadowDirty[0][counter] = 0xFF;
+    ShadowDirty[1][counter] = 0xFF;
+  }
+}
+
+/**
+  * @brief  Writes the characters of the scrolled string which differ from the
+  *         displayed ones.
+  * @param  None
+  * @retval None
+  */
+static void ScrollDisplay(void)
+{
+  uint8_t position = 0, index = ScrollOffset;
+
+  GLASS_Begin();
+
+  for (position = 0; position < Board->CharNb; position++)
+  {
+    if (ScrollDisplayed[position] != ScrollText[index])
+    {
+      ScrollDisplayed[position] = ScrollText[index];
+      GLASS_WriteChar(ScrollDisplayed[position], 0, position);
+    }
+    if (++index == ScrollLength)
+    {
+      index = 0;
+    }
+  }
+
+  GLASS_End();
+}
+
+/**
+  * @brief  Configures the LCD with a drive of the board drive table, unless it
+  *         is already applied.
+  * @param  Index: Drive in the board drive table.
+  * @retval None
+  */
+static void DriveApply(uint8_t Index)
+{
+  __CONST GLASS_Drive_TypeDef* drive = &Board->DriveMap[Index];
+
+  if (Index != DriveIndex)
+  {
+    DriveIndex = Index;
+
+    LCD_ContrastConfig(drive->Contrast);
+    LCD_PulseOnDurationConfig(drive->PulseOnDuration);
+    LCD_DeadTimeConfig(drive->DeadTime);
+    LCD_HighDriveCmd(drive->HighDrive);
+  }
+}
+
+#ifdef USE_LCD_GLASS_ADAPTIVE_DRIVE
+/**
+  * @brief  Converts an ADC1 channel, the first conversion after the channel
+  *         selection being discarded while the internal source starts.
+  * @param  Channel: ADC_Channel_Vrefint or ADC_Channel_TempSensor.
+  * @retval 12-bit conversion result
+  */
+static uint16_t DriveConvert(ADC_Channel_TypeDef Channel)
+{
+  uint8_t counter = 0;
+  uint16_t conversion = 0;
+
+  ADC_ChannelCmd(ADC1, Channel, ENABLE);
+
+  for (counter = 0; counter < 2; counter++)
+  {
+    ADC_SoftwareStartConv(ADC1);
+    while (ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET)
+    {}
+    conversion = ADC_GetConversionValue(ADC1);
+    ADC_ClearFlag(ADC1, ADC_FLAG_EOC);
+  }
+
+  ADC_ChannelCmd(ADC1, Channel, DISABLE);
+
+  return conversion;
+}
+#endif /* USE_LCD_GLASS_ADAPTIVE_DRIVE */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,201 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_glass_lcd.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header for stm8_eval_glass_lcd.c module
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8_EVAL_GLASS_LCD_H
+#define __STM8_EVAL_GLASS_LCD_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "stm8l15x_lcd.h"
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_GLASS_LCD
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Exported_Types
+  * @{
+  */
+/**
+  * @brief  Location of a glass LCD segment in the LCD RAM
+  */
+typedef struct
+{
+  uint8_t Register; /*!< LCD RAM register, GLASS_PAGE2 set when the segment is
+                         in the second LCD RAM bank */
+  uint8_t Mask;     /*!< Segment bit in the LCD RAM register, 0 when the glyph
+                         bit is not wired to a segment */
+}GLASS_Segment_TypeDef;
+
+/**
+  * @brief  Glass LCD drive settings and the supply voltage and temperature
+  *         range in which they keep the segments readable
+  */
+typedef struct
+{
+  uint16_t VddMin;                             /*!< Lowest VDD, in mV */
+  int8_t TemperatureMin;                       /*!< Lowest temperature, in
+                                                    degrees Celsius */
+  int8_t TemperatureMax;                       /*!< Highest temperature, in
+                                                    degrees Celsius */
+  LCD_Contrast_TypeDef Contrast;               /*!< VLCD */
+  LCD_PulseOnDuration_TypeDef PulseOnDuration; /*!< Low resistance divider
+                                                    pulse on duration */
+  LCD_DeadTime_TypeDef DeadTime;               /*!< Dead time between frames */
+  FunctionalState HighDrive;                   /*!< Permanent low resistance
+                                                    divider */
+}GLASS_Drive_TypeDef;
+
+/**
+  * @brief  Glass LCD description provided by the board glass LCD driver
+  */
+typedef struct
+{
+  uint8_t CharNb;                          /*!< Characters of the glass, at most
+                                                GLASS_CHAR_MAX_NB */
+  uint8_t GlyphSize;                       /*!< Bytes per glyph, one bit per
+                                                segment, at most
+                                                GLASS_GLYPH_MAX_SIZE */
+  __CONST uint8_t* GlyphMap;               /*!< Glyphs of the printable ascii
+                                                characters ' ' to '~',
+                                                [95][GlyphSize] */
+  __CONST GLASS_Segment_TypeDef* CharMap;  /*!< Segments of each character in
+                                                glyph bit order (bit 0 of the
+                                                first byte first),
+                                                [CharNb][GlyphSize * 8] */
+  uint8_t PointSegment;                    /*!< Glyph bit of the point */
+  uint8_t ExtraSegment;                    /*!< Glyph bit of the second
+                                                character flag (apostrophe,
+                                                double point...) */
+  uint8_t RegisterNb;                      /*!< LCD RAM registers used per bank */
+  uint8_t PageNb;                          /*!< LCD RAM banks used: 1, or 2 for
+                                                the 1/8 duty */
+  __CONST GLASS_Drive_TypeDef* DriveMap;   /*!< Drive settings from the lowest
+                                                to the highest drive, the last
+                                                one being valid in the whole
+                                                operating range, [DriveNb] */
+  uint8_t DriveNb;                         /*!< Drive settings, at least 1 */
+}GLASS_Board_TypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Exported_Constants
+  * @{
+  */
+/* Uncomment the line below to copy the LCD RAM shadow into the LCD RAM at the
+   LCD start of frame instead of at the end of each glass LCD function, so that
+   an update is never displayed half done. LCD_GLASS_IRQHandler() must then be
+   called from the LCD interrupt handler */
+/* #define USE_LCD_GLASS_SOF_COMMIT */
+
+/* Uncomment the line below to select the glass LCD drive from the VDD and the
+   temperature measured by the ADC (LCD_GLASS_DriveAdjust()) instead of using
+   the drive valid in the whole operating range. The ADC driver must then be
+   enabled in stm8l15x_conf.h. The board drive tables give only the whole range
+   drive until the lower drives are characterized on the board glass */
+/* #define USE_LCD_GLASS_ADAPTIVE_DRIVE */
+
+#define GLASS_PAGE2          ((uint8_t)0x80) /*!< Segment in the second LCD RAM bank */
+#define GLASS_RAM_NB         ((uint8_t)0x16) /*!< LCD RAM registers per bank */
+#define GLASS_CHAR_MAX_NB    ((uint8_t)8)
+#define GLASS_GLYPH_MAX_SIZE ((uint8_t)4)
+
+/**
+  * @brief  GLASS_WriteChar() flags
+  */
+#define GLASS_POINT          ((uint8_t)0x01) /*!< Point segment on */
+#define GLASS_EXTRA          ((uint8_t)0x02) /*!< Second character flag segment on */
+
+/* Size of the text buffer of the non blocking scroll */
+#define LCD_GLASS_SCROLL_MAX_LENGTH ((uint8_t)32)
+
+/* Non blocking scroll speeds, in number of LCD_GLASS_ScrollTick() calls per
+   scroll step */
+#define LCD_GLASS_SCROLL_SPEED_FAST   ((uint8_t)4)
+#define LCD_GLASS_SCROLL_SPEED_MEDIUM ((uint8_t)8)
+#define LCD_GLASS_SCROLL_SPEED_SLOW   ((uint8_t)16)
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_GLASS_LCD_Exported_Functions
+  * @{
+  */
+/**
+  * @brief  Board glass LCD driver interface
+  */
+void GLASS_Init(__CONST GLASS_Board_TypeDef* GlassBoard);
+void GLASS_Begin(void);
+void GLASS_End(void);
+uint8_t* GLASS_Register(uint8_t Register);
+void GLASS_WriteChar(uint8_t Char, uint8_t Flags, uint8_t Position);
+
+/**
+  * @brief  Glass LCD functions common to all the boards
+  */
+void LCD_GLASS_ClearChar(uint8_t Position);
+void LCD_GLASS_Clear(void);
+void LCD_GLASS_DisplayString(uint8_t* ptr);
+void LCD_GLASS_ScrollStart(uint8_t* ptr, uint8_t Speed, uint16_t nScroll);
+void LCD_GLASS_ScrollStop(void);
+FlagStatus LCD_GLASS_ScrollGetStatus(void);
+void LCD_GLASS_ScrollSetCallback(void (*Callback)(void));
+void LCD_GLASS_ScrollTick(void);
+void LCD_GLASS_Commit(void);
+void LCD_GLASS_IRQHandler(void);
+void LCD_GLASS_DriveConfig(uint16_t VddmV, int8_t Temperature);
+#ifdef USE_LCD_GLASS_ADAPTIVE_DRIVE
+void LCD_GLASS_DriveMeasure(uint16_t* VddmV, int8_t* Temperature);
+void LCD_GLASS_DriveAdjust(void);
+#endif /* USE_LCD_GLASS_ADAPTIVE_DRIVE */
+
+#endif /* __STM8_EVAL_GLASS_LCD_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
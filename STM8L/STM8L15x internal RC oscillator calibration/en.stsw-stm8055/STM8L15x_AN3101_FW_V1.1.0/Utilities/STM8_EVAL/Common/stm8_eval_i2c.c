@@ -0,0 +1,761 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_i2c.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   This file provides the interrupt driven I2C master used by the
+  *          I2C EEPROM and temperature sensor drivers of the STM8-EVAL boards.
+  *          The I2C peripheral (I2CM_I2C) is defined in stm8xx_eval.h file and
+  *          configured once by I2CM_Init(), called by the driver of each
+  *          device (sEE_Init(), LM75_Init()): initializing one device does
+  *          not reconfigure the bus under the transfers of the other one.
+  *
+  *          @note A transfer is described by an I2CM_Transfer_TypeDef: the
+  *                slave address, the register (or memory address) and data
+  *                bytes to send, then the bytes to read after a repeated
+  *                START. I2CM_Start() sends the START condition and returns:
+  *                the rest of the transfer, up to the STOP condition, is run
+  *                by I2CM_IRQHandler(), which must be called in the I2C
+  *                interrupt routine (I2C1_SPI2_IRQHandler in stm8l15x_it.c),
+  *                and the interrupts must be enabled. At the end, the Status
+  *                of the transfer is updated and its Callback called.
+  *                I2CM_Wait() waits for the end of a transfer.
+  *
+  *          @note A NACK, a bus error, an arbitration loss or an overrun ends
+  *                the transfer with an error status. A transfer without bus
+  *                event during I2CM_WAIT_TIMEOUT loops of I2CM_Wait(), or
+  *                I2CM_TICK_TIMEOUT calls of I2CM_Tick() (to be called
+  *                periodically, from a timer interrupt routine for instance,
+  *                by the applications which do not wait for the transfers),
+  *                is aborted with I2CM_ERROR_TIMEOUT.
+  *
+  *          @note The EEPROM and LM75 drivers share the bus: I2CM_Start()
+  *                queues the transfer when another one is running (it waits
+  *                only when I2CM_QUEUE_SIZE transfers are already queued).
+  *                The queued transfers are run by order of Priority, then of
+  *                arrival; a transfer is overtaken at most I2CM_OVERTAKE_MAX
+  *                times, which bounds its latency. The transfer running is
+  *                never interrupted. After a read, the next transfer is
+  *                chained with a repeated START instead of a STOP and a
+  *                START; a write always ends with a STOP, which starts the
+  *                internal write cycle of the EEPROM.
+  *
+  *          @note When I2CM_USE_STATISTICS is defined in stm8_eval_i2c.h, the
+  *                transfers, errors and repeated STARTs are counted, as well
+  *                as the I2CM_Tick() calls with a transfer running: read by
+  *                I2CM_GetStatistics(), they give the bus utilisation.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_i2c.h"
+
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_I2C
+  * @brief      This file includes the interrupt driven I2C master of STM8-EVAL
+  *             boards.
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_I2C_Private_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_I2C_Private_Defines
+  * @{
+  */
+/**
+  * @brief  Phases of the transfer
+  */
+#define I2CM_STATE_START          ((uint8_t)0x00)  /*!< Waiting for the START */
+#define I2CM_STATE_WRITE          ((uint8_t)0x01)  /*!< Register and data sent */
+#define I2CM_STATE_RESTART        ((uint8_t)0x02)  /*!< Waiting for the repeated START */
+#define I2CM_STATE_READ           ((uint8_t)0x03)  /*!< Data received */
+
+/**
+  * @brief  Error flags of SR2 ending a transfer
+  */
+#define I2CM_SR2_ERRORS           ((uint8_t)(I2C_SR2_OVR | I2C_SR2_AF | I2C_SR2_ARLO | I2C_SR2_BERR))
+
+/**
+  * @brief  Interrupts used by the transfers
+  */
+#define I2CM_IT_ALL               ((I2C_IT_TypeDef)(I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR))
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_I2C_Private_Macros
+  * @{
+  */
+#ifdef I2CM_USE_STATISTICS
+#define I2CM_STATISTICS_ADD(Counter, Value)  (I2CMStatistics.Counter += (Value))
+#else
+#define I2CM_STATISTICS_ADD(Counter, Value)
+#endif /* I2CM_USE_STATISTICS */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_I2C_Private_Variables
+  * @{
+  */
+static I2CM_Transfer_TypeDef* __IO I2CMTransfer = 0;  /* Transfer running, 0 if none */
+static I2CM_Transfer_TypeDef* I2CMQueue[I2CM_QUEUE_SIZE];  /* Transfers waiting, next first */
+static uint8_t I2CMOvertake[I2CM_QUEUE_SIZE];         /* Times each one was overtaken */
+static __IO uint8_t I2CMQueueNb = 0;
+static uint8_t I2CMRestart = 0;                       /* Repeated START sent for the next transfer */
+static uint8_t I2CMState = I2CM_STATE_START;
+static uint16_t I2CMIndex = 0;                        /* Bytes sent or received in the phase */
+static __IO uint8_t I2CMEvent = 0;                    /* Incremented by each interrupt */
+static uint8_t I2CMTickEvent = 0;                     /* I2CMEvent at the last I2CM_Tick() */
+static uint8_t I2CMTickTime = 0;                      /* I2CM_Tick() calls without event */
+#ifdef I2CM_USE_STATISTICS
+static I2CM_Statistics_TypeDef I2CMStatistics;
+#endif /* I2CM_USE_STATISTICS */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_I2C_Private_Function_Prototypes
+  * @{
+  */
+static void I2CM_Enqueue(I2CM_Transfer_TypeDef* Transfer);
+static void I2CM_StartNext(void);
+static void I2CM_GenerateEnd(void);
+static void I2CM_End(uint8_t Status);
+static void I2CM_Timeout(uint8_t Event);
+static void I2CM_AddressSent(I2CM_Transfer_TypeDef* Transfer);
+static void I2CM_Transmit(I2CM_Transfer_TypeDef* Transfer, uint8_t SR1);
+static void I2CM_Receive(I2CM_Transfer_TypeDef* Transfer, uint8_t SR1);
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_I2C_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Configures I2CM_I2C as I2C master, unless it is already enabled.
+  * @note   The clock and pins of I2CM_I2C are enabled by the low level
+  *         initialization of the device driver before.
+  * @param  None
+  * @retval None
+  */
+void I2CM_Init(void)
+{
+  if ((I2CM_I2C->CR1 & I2C_CR1_PE) != 0)
+  {
+    return;
+  }
+
+  /* I2CM_I2C Peripheral Enable */
+  I2C_Cmd(I2CM_I2C, ENABLE);
+  /* I2CM_I2C configuration after enabling it */
+  I2C_Init(I2CM_I2C, I2CM_SPEED, I2CM_OWN_ADDRESS, I2C_Mode_I2C, I2C_DutyCycle_2,
+           I2C_Ack_Enable, I2C_AcknowledgedAddress_7bit);
+}
+
+/**
+  * @brief  Starts an I2C transfer, or queues it when the bus is busy.
+  * @note   When I2CM_QUEUE_SIZE transfers are queued, this function waits for
+  *         the end of the transfer running: it must not be called then from
+  *         a Callback.
+  * @param  Transfer: pointer to the transfer, which must stay valid until its
+  *         end (Status different from I2CM_BUSY).
+  * @retval None
+  */
+void I2CM_Start(I2CM_Transfer_TypeDef* Transfer)
+{
+  I2CM_Transfer_TypeDef* running = 0;
+  uint8_t itr = 0;
+
+  /*!< Wait for a free place in the queue */
+  while ((I2CMQueueNb >= I2CM_QUEUE_SIZE) && ((running = I2CMTransfer) != 0))
+  {
+    I2CM_Wait(running);
+  }
+
+  Transfer->Status = I2CM_BUSY;
+
+  /*!< Prevent the interrupt from ending the transfer running meanwhile */
+  itr = I2C_ReadRegister(I2CM_I2C, I2C_Register_ITR);
+  I2C_ITConfig(I2CM_I2C, I2CM_IT_ALL, DISABLE);
+
+  I2CM_Enqueue(Transfer);
+
+  if (I2CMTransfer == 0)
+  {
+    I2CM_StartNext();
+  }
+  else
+  {
+    I2CM_I2C->ITR = itr;
+  }
+}
+
+/**
+  * @brief  Waits for the end of an I2C transfer, running or queued, aborting
+  *         the transfer running after I2CM_WAIT_TIMEOUT loops without bus
+  *         event.
+  * @param  Transfer: pointer to the transfer started by I2CM_Start().
+  * @retval The transfer status:
+  *         - I2CM_OK: transfer done
+  *         - I2CM_ERROR_NACK: address or data not acknowledged by the slave
+  *         - I2CM_ERROR_BUS: bus error, arbitration lost or overrun
+  *         - I2CM_ERROR_TIMEOUT: transfer aborted
+  */
+uint8_t I2CM_Wait(I2CM_Transfer_TypeDef* Transfer)
+{
+  uint32_t timeout = I2CM_WAIT_TIMEOUT;
+  uint8_t event = I2CMEvent;
+
+  while (Transfer->Status == I2CM_BUSY)
+  {
+    if (event != I2CMEvent)
+    {
+      /*!< The transfer progresses */
+      event = I2CMEvent;
+      timeout = I2CM_WAIT_TIMEOUT;
+    }
+    else if (--timeout == 0)
+    {
+      /*!< Abort the transfer running, this one or the one it waits for */
+      I2CM_Timeout(event);
+      timeout = I2CM_WAIT_TIMEOUT;
+    }
+  }
+
+  return Transfer->Status;
+}
+
+/**
+  * @brief  Aborts the transfer running without bus event during
+  *         I2CM_TICK_TIMEOUT calls.
+  * @note   This function should be called periodically when the transfers are
+  *         not waited for by I2CM_Wait(), and to measure the bus utilisation
+  *         (I2CM_USE_STATISTICS).
+  * @param  None
+  * @retval None
+  */
+void I2CM_Tick(void)
+{
+  uint8_t event = I2CMEvent;
+
+  I2CM_STATISTICS_ADD(TickNb, 1);
+
+  if (I2CMTransfer == 0)
+  {
+    I2CMTickTime = 0;
+  }
+  else
+  {
+    I2CM_STATISTICS_ADD(BusyTickNb, 1);
+
+    if (I2CMTickEvent != event)
+    {
+      I2CMTickTime = 0;
+    }
+    else if (++I2CMTickTime >= I2CM_TICK_TIMEOUT)
+    {
+      I2CMTickTime = 0;
+      I2CM_Timeout(event);
+    }
+  }
+  I2CMTickEvent = event;
+}
+
+/**
+  * @brief  Runs the I2C transfer on the I2C events and errors.
+  * @note   This function should be called in the I2C1_SPI2_IRQHandler in the
+  *         stm8l15x_it.c file.
+  *
+  *       // INTERRUPT_HANDLER(I2C1_SPI2_IRQHandler, 29)
+  *       // {
+  *           // I2CM_IRQHandler();
+  *       // }
+  * @param  None
+  * @retval None
+  */
+void I2CM_IRQHandler(void)
+{
+  I2CM_Transfer_TypeDef* transfer = I2CMTransfer;
+  uint8_t sr1 = 0, sr2 = 0;
+
+  if (transfer == 0)
+  {
+    return;
+  }
+
+  I2CMEvent++;
+
+  sr2 = (uint8_t)(I2C_ReadRegister(I2CM_I2C, I2C_Register_SR2) & I2CM_SR2_ERRORS);
+  if (sr2 != 0)
+  {
+    /*!< Clear the error flags */
+    I2CM_I2C->SR2 = (uint8_t)(~sr2);
+
+    /*!< The bus is released, unless another master has won it */
+    I2C_GenerateSTART(I2CM_I2C, DISABLE);
+    I2CMRestart = 0;
+    if ((sr2 & I2C_SR2_ARLO) == 0)
+    {
+      I2C_GenerateSTOP(I2CM_I2C, ENABLE);
+    }
+
+    I2CM_End(((sr2 & I2C_SR2_AF) != 0) ? I2CM_ERROR_NACK : I2CM_ERROR_BUS);
+    return;
+  }
+
+  sr1 = I2C_ReadRegister(I2CM_I2C, I2C_Register_SR1);
+
+  if (((sr1 & I2C_SR1_SB) != 0) && (I2CMState != I2CM_STATE_WRITE)
+      && (I2CMState != I2CM_STATE_READ))
+  {
+    /*!< EV5: send the slave address, which clears SB. During a read, SB is
+         the repeated START of the next transfer, handled once it runs */
+    if ((I2CMState == I2CM_STATE_START)
+        && ((transfer->RegisterNb != 0) || (transfer->WriteNb != 0) || (transfer->ReadNb == 0)))
+    {
+      I2CMState = I2CM_STATE_WRITE;
+      I2C_Send7bitAddress(I2CM_I2C, transfer->Address, I2C_Direction_Transmitter);
+    }
+    else
+    {
+      I2CMState = I2CM_STATE_READ;
+      I2C_Send7bitAddress(I2CM_I2C, transfer->Address, I2C_Direction_Receiver);
+    }
+  }
+  else if ((sr1 & I2C_SR1_ADDR) != 0)
+  {
+    /*!< EV6 */
+    I2CM_AddressSent(transfer);
+  }
+  else if (I2CMState == I2CM_STATE_WRITE)
+  {
+    I2CM_Transmit(transfer, sr1);
+  }
+  else if (I2CMState == I2CM_STATE_READ)
+  {
+    I2CM_Receive(transfer, sr1);
+  }
+  /*!< I2CM_STATE_RESTART: BTF stays set until the repeated START is sent */
+}
+
+#ifdef I2CM_USE_STATISTICS
+/**
+  * @brief  Returns the bus use counted since the last I2CM_ClearStatistics().
+  * @param  Statistics: pointer to the structure that receives the counters.
+  * @retval None
+  */
+void I2CM_GetStatistics(I2CM_Statistics_TypeDef* Statistics)
+{
+  *Statistics = I2CMStatistics;
+}
+
+/**
+  * @brief  Clears the counters of the bus use.
+  * @param  None
+  * @retval None
+  */
+void I2CM_ClearStatistics(void)
+{
+  I2CMStatistics.TransferNb = 0;
+  I2CMStatistics.ErrorNb = 0;
+  I2CMStatistics.ByteNb = 0;
+  I2CMStatistics.RestartNb = 0;
+  I2CMStatistics.TickNb = 0;
+  I2CMStatistics.BusyTickNb = 0;
+}
+#endif /* I2CM_USE_STATISTICS */
+
+/**
+  * @brief  Inserts a transfer in the queue, after the transfers of the same
+  *         or higher priority and the ones already overtaken
+  *         I2CM_OVERTAKE_MAX times.
+  * @note   The I2C interrupts are disabled by the caller.
+  * @param  Transfer: pointer to the transfer.
+  * @retval None
+  */
+static void I2CM_Enqueue(I2CM_Transfer_TypeDef* Transfer)
+{
+  uint8_t index = I2CMQueueNb;
+
+  while ((index != 0) && (I2CMQueue[index - 1]->Priority < Transfer->Priority)
+         && (I2CMOvertake[index - 1] < I2CM_OVERTAKE_MAX))
+  {
+    I2CMQueue[index] = I2CMQueue[index - 1];
+    I2CMOvertake[index] = (uint8_t)(I2CMOvertake[index - 1] + 1);
+    index--;
+  }
+
+  I2CMQueue[index] = Transfer;
+  I2CMOvertake[index] = 0;
+  I2CMQueueNb++;
+}
+
+/**
+  * @brief  Runs the first transfer of the queue, if the bus is free.
+  * @note   The I2C interrupts are disabled by the caller.
+  * @param  None
+  * @retval None
+  */
+static void I2CM_StartNext(void)
+{
+  I2CM_Transfer_TypeDef* transfer = 0;
+  uint32_t timeout = I2CM_WAIT_TIMEOUT;
+  uint8_t index = 0;
+
+  if ((I2CMTransfer != 0) || (I2CMQueueNb == 0))
+  {
+    return;
+  }
+
+  transfer = I2CMQueue[0];
+  I2CMQueueNb--;
+  for (index = 0; index < I2CMQueueNb; index++)
+  {
+    I2CMQueue[index] = I2CMQueue[index + 1];
+    I2CMOvertake[index] = I2CMOvertake[index + 1];
+  }
+
+  I2CMIndex = 0;
+  I2CMState = I2CM_STATE_START;
+  I2CMTransfer = transfer;
+
+  I2C_AcknowledgeConfig(I2CM_I2C, ENABLE);
+  I2C_AckPositionConfig(I2CM_I2C, I2C_AckPosition_Current);
+
+  if (I2CMRestart != 0)
+  {
+    /*!< The repeated START has been requested at the end of the previous
+         transfer */
+    I2CMRestart = 0;
+    I2CM_STATISTICS_ADD(RestartNb, 1);
+  }
+  else
+  {
+    /*!< Wait for the STOP condition of the previous transfer to be sent */
+    while ((I2C_ReadRegister(I2CM_I2C, I2C_Register_CR2) & I2C_CR2_STOP) && --timeout)
+    {}
+
+    /*!< Send START condition */
+    I2C_GenerateSTART(I2CM_I2C, ENABLE);
+  }
+
+  /*!< The buffer interrupts are enabled once the slave address is sent */
+  I2C_ITConfig(I2CM_I2C, (I2C_IT_TypeDef)(I2C_IT_EVT | I2C_IT_ERR), ENABLE);
+}
+
+/**
+  * @brief  Ends the last read of a transfer with a repeated START when
+  *         another transfer is queued, or else with a STOP condition.
+  * @param  None
+  * @retval None
+  */
+static void I2CM_GenerateEnd(void)
+{
+  if (I2CMQueueNb != 0)
+  {
+    I2CMRestart = 1;
+    I2C_GenerateSTART(I2CM_I2C, ENABLE);
+  }
+  else
+  {
+    I2C_GenerateSTOP(I2CM_I2C, ENABLE);
+  }
+}
+
+/**
+  * @brief  Ends the transfer running and starts the next one queued.
+  * @param  Status: status of the transfer.
+  * @retval None
+  */
+static void I2CM_End(uint8_t Status)
+{
+  I2CM_Transfer_TypeDef* transfer = I2CMTransfer;
+
+  I2C_ITConfig(I2CM_I2C, I2CM_IT_ALL, DISABLE);
+
+  /*!< A byte received before the STOP condition of an aborted transfer must
+       not be acknowledged; I2CM_Start() enables the acknowledge again */
+  I2C_AcknowledgeConfig(I2CM_I2C, DISABLE);
+  I2C_AckPositionConfig(I2CM_I2C, I2C_AckPosition_Current);
+
+  I2CM_STATISTICS_ADD(TransferNb, 1);
+  if (Status == I2CM_OK)
+  {
+    I2CM_STATISTICS_ADD(ByteNb, transfer->RegisterNb + transfer->WriteNb + transfer->ReadNb);
+  }
+  else
+  {
+    I2CM_STATISTICS_ADD(ErrorNb, 1);
+  }
+
+  /*!< The callback may queue another transfer */
+  I2CMTransfer = 0;
+  transfer->Status = Status;
+
+  if (transfer->Callback != 0)
+  {
+    transfer->Callback();
+  }
+
+  I2CM_StartNext();
+}
+
+/**
+  * @brief  Aborts the transfer running, unless a bus event occurred since
+  *         the timeout was detected.
+  * @param  Event: value of I2CMEvent when the timeout was detected.
+  * @retval None
+  */
+static void I2CM_Timeout(uint8_t Event)
+{
+  uint8_t itr = I2C_ReadRegister(I2CM_I2C, I2C_Register_ITR);
+
+  if ((itr & I2C_IT_EVT) == 0)
+  {
+    /*!< I2CM_Start() or I2CM_Timeout() interrupted by I2CM_Tick(): the
+         transfer running, if any, is checked again at the next call */
+    return;
+  }
+
+  /*!< Prevent the interrupt from ending the transfer meanwhile */
+  I2C_ITConfig(I2CM_I2C, I2CM_IT_ALL, DISABLE);
+
+  if ((I2CMTransfer != 0) && (I2CMEvent == Event))
+  {
+    I2C_GenerateSTART(I2CM_I2C, DISABLE);
+    I2CMRestart = 0;
+
+    /*!< Release the bus if the START condition has been sent */
+    if ((I2C_ReadRegister(I2CM_I2C, I2C_Register_SR3) & I2C_SR3_MSL) != 0)
+    {
+      I2C_GenerateSTOP(I2CM_I2C, ENABLE);
+    }
+
+    I2CM_End(I2CM_ERROR_TIMEOUT);
+  }
+  else
+  {
+    /*!< The transfer has progressed or ended meanwhile */
+    I2CM_I2C->ITR = itr;
+  }
+}
+
+/**
+  * @brief  Handles the end of the slave address (EV6).
+  * @note   ADDR is cleared by the read of SR3 following the read of SR1: the
+  *         acknowledge of the first bytes read is configured before.
+  * @param  Transfer: pointer to the transfer running.
+  * @retval None
+  */
+static void I2CM_AddressSent(I2CM_Transfer_TypeDef* Transfer)
+{
+  if (I2CMState == I2CM_STATE_READ)
+  {
+    if (Transfer->ReadNb == 1)
+    {
+      /*!< NACK and STOP (or repeated START) after the single byte, read on
+           RXNE */
+      I2C_AcknowledgeConfig(I2CM_I2C, DISABLE);
+      I2C_ReadRegister(I2CM_I2C, I2C_Register_SR3);
+      I2CM_GenerateEnd();
+      I2C_ITConfig(I2CM_I2C, I2C_IT_BUF, ENABLE);
+    }
+    else if (Transfer->ReadNb == 2)
+    {
+      /*!< NACK on the second byte, both read on BTF */
+      I2C_AckPositionConfig(I2CM_I2C, I2C_AckPosition_Next);
+      I2C_AcknowledgeConfig(I2CM_I2C, DISABLE);
+      I2C_ReadRegister(I2CM_I2C, I2C_Register_SR3);
+    }
+    else
+    {
+      I2C_ReadRegister(I2CM_I2C, I2C_Register_SR3);
+
+      /*!< Bytes read on RXNE up to the last three, handled on BTF */
+      if (Transfer->ReadNb > 3)
+      {
+        I2C_ITConfig(I2CM_I2C, I2C_IT_BUF, ENABLE);
+      }
+    }
+  }
+  else
+  {
+    I2C_ReadRegister(I2CM_I2C, I2C_Register_SR3);
+
+    if ((Transfer->RegisterNb == 0) && (Transfer->WriteNb == 0))
+    {
+      /*!< Address only: the slave has acknowledged it */
+      I2C_GenerateSTOP(I2CM_I2C, ENABLE);
+      I2CM_End(I2CM_OK);
+    }
+    else
+    {
+      I2C_ITConfig(I2CM_I2C, I2C_IT_BUF, ENABLE);
+    }
+  }
+}
+
+/**
+  * @brief  Sends the register and data bytes (EV8), then the repeated START
+  *         or the STOP condition once the last byte is sent (EV8_2).
+  * @param  Transfer: pointer to the transfer running.
+  * @param  SR1: value of the SR1 register.
+  * @retval None
+  */
+static void I2CM_Transmit(I2CM_Transfer_TypeDef* Transfer, uint8_t SR1)
+{
+  uint16_t total = (uint16_t)(Transfer->RegisterNb + Transfer->WriteNb);
+  uint8_t data = 0;
+
+  if (I2CMIndex < total)
+  {
+    if ((SR1 & I2C_SR1_TXE) != 0)
+    {
+      if (I2CMIndex < Transfer->RegisterNb)
+      {
+        /*!< Register or memory address, MSB first */
+        data = (uint8_t)(Transfer->Register >> ((Transfer->RegisterNb - I2CMIndex - 1) << 3));
+      }
+      else
+      {
+        data = Transfer->pWriteBuffer[I2CMIndex - Transfer->RegisterNb];
+      }
+      I2C_SendData(I2CM_I2C, data);
+
+      if (++I2CMIndex == total)
+      {
+        /*!< Wait for the last byte to be sent (BTF) */
+        I2C_ITConfig(I2CM_I2C, I2C_IT_BUF, DISABLE);
+      }
+    }
+  }
+  else if ((SR1 & I2C_SR1_BTF) != 0)
+  {
+    if (Transfer->ReadNb != 0)
+    {
+      /*!< Send Re-START condition, which clears BTF once sent */
+      I2CMState = I2CM_STATE_RESTART;
+      I2CMIndex = 0;
+      I2C_GenerateSTART(I2CM_I2C, ENABLE);
+    }
+    else
+    {
+      I2C_GenerateSTOP(I2CM_I2C, ENABLE);
+      I2CM_End(I2CM_OK);
+    }
+  }
+}
+
+/**
+  * @brief  Receives the data bytes (EV7), the last ones being handled as
+  *         described in the reference manual to send the NACK and the STOP
+  *         condition in time.
+  * @param  Transfer: pointer to the transfer running.
+  * @param  SR1: value of the SR1 register.
+  * @retval None
+  */
+static void I2CM_Receive(I2CM_Transfer_TypeDef* Transfer, uint8_t SR1)
+{
+  uint16_t remaining = (uint16_t)(Transfer->ReadNb - I2CMIndex);
+
+  if (remaining == 1)
+  {
+    if ((SR1 & I2C_SR1_RXNE) != 0)
+    {
+      Transfer->pReadBuffer[I2CMIndex++] = I2C_ReceiveData(I2CM_I2C);
+      I2CM_End(I2CM_OK);
+    }
+  }
+  else if (remaining == 2)
+  {
+    /*!< Two bytes transfer: byte 1 in DR, byte 2 in the shift register */
+    if ((SR1 & I2C_SR1_BTF) != 0)
+    {
+      I2CM_GenerateEnd();
+      Transfer->pReadBuffer[I2CMIndex++] = I2C_ReceiveData(I2CM_I2C);
+      Transfer->pReadBuffer[I2CMIndex++] = I2C_ReceiveData(I2CM_I2C);
+      I2CM_End(I2CM_OK);
+    }
+  }
+  else if (remaining == 3)
+  {
+    /*!< Byte N-2 in DR, byte N-1 in the shift register: NACK byte N */
+    if ((SR1 & I2C_SR1_BTF) != 0)
+    {
+      I2C_AcknowledgeConfig(I2CM_I2C, DISABLE);
+      Transfer->pReadBuffer[I2CMIndex++] = I2C_ReceiveData(I2CM_I2C);
+      I2CM_GenerateEnd();
+      Transfer->pReadBuffer[I2CMIndex++] = I2C_ReceiveData(I2CM_I2C);
+
+      /*!< Byte N read on RXNE */
+      I2C_ITConfig(I2CM_I2C, I2C_IT_BUF, ENABLE);
+    }
+  }
+  else if ((SR1 & I2C_SR1_RXNE) != 0)
+  {
+    Transfer->pReadBuffer[I2CMIndex++] = I2C_ReceiveData(I2CM_I2C);
+
+    if (remaining == 4)
+    {
+      /*!< Wait for BTF with the last three bytes */
+      I2C_ITConfig(I2CM_I2C, I2C_IT_BUF, DISABLE);
+    }
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
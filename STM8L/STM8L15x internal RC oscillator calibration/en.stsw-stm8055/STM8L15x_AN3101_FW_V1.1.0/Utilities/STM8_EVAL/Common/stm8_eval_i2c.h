@@ -0,0 +1,188 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_i2c.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header for stm8_eval_i2c.c module
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8_EVAL_I2C_H
+#define __STM8_EVAL_I2C_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval.h"
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_I2C
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_I2C_Exported_Types
+  * @{
+  */
+/**
+  * @brief  I2C transfer: the Register bytes and the write buffer are sent to
+  *         the slave, then the read buffer is received after a repeated START
+  */
+typedef struct
+{
+  uint8_t Address;          /*!< Slave address, 8-bit form (bit 0 ignored) */
+  uint16_t Register;        /*!< Register or memory address sent first */
+  uint8_t RegisterNb;       /*!< Bytes of Register sent, MSB first: 0 to 2 */
+  uint8_t* pWriteBuffer;    /*!< Data sent after Register */
+  uint16_t WriteNb;         /*!< Bytes of pWriteBuffer sent */
+  uint8_t* pReadBuffer;     /*!< Data received */
+  uint16_t ReadNb;          /*!< Bytes received in pReadBuffer */
+  void (*Callback)(void);   /*!< Called at the end of the transfer, from the
+                                 I2C interrupt, or 0 */
+  uint8_t Priority;         /*!< Queued transfers of higher Priority are run
+                                 first: I2CM_PRIORITY_LOW or I2CM_PRIORITY_HIGH */
+  __IO uint8_t Status;      /*!< I2CM_BUSY until the end of the transfer */
+}I2CM_Transfer_TypeDef;
+
+/**
+  * @brief  Bus use counted since the last I2CM_ClearStatistics()
+  */
+typedef struct
+{
+  uint32_t TransferNb;    /*!< Transfers ended */
+  uint32_t ErrorNb;       /*!< Transfers ended with an error */
+  uint32_t ByteNb;        /*!< Bytes sent and received, addresses excluded */
+  uint32_t RestartNb;     /*!< Transfers chained by a repeated START */
+  uint32_t TickNb;        /*!< I2CM_Tick() calls */
+  uint32_t BusyTickNb;    /*!< I2CM_Tick() calls with a transfer running: the
+                               bus utilisation is BusyTickNb / TickNb */
+}I2CM_Statistics_TypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_I2C_Exported_Constants
+  * @{
+  */
+/**
+  * @brief  Status of the transfers
+  */
+#define I2CM_OK                 ((uint8_t)0x00)
+#define I2CM_BUSY               ((uint8_t)0x01)  /*!< Transfer running */
+#define I2CM_ERROR_NACK         ((uint8_t)0x02)  /*!< Address or data not acknowledged */
+#define I2CM_ERROR_BUS          ((uint8_t)0x03)  /*!< Bus error, arbitration lost or overrun */
+#define I2CM_ERROR_TIMEOUT      ((uint8_t)0x04)  /*!< No bus event before the timeout */
+
+/**
+  * @brief  Priorities of the transfers
+  */
+#define I2CM_PRIORITY_LOW       ((uint8_t)0x00)  /*!< Bulk transfers (EEPROM) */
+#define I2CM_PRIORITY_HIGH      ((uint8_t)0x01)  /*!< Short periodic transfers (LM75) */
+
+/**
+  * @brief  Transfers waiting for the bus, in addition to the one running
+  */
+#define I2CM_QUEUE_SIZE         4
+
+/**
+  * @brief  Times a queued transfer can be overtaken by transfers of higher
+  *         priority: with I2CM_QUEUE_SIZE, it bounds the number of transfers
+  *         run before it
+  */
+#define I2CM_OVERTAKE_MAX       2
+
+/**
+  * @brief  I2CM_Wait() and I2CM_Start() loops without bus event before the
+  *         transfer is aborted
+  */
+#define I2CM_WAIT_TIMEOUT       ((uint32_t)0x3FFFF)
+
+/**
+  * @brief  I2CM_Tick() calls without bus event before the transfer is aborted
+  */
+#define I2CM_TICK_TIMEOUT       10
+
+/**
+  * @brief  Bus clock and own address set by I2CM_Init(): the EEPROM driver
+  *         limits the bus to 200 kHz, the LM75 supports up to 400 kHz
+  */
+#define I2CM_SPEED              200000
+#define I2CM_OWN_ADDRESS        0xA0
+
+/**
+  * @brief  Uncomment the line below to count the transfers, errors, repeated
+  *         STARTs and the I2CM_Tick() calls with the bus busy, to measure the
+  *         bus utilisation: see I2CM_GetStatistics()
+  */
+/* #define I2CM_USE_STATISTICS */
+
+/**
+  * @brief  Uncomment the line below when the I2C EEPROM or temperature sensor
+  *         driver is linked, so that the project I2C interrupt routine calls
+  *         I2CM_IRQHandler()
+  */
+/* #define USE_I2CM */
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_I2C_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_I2C_Exported_Functions
+  * @{
+  */
+void I2CM_Init(void);
+void I2CM_Start(I2CM_Transfer_TypeDef* Transfer);
+uint8_t I2CM_Wait(I2CM_Transfer_TypeDef* Transfer);
+void I2CM_Tick(void);
+void I2CM_IRQHandler(void);
+#ifdef I2CM_USE_STATISTICS
+void I2CM_GetStatistics(I2CM_Statistics_TypeDef* Statistics);
+void I2CM_ClearStatistics(void);
+#endif /* I2CM_USE_STATISTICS */
+
+#endif /* __STM8_EVAL_I2C_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -16,19 +16,31 @@
   *          by just adapting the defines for hardware resources and
   *          sEE_LowLevel_Init() function.
   *
-  *          @note In this driver, basic read and write functions (sEE_ReadBuffer()
-  *                and sEE_WritePage()) use the DMA to perform the data transfer
-  *                to/from EEPROM memory (except when number of requested data is
-  *                equal to 1). Thus, after calling these two functions, user
-  *                application may perform other tasks while DMA is transferring
-  *                data. The application should then monitor the variable holding
-  *                the number of data in order to determine when the transfer is
-  *                completed (variable decremented to 0). 
-  *                Stopping transfer tasks are performed into DMA interrupt 
-  *                handlers by the mean of sEE_I2C_DMA_TX_IRQHandler() and 
-  *                sEE_I2C_DMA_RX_IRQHandler() functions. These tow functions should 
-  *                be called in the stm8l15x_it.c file respectively in 
-  *                DMA1_CHANNEL2_3_IRQHandler and DMA1_CHANNEL0_1_IRQHandler.
+  *          @note The transfers are run by the interrupt driven I2C master
+  *                of stm8_eval_i2c.c: I2CM_IRQHandler() must be called in
+  *                the I2C interrupt routine (I2C1_SPI2_IRQHandler in the
+  *                stm8l15x_it.c file) and the interrupts must be enabled.
+  *                sEE_ReadBuffer() and sEE_WritePage() start the transfer and
+  *                return: meanwhile, the user application may perform other
+  *                tasks. The application should then monitor the variable
+  *                holding the number of data in order to determine when the
+  *                transfer is completed (variable reset to 0 at the end of the
+  *                transfer), and sEE_GetStatus() to know whether it succeeded.
+  *                A transfer not acknowledged by the EEPROM, disturbed by a
+  *                bus error or without progress ends with an error instead of
+  *                blocking the driver.
+  *
+  *          @note sEE_WriteBuffer() writes the pages back to back: the page
+  *                write itself polls the end of the internal write cycle of
+  *                the previous page (the EEPROM does not acknowledge its
+  *                address meanwhile), and the next page is prepared as soon
+  *                as the previous one is sent. There is no delay loop: the
+  *                bulk write time is the write cycle time plus the transfer
+  *                time of each page. sEE_StartWriteBuffer() starts the same
+  *                write and returns: the application then calls sEE_Tick()
+  *                periodically (every 1 ms for instance, from its main loop
+  *                on a timer flag) to poll the write cycles, and monitors
+  *                sEE_GetWriteState().
   *                For more details on the use of this driver you can refer to 
   *                the I2C_EEPROM example provided within the STM8L15x_StdPeriph_Lib 
   *                package.      
@@ -91,6 +103,13 @@
 /** @defgroup STM8_EVAL_I2C_EE_Private_Defines
   * @{
   */
+/**
+  * @brief  Steps of the sEE_StartWriteBuffer() writes
+  */
+#define sEE_WRITE_IDLE            ((uint8_t)0x00)
+#define sEE_WRITE_SEND            ((uint8_t)0x01)  /*!< Page (or last poll) being sent */
+#define sEE_WRITE_POLL            ((uint8_t)0x02)  /*!< Write cycle running: the page is
+                                                        sent again at the next sEE_Tick() */
 /**
   * @}
   */
@@ -108,10 +127,17 @@
   * @{
   */
 __IO uint16_t sEEAddress = 0;
-__IO uint32_t sEETimeout = sEE_TIMEOUT_MAX;
 __IO uint16_t* sEEDataReadPointer;
 __IO uint8_t* sEEDataWritePointer;
-__IO uint8_t sEEDataNum;
+
+static I2CM_Transfer_TypeDef sEETransfer;
+static uint8_t sEEStatus = I2CM_OK;  /* Status of the last read or write */
+
+static __IO uint8_t sEEWriteStep = sEE_WRITE_IDLE;
+static uint8_t* sEEWritePointer;     /* Data of the page being written */
+static uint16_t sEEWriteAddr = 0;    /* EEPROM address of the page being written */
+static uint16_t sEEWriteNb = 0;      /* Bytes from sEEWriteAddr to the end */
+static uint16_t sEEWriteTrials = 0;  /* Page writes not acknowledged */
 /**
   * @}
   */
@@ -120,6 +146,11 @@ __IO uint8_t sEEDataNum;
 /** @defgroup STM8_EVAL_I2C_EE_Private_Function_Prototypes
   * @{
   */
+static void sEE_ReadEnd(void);
+static void sEE_WriteEnd(void);
+static void sEE_WaitWriteEnd(void);
+static void sEE_PrepareWrite(void);
+static void sEE_WriteBufferEnd(void);
 /**
   * @}
   */
@@ -148,20 +179,16 @@ void sEE_Init(void)
 {
   sEE_LowLevel_Init();
 
-  /*!< I2C configuration */
-  /* sEE_I2C Peripheral Enable */
-  I2C_Cmd(sEE_I2C, ENABLE);
-  /* sEE_I2C configuration after enabling it */
-  I2C_Init(sEE_I2C, I2C_SPEED, I2C_SLAVE_ADDRESS7, I2C_Mode_I2C, I2C_DutyCycle_2,
-           I2C_Ack_Enable, I2C_AcknowledgedAddress_7bit);
-
-  /* Enable the sEE_I2C peripheral DMA requests */
-  I2C_DMACmd(sEE_I2C, ENABLE);
+  /*!< I2C configuration, shared with the LM75 driver */
+  I2CM_Init();
 
 #if defined (sEE_M24C64_32)
   /*!< Select the EEPROM address according to the state of E0, E1, E2 pins */
   sEEAddress = sEE_HW_ADDRESS;
 #endif /*!< sEE_M24C64_32 */
+
+  /*!< The EEPROM transfers give way to the LM75 ones on the shared bus */
+  sEETransfer.Priority = I2CM_PRIORITY_LOW;
 }
 
 /**
@@ -173,47 +200,20 @@ void sEE_Init(void)
   */
 void sEE_WriteByte(uint8_t* pBuffer, uint16_t WriteAddr)
 {
-  /*!< Send STRAT condition */
-  I2C_GenerateSTART(sEE_I2C, ENABLE);
-
-  /*!< Test on EV5 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_MODE_SELECT))
-  {}
-
-  /*!< Send EEPROM address for write */
-  I2C_Send7bitAddress(sEE_I2C, (uint8_t)sEEAddress, I2C_Direction_Transmitter);
-
-  /*!< Test on EV6 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED))
-  {}
-
-#ifdef sEE_M24C64_32
-
-  /*!< Send the EEPROM's internal address to write to : MSB of the address first */
-  I2C_SendData(sEE_I2C, (uint8_t)((WriteAddr & 0xFF00) >> 8));
-
-  /*!< Test on EV8 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /*!< Send the EEPROM's internal address to write to : LSB of the address */
-  I2C_SendData(sEE_I2C, (uint8_t)(WriteAddr & 0x00FF));
-
-#endif /*!< sEE_M24C64_32 */
-
-  /*!< Test on EV8 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /*!< Send the byte to be written */
-  I2C_SendData(sEE_I2C, *pBuffer);
-
-  /*!< Test on EV8 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /*!< Send STOP condition */
-  I2C_GenerateSTOP(sEE_I2C, ENABLE);
+  /*!< Wait the end of last communication */
+  sEE_WaitWriteEnd();
+  I2CM_Wait(&sEETransfer);
+
+  sEETransfer.Address = (uint8_t)sEEAddress;
+  sEETransfer.Register = WriteAddr;
+  sEETransfer.RegisterNb = sEE_ADDRESS_NB;
+  sEETransfer.pWriteBuffer = pBuffer;
+  sEETransfer.WriteNb = 1;
+  sEETransfer.ReadNb = 0;
+  sEETransfer.Callback = 0;
+
+  I2CM_Start(&sEETransfer);
+  I2CM_Wait(&sEETransfer);
 }
 
 /**
@@ -228,117 +228,39 @@ void sEE_WriteByte(uint8_t* pBuffer, uint16_t WriteAddr)
   *              data are read from the EEPROM. Application should monitor this
   *              variable in order know when the transfer is complete.
   *
-  * @note When number of data to be read is higher than 1, this function just
-  *       configure the communication and enable the DMA channel to transfer data.
+  * @note This function just starts the transfer, run by the I2C interrupt.
   *       Meanwhile, the user application may perform other tasks.
-  *       When number of data to be read is 1, then the DMA is not used.
   *
   * @retval None
   */
 void sEE_ReadBuffer(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t* NumByteToRead)
 {
-  __IO uint32_t timeout = 0xFFFF;
-
   /*!< Wait the end of last communication */
-  for (;timeout > 0; timeout--);
+  sEE_WaitWriteEnd();
+  I2CM_Wait(&sEETransfer);
 
   /* Set the pointer to the Number of data to be read. This pointer will be used
-      by the DMA Transfer Complete interrupt Handler in order to reset the 
-      variable to 0. User should check on this variable in order to know if the 
-      DMA transfer has been completed or not. */
+      by the end of transfer callback in order to reset the variable to 0. User
+      should check on this variable in order to know if the transfer has been
+      completed or not. */
   sEEDataReadPointer = NumByteToRead;
 
-  /*!< While the bus is busy */
-  while (I2C_GetFlagStatus(sEE_I2C, I2C_FLAG_BUSY))
-  {}
-
-  /*!< Send START condition */
-  I2C_GenerateSTART(sEE_I2C, ENABLE);
-
-  /*!< Test on EV5 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_MODE_SELECT))
-  {}
-
-  /*!< Send EEPROM address for write */
-  I2C_Send7bitAddress(sEE_I2C, (uint8_t)sEEAddress, I2C_Direction_Transmitter);
-
-  /*!< Test on EV6 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED))
-  {}
-
-#ifdef sEE_M24C64_32
-
-  /*!< Send the EEPROM's internal address to read from: MSB of the address first */
-  I2C_SendData(sEE_I2C, (uint8_t)((ReadAddr & 0xFF00) >> 8));
-
-  /*!< Test on EV8 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /*!< Send the EEPROM's internal address to read from: LSB of the address */
-  I2C_SendData(sEE_I2C, (uint8_t)(ReadAddr & 0x00FF));
-
-#endif /*!< sEE_M24C64_32 */
-
-  /*!< Test on EV8 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /*!< Send STRAT condition a second time */
-  I2C_GenerateSTART(sEE_I2C, ENABLE);
-
-  /*!< Test on EV5 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_MODE_SELECT))
-  {}
-
-  /*!< Send EEPROM address for read */
-  I2C_Send7bitAddress(sEE_I2C, (uint8_t)sEEAddress, I2C_Direction_Receiver);
-
-  /*!< Test on EV6 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))
-  {}
-
-  /* If number of data to be read is 1, then DMA couldn't be used */
-  if ((uint16_t)(*NumByteToRead) < 2)
-  {
-    /*!< Disable Acknowledgement */
-    I2C_AcknowledgeConfig(sEE_I2C, DISABLE);
-
-    /*!< Send STOP Condition */
-    I2C_GenerateSTOP(sEE_I2C, ENABLE);
-
-    /*!< Test on EV7 and clear it */
-    while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_RECEIVED))
-    {}
-
-    /*!< Read a byte from the EEPROM */
-    *pBuffer = I2C_ReceiveData(sEE_I2C);
-
-    /*!< Decrement the read bytes counter */
-    (uint16_t)(*NumByteToRead)--;
-
-    /*!< Enable Acknowledgement to be ready for another reception */
-    I2C_AcknowledgeConfig(sEE_I2C, ENABLE);
-  }
-  /* DMA could be used for number of data higher than 1 */
-  else
-  {
-    /* Configure the DMA Rx Channel with the buffer address and the buffer size */
-    sEE_LowLevel_DMAConfig((uint16_t)pBuffer, (uint8_t)(*NumByteToRead), sEE_DIRECTION_RX);
-
-    /* Inform the DMA that the next End Of Transfer Signal will be the last one */
-    I2C_DMALastTransferCmd(sEE_I2C, ENABLE);
-
-    /* Enable the DMA Rx Channel */
-    DMA_Cmd(sEE_I2C_DMA_CHANNEL_RX, ENABLE);
-
-    /* Global DMA Enable */
-    DMA_GlobalCmd(ENABLE);
-  }
+  /*!< Send the EEPROM's internal address to read from, then read the data
+       after a Re-START condition */
+  sEETransfer.Address = (uint8_t)sEEAddress;
+  sEETransfer.Register = ReadAddr;
+  sEETransfer.RegisterNb = sEE_ADDRESS_NB;
+  sEETransfer.WriteNb = 0;
+  sEETransfer.pReadBuffer = pBuffer;
+  sEETransfer.ReadNb = *NumByteToRead;
+  sEETransfer.Callback = sEE_ReadEnd;
+
+  I2CM_Start(&sEETransfer);
 }
 
 /**
   * @brief  Writes buffer of data to the I2C EEPROM.
+  * @note   Returns at the end of the write cycle of the last page.
   * @param  pBuffer : pointer to the buffer  containing the data to be written
   *         to the EEPROM.
   * @param  WriteAddr : EEPROM's internal address to write to.
@@ -347,151 +269,69 @@ void sEE_ReadBuffer(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t* NumByteToRead
   */
 void sEE_WriteBuffer(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite)
 {
-  uint8_t NumOfPage = 0, NumOfSingle = 0, count = 0;
-  uint16_t Addr = 0;
+  sEE_StartWriteBuffer(pBuffer, WriteAddr, NumByteToWrite);
 
-  Addr = WriteAddr % sEE_PAGESIZE;
-  count = (uint8_t)(sEE_PAGESIZE - (uint16_t)Addr);
-  NumOfPage =  (uint8_t)(NumByteToWrite / sEE_PAGESIZE);
-  NumOfSingle = (uint8_t)(NumByteToWrite % sEE_PAGESIZE);
+  /*!< Poll the write cycles until the end of the last one */
+  sEE_WaitWriteEnd();
+}
 
-  /*!< If WriteAddr is sEE_PAGESIZE aligned  */
-  if (Addr == 0)
-  {
-    /*!< If NumByteToWrite < sEE_PAGESIZE */
-    if (NumOfPage == 0)
-    {
-      /* Store the number of data to be written */
-      sEEDataNum = NumOfSingle;
-      /* Start writing data */
-      sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-      /* Wait transfer through DMA to be complete */
-      sEETimeout = sEE_TIMEOUT_MAX;
-      while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-      {}
-      sEE_WaitEepromStandbyState();
-    }
-    /*!< If NumByteToWrite > sEE_PAGESIZE */
-    else
-    {
-      while (NumOfPage--)
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = sEE_PAGESIZE;
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-        WriteAddr +=  sEE_PAGESIZE;
-        pBuffer += sEE_PAGESIZE;
-      }
-
-      if (NumOfSingle != 0)
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = NumOfSingle;
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-      }
-    }
-  }
-  /*!< If WriteAddr is not sEE_PAGESIZE aligned  */
-  else
+/**
+  * @brief  Starts writing a buffer of data to the I2C EEPROM, page by page.
+  * @note   The write goes on in the I2C interrupt and in sEE_Tick(), which
+  *         must be called periodically until sEE_GetWriteState() returns
+  *         sEE_STATE_READY. sEE_GetStatus() then tells whether it succeeded.
+  * @param  pBuffer : pointer to the buffer containing the data to be written
+  *         to the EEPROM, which must stay valid until the end of the write.
+  * @param  WriteAddr : EEPROM's internal address to write to.
+  * @param  NumByteToWrite : number of bytes to write to the EEPROM.
+  * @retval None
+  */
+void sEE_StartWriteBuffer(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite)
+{
+  /*!< Wait the end of last communication */
+  sEE_WaitWriteEnd();
+  I2CM_Wait(&sEETransfer);
+
+  sEEWritePointer = pBuffer;
+  sEEWriteAddr = WriteAddr;
+  sEEWriteNb = NumByteToWrite;
+  sEEWriteTrials = 0;
+  sEE_PrepareWrite();
+
+  /*!< The first page is not acknowledged if a write cycle is still running */
+  sEEWriteStep = sEE_WRITE_SEND;
+  I2CM_Start(&sEETransfer);
+}
+
+/**
+  * @brief  Polls the end of the write cycle of the sEE_StartWriteBuffer()
+  *         write: sends the next page, or the EEPROM address after the last
+  *         page, again.
+  * @note   This function should be called periodically, from the main loop,
+  *         while sEE_GetWriteState() returns sEE_STATE_BUSY.
+  * @param  None
+  * @retval None
+  */
+void sEE_Tick(void)
+{
+  if (sEEWriteStep == sEE_WRITE_POLL)
   {
-    /*!< If NumByteToWrite < sEE_PAGESIZE */
-    if (NumOfPage == 0)
-    {
-      /*!< If the number of data to be written is more than the remaining space
-      in the current page: */
-      if (NumByteToWrite > count)
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = count;
-        /*!< Write the data conained in same page */
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-
-        /* Store the number of data to be written */
-        sEEDataNum = (uint8_t)(NumByteToWrite - count);
-        /*!< Write the remaining data in the following page */
-        sEE_WritePage((uint8_t*)(pBuffer + count), (WriteAddr + count), (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-      }
-      else
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = NumOfSingle;
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-      }
-    }
-    /*!< If NumByteToWrite > sEE_PAGESIZE */
-    else
-    {
-      NumByteToWrite -= count;
-      NumOfPage = (uint8_t)(NumByteToWrite / sEE_PAGESIZE);
-      NumOfSingle = (uint8_t)(NumByteToWrite % sEE_PAGESIZE);
-
-      if (count != 0)
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = count;
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-        WriteAddr += count;
-        pBuffer += count;
-      }
-
-      while (NumOfPage--)
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = sEE_PAGESIZE;
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-        WriteAddr +=  sEE_PAGESIZE;
-        pBuffer += sEE_PAGESIZE;
-      }
-      if (NumOfSingle != 0)
-      {
-        /* Store the number of data to be written */
-        sEEDataNum = NumOfSingle;
-        sEE_WritePage(pBuffer, WriteAddr, (uint8_t*)(&sEEDataNum));
-        /* Wait transfer through DMA to be complete */
-        sEETimeout = sEE_TIMEOUT_MAX;
-        while ((sEEDataNum > 0) && (sEETimeout-- > 0))
-        {}
-        sEE_WaitEepromStandbyState();
-      }
-    }
+    sEEWriteStep = sEE_WRITE_SEND;
+    I2CM_Start(&sEETransfer);
   }
 }
 
+/**
+  * @brief  Returns the state of the sEE_StartWriteBuffer() write.
+  * @param  None
+  * @retval sEE_STATE_BUSY until the end of the write cycle of the last page,
+  *         then sEE_STATE_READY.
+  */
+uint8_t sEE_GetWriteState(void)
+{
+  return (uint8_t)((sEEWriteStep == sEE_WRITE_IDLE) ? sEE_STATE_READY : sEE_STATE_BUSY);
+}
+
 /**
   * @brief  Writes more than one byte to the EEPROM with a single WRITE cycle.
   * @note   The number of byte can't exceed the EEPROM page size.
@@ -505,195 +345,184 @@ void sEE_WriteBuffer(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWri
   *              data are read from the EEPROM. Application should monitor this
   *              variable in order know when the transfer is complete.
   *
-  * @note When number of data to be written is higher than 1, this function just
-  *       configure the communication and enable the DMA channel to transfer data.
+  * @note This function just starts the transfer, run by the I2C interrupt.
   *       Meanwhile, the user application may perform other tasks.
-  *       When number of data to be written is 1, then the DMA is not used.
   *
   * @retval None
   */
 void sEE_WritePage(uint8_t* pBuffer, uint16_t WriteAddr, uint8_t* NumByteToWrite)
 {
-  __IO uint32_t timeout = 0xFFFF;
-
   /*!< Wait the end of last communication */
-  for (;timeout > 0; timeout--);
+  sEE_WaitWriteEnd();
+  I2CM_Wait(&sEETransfer);
 
   /* Set the pointer to the Number of data to be written. This pointer will be used
-      by the DMA Transfer Completer interrupt Handler in order to reset the 
-      variable to 0. User should check on this variable in order to know if the 
-      DMA transfer has been complete or not. */
+      by the end of transfer callback in order to reset the variable to 0. User
+      should check on this variable in order to know if the transfer has been
+      complete or not. */
   sEEDataWritePointer = NumByteToWrite;
 
-  /*!< While the bus is busy */
-  while (I2C_GetFlagStatus(sEE_I2C, I2C_FLAG_BUSY))
-  {}
-
-  /*!< Send START condition */
-  I2C_GenerateSTART(sEE_I2C, ENABLE);
-
-  /*!< Test on EV5 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_MODE_SELECT))
-  {}
-
-  /*!< Send EEPROM address for write */
-  I2C_Send7bitAddress(sEE_I2C, (uint8_t)sEEAddress, I2C_Direction_Transmitter);
-
-  /*!< Test on EV6 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED))
-  {}
-
-#ifdef sEE_M24C64_32
-
-  /*!< Send the EEPROM's internal address to write to : MSB of the address first */
-  I2C_SendData(sEE_I2C, (uint8_t)((WriteAddr & 0xFF00) >> 8));
+  sEETransfer.Address = (uint8_t)sEEAddress;
+  sEETransfer.Register = WriteAddr;
+  sEETransfer.RegisterNb = sEE_ADDRESS_NB;
+  sEETransfer.pWriteBuffer = pBuffer;
+  sEETransfer.WriteNb = *NumByteToWrite;
+  sEETransfer.ReadNb = 0;
+  sEETransfer.Callback = sEE_WriteEnd;
 
-  /*!< Test on EV8 and clear it */
-  while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /*!< Send the EEPROM's internal address to write to : LSB of the address */
-  I2C_SendData(sEE_I2C, (uint8_t)(WriteAddr & 0x00FF));
-
-#endif /*!< sEE_M24C64_32 */
-
-  /*!< Test on EV8 and clear it */
-  while (! I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-  {}
-
-  /* If number of data to be written is 1, then DMA couldn't be used */
-  if ((uint16_t)(*NumByteToWrite) < 2)
-  {
-    /*!< Send the byte to be written */
-    I2C_SendData(sEE_I2C, *pBuffer);
-
-    /*!< Test on EV8 and clear it */
-    while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-    {}
-
-    /*!< Send STOP condition */
-    I2C_GenerateSTOP(sEE_I2C, ENABLE);
-
-    (uint8_t)(*NumByteToWrite)--;
-  }
-  /* DMA could be used for number of data higher than 1 */
-  else
-  {
-    /* Configure the DMA Tx Channel with the buffer address and the buffer size */
-    sEE_LowLevel_DMAConfig((uint16_t)pBuffer, (uint8_t)(*NumByteToWrite), sEE_DIRECTION_TX);
-
-    /* Enable the DMA Tx Channel */
-    DMA_Cmd(sEE_I2C_DMA_CHANNEL_TX, ENABLE);
-
-    /* Global DMA Enable */
-    DMA_GlobalCmd(ENABLE);
-  }
+  I2CM_Start(&sEETransfer);
 }
 
 /**
   * @brief  Wait for EEPROM Standby state
+  * @note   The EEPROM does not acknowledge its address until the end of its
+  *         internal write cycle: the address is sent again up to
+  *         sEE_MAX_TRIALS_NUMBER times.
   * @param  None
   * @retval None
   */
 void sEE_WaitEepromStandbyState(void)
 {
-  __IO uint8_t tempreg = 0;
-  __IO uint32_t timeout = 0xFFFF;
-
-  do
-  {
-    /*!< Send START condition */
-    I2C_GenerateSTART(sEE_I2C, ENABLE);
-
-    /* Test on EEPROM_I2C EV5 and clear it */
-    while (!I2C_GetFlagStatus(sEE_I2C, I2C_FLAG_SB))  /* EV5 */
-    {
-    }
-
-    /*!< Send EEPROM address for write */
-    I2C_Send7bitAddress(sEE_I2C, (uint8_t)sEEAddress, I2C_Direction_Transmitter);
+  uint16_t trials = sEE_MAX_TRIALS_NUMBER;
 
-    /*!< Wait for address aknowledgement */
-    for (;timeout > 0; timeout--);
+  /*!< Wait the end of last communication */
+  sEE_WaitWriteEnd();
+  I2CM_Wait(&sEETransfer);
 
-    /*!< Read sEE SR1 register to clear pending flags */
-    tempreg = I2C_ReadRegister(sEE_I2C, I2C_Register_SR1);
+  /*!< Send EEPROM address for write, without data */
+  sEETransfer.Address = (uint8_t)sEEAddress;
+  sEETransfer.RegisterNb = 0;
+  sEETransfer.WriteNb = 0;
+  sEETransfer.ReadNb = 0;
+  sEETransfer.Callback = 0;
 
+  do
+  {
+    I2CM_Start(&sEETransfer);
   }
-  while (!(tempreg & 0x02));
-
-  /*!< Clear AF flag */
-  I2C_ClearFlag(sEE_I2C, I2C_FLAG_AF);
+  while ((I2CM_Wait(&sEETransfer) == I2CM_ERROR_NACK) && (--trials != 0));
+}
 
-  /*!< STOP condition */
-  I2C_GenerateSTOP(sEE_I2C, ENABLE);
+/**
+  * @brief  Returns the status of the last sEE_ReadBuffer() or sEE_WritePage()
+  *         transfer ended.
+  * @param  None
+  * @retval The transfer status:
+  *         - I2CM_OK: transfer done
+  *         - I2CM_ERROR_NACK: EEPROM not acknowledging (busy or absent)
+  *         - I2CM_ERROR_BUS: bus error, arbitration lost or overrun
+  *         - I2CM_ERROR_TIMEOUT: transfer aborted
+  */
+uint8_t sEE_GetStatus(void)
+{
+  return sEEStatus;
 }
 
 /**
-  * @}
+  * @brief  Ends a sEE_ReadBuffer() transfer, from the I2C interrupt.
+  * @param  None
+  * @retval None
   */
+static void sEE_ReadEnd(void)
+{
+  sEEStatus = sEETransfer.Status;
 
+  /* Reset the variable holding the number of data to be read */
+  *sEEDataReadPointer = 0;
+}
 
 /**
-  * @brief  This function handles the DMA Tx Channel interrupt Handler.
-  *     @note This function should be called in the
-  *       DMA1_CHANNEL2_3_IRQHandler in the stm8l15x_it.c file.
-  *
-  *       // INTERRUPT_HANDLER(DMA1_CHANNEL2_3_IRQHandler, 3)
-  *       // {
-  *           // sEE_I2C_DMA_TX_IRQHandler();
-  *       // }
+  * @brief  Ends a sEE_WritePage() transfer, from the I2C interrupt.
   * @param  None
   * @retval None
   */
-void sEE_I2C_DMA_TX_IRQHandler(void)
+static void sEE_WriteEnd(void)
 {
-  /* Check if the DMA transfer is complete */
-  if (DMA_GetFlagStatus(sEE_I2C_DMA_FLAG_TX_TC) != RESET)
-  {
-    /* Disable the DMA Tx Channel and Clear all its Flags */
-    DMA_Cmd(sEE_I2C_DMA_CHANNEL_TX, DISABLE);
-    DMA_ClearFlag(sEE_I2C_DMA_FLAG_TX_TC);
+  sEEStatus = sEETransfer.Status;
 
-    /*!< Wait till all data have been physically transferred on the bus */
-    while (!I2C_CheckEvent(sEE_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))
-    {}
-
-    /*!< Send STOP condition */
-    I2C_GenerateSTOP(sEE_I2C, ENABLE);
+  /* Reset the variable holding the number of data to be written */
+  *sEEDataWritePointer = 0;
+}
 
-    /* Reset the variable holding the number of data to be written */
-    *sEEDataWritePointer = 0;
+/**
+  * @brief  Waits for the end of the sEE_StartWriteBuffer() write, polling its
+  *         write cycles.
+  * @param  None
+  * @retval None
+  */
+static void sEE_WaitWriteEnd(void)
+{
+  while (sEEWriteStep != sEE_WRITE_IDLE)
+  {
+    /*!< Wait the end of the page (aborted on timeout), then send it again
+         if it was not acknowledged */
+    I2CM_Wait(&sEETransfer);
+    sEE_Tick();
   }
 }
 
 /**
-  * @brief  This function handles the DMA Rx Channel interrupt Handler.
-  *     @note This function should be called in the
-  *       DMA1_CHANNEL0_1_IRQHandler in the stm8l15x_it.c file
-  *       just as follow.
-  *
-  *       // INTERRUPT_HANDLER(DMA1_CHANNEL0_1_IRQHandler, 2)
-  *       // {
-  *           // sEE_I2C_DMA_RX_IRQHandler();
-  *       // }
+  * @brief  Prepares the transfer of the next page of the
+  *         sEE_StartWriteBuffer() write, or of the EEPROM address alone after
+  *         the last page to poll the end of its write cycle.
   * @param  None
   * @retval None
   */
-void sEE_I2C_DMA_RX_IRQHandler(void)
+static void sEE_PrepareWrite(void)
 {
-  /* Check if the DMA transfer is complete */
-  if (DMA_GetFlagStatus(sEE_I2C_DMA_FLAG_RX_TC) != RESET)
+  uint16_t count = (uint16_t)(sEE_PAGESIZE - (sEEWriteAddr % sEE_PAGESIZE));
+
+  if (count > sEEWriteNb)
   {
-    /*!< Send STOP Condition */
-    I2C_GenerateSTOP(sEE_I2C, ENABLE);
+    count = sEEWriteNb;
+  }
 
-    /* Disable the DMA Rx Channel and Clear all its Flags */
-    DMA_Cmd(sEE_I2C_DMA_CHANNEL_RX, DISABLE);
-    DMA_ClearFlag(sEE_I2C_DMA_FLAG_RX_TC);
+  sEETransfer.Address = (uint8_t)sEEAddress;
+  sEETransfer.Register = sEEWriteAddr;
+  sEETransfer.RegisterNb = (uint8_t)((count != 0) ? sEE_ADDRESS_NB : 0);
+  sEETransfer.pWriteBuffer = sEEWritePointer;
+  sEETransfer.WriteNb = count;
+  sEETransfer.ReadNb = 0;
+  sEETransfer.Callback = sEE_WriteBufferEnd;
+}
 
-    /* Reset the variable holding the number of data to be read */
-    *sEEDataReadPointer = 0;
+/**
+  * @brief  Ends a page transfer of the sEE_StartWriteBuffer() write, from the
+  *         I2C interrupt.
+  * @param  None
+  * @retval None
+  */
+static void sEE_WriteBufferEnd(void)
+{
+  if (sEETransfer.Status == I2CM_OK)
+  {
+    if (sEETransfer.RegisterNb == 0)
+    {
+      /*!< Address acknowledged: the write cycle of the last page has ended */
+      sEEStatus = I2CM_OK;
+      sEEWriteStep = sEE_WRITE_IDLE;
+    }
+    else
+    {
+      /*!< Page sent: prepare the next one during its write cycle */
+      sEEWritePointer += sEETransfer.WriteNb;
+      sEEWriteAddr += sEETransfer.WriteNb;
+      sEEWriteNb -= sEETransfer.WriteNb;
+      sEEWriteTrials = 0;
+      sEE_PrepareWrite();
+      sEEWriteStep = sEE_WRITE_POLL;
+    }
+  }
+  else if ((sEETransfer.Status == I2CM_ERROR_NACK)
+           && (++sEEWriteTrials < sEE_MAX_TRIALS_NUMBER))
+  {
+    /*!< Write cycle of the previous page running */
+    sEEWriteStep = sEE_WRITE_POLL;
+  }
+  else
+  {
+    sEEStatus = sEETransfer.Status;
+    sEEWriteStep = sEE_WRITE_IDLE;
   }
 }
 
@@ -701,6 +530,10 @@ void sEE_I2C_DMA_RX_IRQHandler(void)
   * @}
   */
 
+/**
+  * @}
+  */
+
 
 /**
   * @}
@@ -25,6 +25,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm8_eval.h"
+#include "stm8_eval_i2c.h"
 
 /** @addtogroup Utilities
   * @{
@@ -64,23 +65,21 @@
   Harware connection on the board (on STM810C-EVAL board E0 = E1 = E2 = 0) */
 
  #define sEE_HW_ADDRESS     0xA0   /* E0 = E1 = E2 = 0 */ 
+ #define sEE_ADDRESS_NB     2      /* Bytes of the memory address */
 #endif /* sEE_M24C64_32 */
 
-#define I2C_SPEED              200000
-#define I2C_SLAVE_ADDRESS7     0xA0
-
 #if defined (sEE_M24C64_32)
  #define sEE_PAGESIZE    32
 #endif
  
-/* Defintions for the state of the DMA transfer */   
+/* Defintions for the state of the write returned by sEE_GetWriteState() */   
 #define sEE_STATE_READY         0
 #define sEE_STATE_BUSY          1
    
-/* Maximum timeout value for counting before exiting waiting loop on DMA 
-   Trasnfer Complete. This value depends directly on the maximum page size and
-   the sytem clock frequency. */
-#define sEE_TIMEOUT_MAX         0x10000
+/* Maximum number of trials for sEE_WaitEepromStandbyState() function, and of
+   each page of sEE_WriteBuffer(): the EEPROM address is sent every trial (or
+   every sEE_Tick() call) until acknowledged */
+#define sEE_MAX_TRIALS_NUMBER   300
 /**
   * @}
   */ 
@@ -100,10 +99,12 @@ void sEE_Init(void);
 void sEE_WriteByte(uint8_t* pBuffer, uint16_t WriteAddr);
 void sEE_WritePage(uint8_t* pBuffer, uint16_t WriteAddr, uint8_t* NumByteToWrite);
 void sEE_WriteBuffer(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite);
+void sEE_StartWriteBuffer(uint8_t* pBuffer, uint16_t WriteAddr, uint16_t NumByteToWrite);
+void sEE_Tick(void);
+uint8_t sEE_GetWriteState(void);
 void sEE_ReadBuffer(uint8_t* pBuffer, uint16_t ReadAddr, uint16_t* NumByteToRead);
 void sEE_WaitEepromStandbyState(void);
-void sEE_I2C_DMA_RX_IRQHandler(void);
-void sEE_I2C_DMA_TX_IRQHandler(void);
+uint8_t sEE_GetStatus(void);
 #endif /* __STM8_EVAL_I2C_EE_H */
 /**
   * @}
@@ -16,6 +16,14 @@
   *          by just adapting the defines for hardware resources and
   *          LM75_LowLevel_Init() function.
   *
+  *          @note The transfers are run by the interrupt driven I2C master
+  *                of stm8_eval_i2c.c: I2CM_IRQHandler() must be called in
+  *                the I2C interrupt routine (I2C1_SPI2_IRQHandler in the
+  *                stm8l15x_it.c file) and the interrupts must be enabled. The
+  *                functions wait for the end of their transfer, which ends
+  *                with an error instead of blocking them if the LM75 does not
+  *                answer.
+  *
   *     +-----------------------------------------------------------------+
   *     |                        Pin assignment                           |
   *     +---------------------------------------+-----------+-------------+
@@ -91,6 +99,7 @@
 /** @defgroup STM8_EVAL_I2C_TSENSOR_Private_Variables
   * @{
   */
+static I2CM_Transfer_TypeDef LM75Transfer;
 /**
   * @}
   */
@@ -98,6 +107,8 @@
 /** @defgroup STM8_EVAL_I2C_TSENSOR_Private_Function_Prototypes
   * @{
   */
+static uint8_t LM75_Transfer(uint8_t RegName, uint8_t* pWriteBuffer, uint8_t WriteNb,
+                             uint8_t* pReadBuffer, uint8_t ReadNb);
 /**
   * @}
   */
@@ -126,18 +137,11 @@ void LM75_Init(void)
 
   LM75_LowLevel_Init();
 
-  /* I2C DeInit */
-  I2C_DeInit(LM75_I2C);
-
-  /* I2C configuration */
-  I2C_Init(LM75_I2C, LM75_I2C_SPEED, 0x00, I2C_Mode_SMBusHost,
-           I2C_DutyCycle_2, I2C_Ack_Enable, I2C_AcknowledgedAddress_7bit);
-
-  /*!< Enable SMBus Alert interrupt */
-  I2C_ITConfig(LM75_I2C, I2C_IT_ERR, ENABLE);
+  /*!< I2C configuration, shared with the EEPROM driver */
+  I2CM_Init();
 
-  /*!< LM75_I2C Init */
-  I2C_Cmd(LM75_I2C, ENABLE);
+  /*!< The temperature reads overtake the EEPROM transfers queued */
+  LM75Transfer.Priority = I2CM_PRIORITY_HIGH;
 }
 
 /**
@@ -147,39 +151,16 @@ void LM75_Init(void)
   */
 ErrorStatus LM75_GetStatus(void)
 {
-  uint32_t I2C_TimeOut = I2C_TIMEOUT;
-
-  /* Clear the LM75_I2C AF flag */
-  I2C_ClearFlag(LM75_I2C, I2C_FLAG_AF);
-
-  /* Enable LM75_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(LM75_I2C, ENABLE);
-
-  /*---------------------------- Transmission Phase ---------------------------*/
-
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while ((!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT)) && I2C_TimeOut)  /* EV5 */
-  {
-    I2C_TimeOut--;
-  }
-  if (I2C_TimeOut == 0)
-  {
-    return ERROR;
-  }
-  I2C_TimeOut = I2C_TIMEOUT;
-
-  /*!< Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
+  /*!< Send STLM75 slave address for write, without data */
+  LM75Transfer.Address = LM75_ADDR;
+  LM75Transfer.RegisterNb = 0;
+  LM75Transfer.WriteNb = 0;
+  LM75Transfer.ReadNb = 0;
+  LM75Transfer.Callback = 0;
 
-  while ((!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) && I2C_TimeOut)/* EV6 */
-  {
-    I2C_TimeOut--;
-  }
+  I2CM_Start(&LM75Transfer);
 
-  if ((I2C_GetFlagStatus(LM75_I2C, I2C_FLAG_AF) != 0x00) || (I2C_TimeOut == 0))
+  if (I2CM_Wait(&LM75Transfer) != I2CM_OK)
   {
     return ERROR;
   }
@@ -199,76 +180,13 @@ ErrorStatus LM75_GetStatus(void)
   */
 uint16_t LM75_ReadReg(uint8_t RegName)
 {
-  __IO uint16_t RegValue = 0;
-
-  /* Enable LM75_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(LM75_I2C, ENABLE);
-
-  /*--------------------------- Transmission Phase ----------------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the specified register data pointer */
-  I2C_SendData(LM75_I2C, RegName);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /*------------------------------ Reception Phase ----------------------------*/
-  /* Send Re-STRAT condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for read */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Receiver);
-
-  /* Test on EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))  /* EV6 */
-  {
-  }
-
-  /* Test on EV7 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_RECEIVED))  /* EV7 */
-  {
-  }
-
-  /* Store LM75_I2C received data */
-  RegValue = (uint16_t)(I2C_ReceiveData(LM75_I2C) << 8);
-
-  /* Disable LM75_I2C acknowledgement */
-  I2C_AcknowledgeConfig(LM75_I2C, DISABLE);
-
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
-
-  /* Test on RXNE flag */
-  while (I2C_GetFlagStatus(LM75_I2C, I2C_FLAG_RXNE) == RESET)
-  {}
+  uint8_t buffer[2] = {0, 0};
 
-  /* Store LM75_I2C received data */
-  RegValue |= I2C_ReceiveData(LM75_I2C);
+  /* Read the register, MSB first */
+  LM75_Transfer(RegName, 0, 0, buffer, 2);
 
   /* Return register value */
-  return (RegValue);
+  return (uint16_t)(((uint16_t)buffer[0] << 8) | buffer[1]);
 }
 
 /**
@@ -282,49 +200,13 @@ uint16_t LM75_ReadReg(uint8_t RegName)
   */
 void LM75_WriteReg(uint8_t RegName, uint16_t RegValue)
 {
-  /*-------------------------------- Transmission Phase -----------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the specified register data pointer */
-  I2C_SendData(LM75_I2C, RegName);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send LM75_I2C data */
-  I2C_SendData(LM75_I2C, (uint8_t)(RegValue >> 8));
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
+  uint8_t buffer[2];
 
-  /* Send LM75_I2C data */
-  I2C_SendData(LM75_I2C, (uint8_t)RegValue);
+  /* Write the register, MSB first */
+  buffer[0] = (uint8_t)(RegValue >> 8);
+  buffer[1] = (uint8_t)RegValue;
 
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
+  LM75_Transfer(RegName, buffer, 2, 0, 0);
 }
 
 /**
@@ -334,76 +216,8 @@ void LM75_WriteReg(uint8_t RegName, uint16_t RegValue)
   */
 uint16_t LM75_ReadTemp(void)
 {
-  __IO uint16_t RegValue = 0;
-
-  /* Enable LM75_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(LM75_I2C, ENABLE);
-
-  /*------------------------------------- Transmission Phase ------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the temperature register data pointer */
-  I2C_SendData(LM75_I2C, LM75_REG_TEMP);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /*-------------------------------- Reception Phase --------------------------*/
-  /* Send Re-STRAT condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for read */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Receiver);
-
-  /* Test on EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))  /* EV6 */
-  {
-  }
-
-  /* Test on EV7 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_RECEIVED))  /* EV7 */
-  {
-  }
-
-  /* Store LM75_I2C received data */
-  RegValue = I2C_ReceiveData(LM75_I2C) << 8;
-
-  /* Disable LM75_I2C acknowledgement */
-  I2C_AcknowledgeConfig(LM75_I2C, DISABLE);
-
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
-
-  /* Test on RXNE flag */
-  while (I2C_GetFlagStatus(LM75_I2C, I2C_FLAG_RXNE) == RESET)
-  {}
-
-  /* Store LM75_I2C received data */
-  RegValue |= I2C_ReceiveData(LM75_I2C);
-
   /* Return Temperature value */
-  return (RegValue >> 7);
+  return (uint16_t)(LM75_ReadReg(LM75_REG_TEMP) >> 7);
 }
 
 /**
@@ -413,63 +227,9 @@ uint16_t LM75_ReadTemp(void)
   */
 uint8_t LM75_ReadConfReg(void)
 {
-  __IO uint8_t RegValue = 0;
-
-  /* Enable LM75_I2C acknowledgement if it is already disabled by other function */
-  I2C_AcknowledgeConfig(LM75_I2C, ENABLE);
-  /*----------------------------- Transmission Phase --------------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the configuration register data pointer */
-  I2C_SendData(LM75_I2C, LM75_REG_CONF);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /*----------------------------- Reception Phase -----------------------------*/
-  /* Send Re-STRAT condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for read */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Receiver);
+  uint8_t RegValue = 0;
 
-  /* Test on EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))  /* EV6 */
-  {
-  }
-
-  /* Disable LM75_I2C acknowledgement */
-  I2C_AcknowledgeConfig(LM75_I2C, DISABLE);
-
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
-
-  /* Test on RXNE flag */
-  while (I2C_GetFlagStatus(LM75_I2C, I2C_FLAG_RXNE) == RESET);
-
-  /* Store LM75_I2C received data */
-  RegValue = I2C_ReceiveData(LM75_I2C);
+  LM75_Transfer(LM75_REG_CONF, 0, 0, &RegValue, 1);
 
   /* Return configuration register value */
   return (RegValue);
@@ -483,41 +243,7 @@ uint8_t LM75_ReadConfReg(void)
   */
 void LM75_WriteConfReg(uint8_t RegValue)
 {
-  /*-------------------------------- Transmission Phase -----------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the configuration register data pointer */
-  I2C_SendData(LM75_I2C, LM75_REG_CONF);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send LM75_I2C data */
-  I2C_SendData(LM75_I2C, RegValue);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
-
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
+  LM75_Transfer(LM75_REG_CONF, &RegValue, 1, 0, 0);
 }
 
 /**
@@ -528,113 +254,53 @@ void LM75_WriteConfReg(uint8_t RegValue)
   */
 void LM75_ShutDown(FunctionalState NewState)
 {
-  __IO uint8_t RegValue = 0;
+  uint8_t RegValue = 0;
 
-  /*---------------------------- Transmission Phase ---------------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the configuration register data pointer */
-  I2C_SendData(LM75_I2C, LM75_REG_CONF);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED))  /* EV8 */
-  {
-  }
-
-  /*-------------------------------- Reception Phase --------------------------*/
-  /* Send Re-STRAT condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for read */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Receiver);
-
-  /* Test on EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED))  /* EV6 */
-  {
-  }
-
-  /* Disable LM75_I2C acknowledgement */
-  I2C_AcknowledgeConfig(LM75_I2C, DISABLE);
-
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
-
-  /* Test on RXNE flag */
-  while (I2C_GetFlagStatus(LM75_I2C, I2C_FLAG_RXNE) == RESET);
-
-  /* Store LM75_I2C received data */
-  RegValue = I2C_ReceiveData(LM75_I2C);
-
-  /*------------------------------------ Transmission Phase -------------------*/
-  /* Send LM75_I2C START condition */
-  I2C_GenerateSTART(LM75_I2C, ENABLE);
-
-  /* Test on LM75_I2C EV5 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_MODE_SELECT))  /* EV5 */
-  {
-  }
-
-  /* Send STLM75 slave address for write */
-  I2C_Send7bitAddress(LM75_I2C, LM75_ADDR, I2C_Direction_Transmitter);
-
-  /* Test on LM75_I2C EV6 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED)) /* EV6 */
-  {
-  }
-
-  /* Send the configuration register data pointer */
-  I2C_SendData(LM75_I2C, LM75_REG_CONF);
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
-  }
+  RegValue = LM75_ReadConfReg();
 
   /* Enable or disable SD bit */
   if (NewState != DISABLE)
   {
     /* Enable LM75 */
-    I2C_SendData(LM75_I2C, (uint8_t)(RegValue & LM75_SD_RESET));
+    LM75_WriteConfReg((uint8_t)(RegValue & LM75_SD_RESET));
   }
   else
   {
     /* Disable LM75 */
-    I2C_SendData(LM75_I2C, (uint8_t)(RegValue | LM75_SD_SET));
-  }
-
-  /* Test on LM75_I2C EV8 and clear it */
-  while (!I2C_CheckEvent(LM75_I2C, I2C_EVENT_MASTER_BYTE_TRANSMITTED)) /* EV8 */
-  {
+    LM75_WriteConfReg((uint8_t)(RegValue | LM75_SD_SET));
   }
+}
 
-  /* Send LM75_I2C STOP Condition */
-  I2C_GenerateSTOP(LM75_I2C, ENABLE);
-
+/**
+  * @brief  Writes or reads a register of the LM75 and waits for the end of
+  *         the transfer.
+  * @param  RegName: register pointer sent first.
+  * @param  pWriteBuffer: pointer to the bytes written to the register.
+  * @param  WriteNb: number of bytes to write.
+  * @param  pReadBuffer: pointer to the buffer receiving the bytes read.
+  * @param  ReadNb: number of bytes to read.
+  * @retval The transfer status (I2CM_OK when done).
+  */
+static uint8_t LM75_Transfer(uint8_t RegName, uint8_t* pWriteBuffer, uint8_t WriteNb,
+                             uint8_t* pReadBuffer, uint8_t ReadNb)
+{
+  LM75Transfer.Address = LM75_ADDR;
+  LM75Transfer.Register = RegName;
+  LM75Transfer.RegisterNb = 1;
+  LM75Transfer.pWriteBuffer = pWriteBuffer;
+  LM75Transfer.WriteNb = WriteNb;
+  LM75Transfer.pReadBuffer = pReadBuffer;
+  LM75Transfer.ReadNb = ReadNb;
+  LM75Transfer.Callback = 0;
+
+  I2CM_Start(&LM75Transfer);
+
+  return I2CM_Wait(&LM75Transfer);
 }
 /**
   * @}
   */
 
-
 /**
   * @}
   */
@@ -25,6 +25,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm8_eval.h"
+#include "stm8_eval_i2c.h"
 
 
 /** @addtogroup Utilities
@@ -63,7 +64,6 @@
 #define LM75_REG_TOS         0x03  /* Over-temp Shutdown threshold Register of LM75 */
 #define I2C_TIMEOUT         (uint32_t)0x3FFFF /*!< I2C Time out */
 #define LM75_ADDR           0x90   /*!< LM75 address */
-#define LM75_I2C_SPEED      100000 /*!< I2C Speed */
 
 /**
   * @}
@@ -33,6 +33,18 @@
 /** @defgroup STM8_EVAL_LCD_Private_Types
   * @{
   */
+/**
+  * @brief  State of the scroll of one LCD line
+  */
+typedef struct
+{
+  uint8_t  Text[LCD_SCROLL_MAX_LENGTH]; /*!< Scrolled text, blank padded */
+  uint8_t  Length;    /*!< Text length, 0 when the scroll is stopped */
+  uint8_t  Offset;    /*!< Index of the text character at the line start */
+  uint8_t  Speed;     /*!< Number of ticks per scroll step */
+  uint8_t  Tick;      /*!< Ticks left before the next scroll step */
+  uint16_t nScroll;   /*!< Remaining scrolls, 0 to scroll until stopped */
+} LCD_Scroll_TypeDef;
 /**
   * @}
   */
@@ -105,6 +117,30 @@ __CONST uint8_t T_CGRAM[] =
 /** @defgroup STM8_EVAL_LCD_Private_Variables
   * @{
   */
+/* Characters the application wants on the LCD */
+static uint8_t LCD_ShadowBuffer[LCD_SHADOW_LINE_NB][LCD_SHADOW_LINE_CHAR];
+/* One bit per DDRAM address (characters pair) not yet sent to the LCD */
+static uint8_t LCD_ShadowDirty[LCD_SHADOW_LINE_NB];
+/* Non zero while the application updates the shadow buffer: LCD_ScrollTick()
+   called from interrupt then postpones its scroll step */
+static __IO uint8_t LCD_ShadowLock = 0;
+
+/* Scroll state of each line */
+static LCD_Scroll_TypeDef LCD_Scroll[LCD_SHADOW_LINE_NB];
+static void (*LCD_ScrollCallback)(uint8_t Line) = 0;
+
+#ifdef USE_LCD_ASYNC
+/* LCD bytes waiting for transmission: Synchro/Mode byte and data */
+static uint8_t LCD_AsyncQueue[LCD_ASYNC_QUEUE_SIZE][2];
+/* Queue read index, the LCD byte being sent is not released before its end */
+static __IO uint8_t LCD_AsyncHead = 0;
+/* Queue write index */
+static __IO uint8_t LCD_AsyncTail = 0;
+/* Next SPI byte of the LCD byte being sent (1 to 3), 0 when the queue is idle */
+static __IO uint8_t LCD_AsyncSPIByte = 0;
+static void (*LCD_AsyncCallback)(void) = 0;
+static LCD_AsyncStats_TypeDef LCD_AsyncStats;
+#endif /* USE_LCD_ASYNC */
 /**
   * @}
   */
@@ -115,6 +151,13 @@ __CONST uint8_t T_CGRAM[] =
 static void LCD_SPISendByte(uint8_t DataToSend);
 static void LCD_DisplayCGRAM0(uint8_t address, uint8_t *ptrTable);
 static void LCD_DisplayCGRAM1(uint8_t address, uint8_t *ptrTable);
+static void LCD_ShadowReset(void);
+static void LCD_ShadowSend(uint8_t Room);
+static void LCD_ScrollDisplay(uint8_t line);
+#ifdef USE_LCD_ASYNC
+static void LCD_AsyncStart(void);
+static uint8_t LCD_AsyncGetFree(void);
+#endif /* USE_LCD_ASYNC */
 
 /**
   * @brief  The delay function implemented in this driver is not a precise one,
@@ -165,6 +208,16 @@ void STM8_EVAL_LCD_Init(void)
   /* Configure LCD ChipSelect pin (NCS) in Output push-pull mode */
   GPIO_Init(LCD_NCS_GPIO_PORT, LCD_NCS_PIN, GPIO_Mode_Out_PP_Low_Fast);
 
+#ifdef USE_LCD_ASYNC
+  /* Configure LCD_TIM in one pulse mode to time the LCD processing delays */
+  CLK_PeripheralClockConfig(LCD_TIM_CLK, ENABLE);
+  LCD_TIM->PSCR = LCD_TIM_PRESCALER;
+  LCD_TIM->ARR = LCD_ASYNC_DELAY;
+  LCD_TIM->CR1 = (uint8_t)(TIM4_CR1_OPM | TIM4_CR1_URS);
+  /* Load the prescaler value, the update flag is not set as URS is set */
+  LCD_TIM->EGR = TIM4_EGR_UG;
+  LCD_TIM->IER = TIM4_IER_UIE;
+#endif /* USE_LCD_ASYNC */
 
   /* Set the LCD in TEXT mode */
   LCD_SendByte(COMMAND_TYPE, SET_TEXT_MODE);
@@ -175,11 +228,16 @@ void STM8_EVAL_LCD_Init(void)
   /* Clear the LCD */
   LCD_SendByte(COMMAND_TYPE, DISPLAY_CLR);
 
+#ifndef USE_LCD_ASYNC
   /* Delay required to complete LCD clear command */
   _delay_(0x4000); /* 1ms _delay_ using Fcpu = 16Mhz*/
+#endif /* USE_LCD_ASYNC */
 
   /* Select the entry mode type */
   LCD_SendByte(COMMAND_TYPE, ENTRY_MODE_SET_INC);
+
+  /* The LCD is blank: synchronize the shadow buffer with it */
+  LCD_ShadowReset();
 }
 
 /**
@@ -201,6 +259,31 @@ void LCD_SetCursorPos(uint8_t Line, uint8_t Offset)
   */
 void LCD_SendByte(uint8_t DataType, uint8_t DataToSend)
 {
+#ifdef USE_LCD_ASYNC
+  uint8_t tail = LCD_AsyncTail;
+  uint8_t next = (uint8_t)((uint8_t)(tail + 1) & (uint8_t)(LCD_ASYNC_QUEUE_SIZE - 1));
+
+  while (next == LCD_AsyncHead)
+  {
+    /* Wait while the queue is full */
+  }
+
+  LCD_AsyncQueue[tail][0] = DataType;
+  LCD_AsyncQueue[tail][1] = DataToSend;
+
+  /* LCD_TIM interrupt ends the queue processing when the queue is empty:
+     mask it while the byte is added and the queue state checked */
+  LCD_TIM->IER = 0;
+  LCD_AsyncTail = next;
+  if (LCD_AsyncSPIByte == 0)
+  {
+    /* Queue idle: a new LCD update starts */
+    LCD_AsyncStats.Bytes = 0;
+    LCD_AsyncStats.Ticks = 0;
+    LCD_AsyncStart();
+  }
+  LCD_TIM->IER = TIM4_IER_UIE;
+#else
   /* Enable access to LCD */
   LCD_NCS_HIGH();
 
@@ -216,6 +299,7 @@ void LCD_SendByte(uint8_t DataType, uint8_t DataToSend)
 
   /* Disable access to LCD */
   LCD_NCS_LOW();
+#endif /* USE_LCD_ASYNC */
 }
 
 /**
@@ -227,9 +311,13 @@ void LCD_Clear(void)
 {
   LCD_SendByte(COMMAND_TYPE, DISPLAY_CLR); /* Clear the LCD */
 
+#ifndef USE_LCD_ASYNC
   /* Delay required to complete LCD clear command */
   _delay_(0x4000); /* 1ms _delay_ using Fcpu = 16Mhz*/
+#endif /* USE_LCD_ASYNC */
 
+  /* The LCD is blank: synchronize the shadow buffer with it */
+  LCD_ShadowReset();
 }
 
 /**
@@ -314,6 +402,360 @@ void LCD_DisplayLogo(uint8_t address)
   LCD_DisplayCGRAM1(address, (uint8_t*)T_CGRAM);
 }
 
+/**
+  * @brief  Clear the shadow buffer.
+  * @note   Only the characters which were not already blank are sent to the
+  *         LCD on the next call of LCD_ShadowFlush().
+  * @param  None
+  * @retval None
+  */
+void LCD_ShadowClear(void)
+{
+  uint8_t line = 0, column = 0;
+
+  LCD_ShadowLock++;
+  for (line = 0; line < LCD_SHADOW_LINE_NB; line++)
+  {
+    for (column = 0; column < LCD_SHADOW_LINE_CHAR; column++)
+    {
+      LCD_ShadowWriteChar((uint8_t)(LCD_LINE1 + (uint8_t)(line << 4)), column, ' ');
+    }
+  }
+  LCD_ShadowLock--;
+}
+
+/**
+  * @brief  Write a character in the shadow buffer.
+  * @note   The LCD is not accessed, LCD_ShadowFlush() must be called to
+  *         display the modified characters.
+  * @param  Line : line of the character (LCD_LINE1 or LCD_LINE2)
+  * @param  Column : position of the character in the line (0 to 15)
+  * @param  Ascii : character to write
+  * @retval None
+  */
+void LCD_ShadowWriteChar(uint8_t Line, uint8_t Column, uint8_t Ascii)
+{
+  uint8_t line = (uint8_t)((uint8_t)(Line - LCD_LINE1) >> 4);
+
+  if ((line < LCD_SHADOW_LINE_NB) && (Column < LCD_SHADOW_LINE_CHAR))
+  {
+    LCD_ShadowLock++;
+    if (LCD_ShadowBuffer[line][Column] != Ascii)
+    {
+      LCD_ShadowBuffer[line][Column] = Ascii;
+      LCD_ShadowDirty[line] |= (uint8_t)((uint8_t)1 << (uint8_t)(Column >> 1));
+    }
+    LCD_ShadowLock--;
+  }
+}
+
+/**
+  * @brief  Write a string in the shadow buffer.
+  * @note   The string is truncated at the end of the line.
+  * @param  Line : line of the string (LCD_LINE1 or LCD_LINE2)
+  * @param  Column : position of the first character in the line (0 to 15)
+  * @param  ptr : Pointer to the string to write
+  * @retval None
+  */
+void LCD_ShadowPrint(uint8_t Line, uint8_t Column, uint8_t *ptr)
+{
+  LCD_ShadowLock++;
+  while ((Column < LCD_SHADOW_LINE_CHAR) && (*ptr))
+  {
+    LCD_ShadowWriteChar(Line, Column, *ptr++);
+    Column++;
+  }
+  LCD_ShadowLock--;
+}
+
+/**
+  * @brief  Send to the LCD the characters modified in the shadow buffer.
+  * @note   The LCD DDRAM stores 2 characters per address: a modified character
+  *         is sent with its neighbour of the same pair. A single cursor
+  *         positioning command is sent per run of contiguous modified pairs.
+  * @param  None
+  * @retval None
+  */
+void LCD_ShadowFlush(void)
+{
+  LCD_ShadowLock++;
+  LCD_ShadowSend((uint8_t)0xFF);
+  LCD_ShadowLock--;
+}
+
+/**
+  * @brief  Start scrolling a text on a line without blocking the CPU: the text
+  *         is shifted by one character to the left every Speed calls of
+  *         LCD_ScrollTick() and restarts from its first character once it has
+  *         entirely scrolled out of the line.
+  * @note   The text is copied (at most LCD_SCROLL_MAX_LENGTH - 1 characters)
+  *         and is followed by blanks so that it leaves the line before it
+  *         restarts.
+  * @param  Line : line used for displaying the text (LCD_LINE1 or LCD_LINE2)
+  * @param  ptr : Pointer to the text to display
+  * @param  Speed : Number of LCD_ScrollTick() calls per scroll step (>= 1),
+  *         LCD_SCROLL_SPEED_FAST, LCD_SCROLL_SPEED_MEDIUM, LCD_SCROLL_SPEED_SLOW
+  *         or any other value.
+  * @param  nScroll : Number of times the text is scrolled, 0 to scroll it until
+  *         LCD_ScrollStop() is called.
+  * @retval None
+  */
+void LCD_ScrollStart(uint8_t Line, uint8_t *ptr, uint8_t Speed, uint16_t nScroll)
+{
+  uint8_t line = (uint8_t)((uint8_t)(Line - LCD_LINE1) >> 4);
+  LCD_Scroll_TypeDef *scroll;
+  uint8_t length = 0;
+
+  if (line < LCD_SHADOW_LINE_NB)
+  {
+    scroll = &LCD_Scroll[line];
+
+    LCD_ShadowLock++;
+
+    /* Stop the current scroll while the text buffer is updated */
+    scroll->Length = 0;
+
+    while ((*ptr) && (length < (uint8_t)(LCD_SCROLL_MAX_LENGTH - 1)))
+    {
+      scroll->Text[length++] = *ptr++;
+    }
+
+    /* Blank padding: at least one separator and the whole line */
+    do
+    {
+      scroll->Text[length++] = ' ';
+    }
+    while ((length < LCD_SHADOW_LINE_CHAR) && (length < LCD_SCROLL_MAX_LENGTH));
+
+    scroll->Offset = 0;
+    scroll->Speed = (Speed != 0) ? Speed : (uint8_t)1;
+    scroll->Tick = scroll->Speed;
+    scroll->nScroll = nScroll;
+    scroll->Length = length;
+
+    LCD_ScrollDisplay(line);
+    LCD_ShadowFlush();
+
+    LCD_ShadowLock--;
+  }
+}
+
+/**
+  * @brief  Stop the scroll of a line, the text is left as currently displayed.
+  * @param  Line : scrolled line (LCD_LINE1 or LCD_LINE2)
+  * @retval None
+  */
+void LCD_ScrollStop(uint8_t Line)
+{
+  uint8_t line = (uint8_t)((uint8_t)(Line - LCD_LINE1) >> 4);
+
+  if (line < LCD_SHADOW_LINE_NB)
+  {
+    LCD_Scroll[line].Length = 0;
+  }
+}
+
+/**
+  * @brief  Check whether a line is scrolling.
+  * @param  Line : line to check (LCD_LINE1 or LCD_LINE2)
+  * @retval SET while the line is scrolling, RESET otherwise
+  */
+FlagStatus LCD_ScrollGetStatus(uint8_t Line)
+{
+  uint8_t line = (uint8_t)((uint8_t)(Line - LCD_LINE1) >> 4);
+  FlagStatus status = RESET;
+
+  if ((line < LCD_SHADOW_LINE_NB) && (LCD_Scroll[line].Length != 0))
+  {
+    status = SET;
+  }
+  return status;
+}
+
+/**
+  * @brief  Set the function called by LCD_ScrollTick() when a line has been
+  *         scrolled nScroll times.
+  * @param  Callback : function to call with the line (LCD_LINE1 or LCD_LINE2),
+  *         0 for none
+  * @retval None
+  */
+void LCD_ScrollSetCallback(void (*Callback)(uint8_t Line))
+{
+  LCD_ScrollCallback = Callback;
+}
+
+/**
+  * @brief  Scroll time base: to be called periodically, from the main loop or
+  *         from a timer interrupt routine. Only the characters changed by the
+  *         scroll steps are sent to the LCD.
+  * @note   When called from an interrupt routine USE_LCD_ASYNC mode must be
+  *         used: the LCD bytes are then queued without waiting for room in the
+  *         queue, the characters which do not fit are sent on the next calls.
+  *         The scroll step is postponed while the application is in a shadow
+  *         buffer or scroll function, the other LCD functions must not be
+  *         used while lines are scrolled from interrupt.
+  * @param  None
+  * @retval None
+  */
+void LCD_ScrollTick(void)
+{
+  uint8_t line = 0, room = 0xFF;
+  LCD_Scroll_TypeDef *scroll;
+
+  if (LCD_ShadowLock != 0)
+  {
+    /* Interrupted shadow buffer update: try again on the next call */
+    return;
+  }
+
+  for (line = 0; line < LCD_SHADOW_LINE_NB; line++)
+  {
+    scroll = &LCD_Scroll[line];
+
+    if ((scroll->Length != 0) && (--scroll->Tick == 0))
+    {
+      scroll->Tick = scroll->Speed;
+
+      if (++scroll->Offset == scroll->Length)
+      {
+        /* Text scrolled once: back to its first character */
+        scroll->Offset = 0;
+
+        if ((scroll->nScroll != 0) && (--scroll->nScroll == 0))
+        {
+          LCD_ScrollDisplay(line);
+          scroll->Length = 0;
+
+          if (LCD_ScrollCallback != 0)
+          {
+            LCD_ScrollCallback((uint8_t)(LCD_LINE1 + (uint8_t)(line << 4)));
+          }
+          continue;
+        }
+      }
+      LCD_ScrollDisplay(line);
+    }
+  }
+
+#ifdef USE_LCD_ASYNC
+  room = LCD_AsyncGetFree();
+#endif /* USE_LCD_ASYNC */
+  LCD_ShadowSend(room);
+}
+
+#ifdef USE_LCD_ASYNC
+/**
+  * @brief  Set the function called from interrupt when the transmit queue
+  *         becomes empty.
+  * @param  Callback : function to call, 0 for none
+  * @retval None
+  */
+void LCD_AsyncSetCallback(void (*Callback)(void))
+{
+  LCD_AsyncCallback = Callback;
+}
+
+/**
+  * @brief  Check whether LCD bytes are waiting for transmission.
+  * @param  None
+  * @retval SET while the transmit queue is processed, RESET otherwise
+  */
+FlagStatus LCD_AsyncGetBusyStatus(void)
+{
+  return ((LCD_AsyncSPIByte != 0) ? SET : RESET);
+}
+
+/**
+  * @brief  Get the statistics of the current or last LCD update.
+  * @param  Stats : pointer to the structure to fill
+  * @retval None
+  */
+void LCD_AsyncGetStats(LCD_AsyncStats_TypeDef *Stats)
+{
+  LCD_TIM->IER = 0;
+  *Stats = LCD_AsyncStats;
+  LCD_TIM->IER = TIM4_IER_UIE;
+}
+
+/**
+  * @brief  LCD_SPI interrupt handler: sends the SPI bytes of the LCD byte in
+  *         progress then starts LCD_TIM for the LCD processing delay.
+  * @param  None
+  * @retval None
+  */
+void LCD_SPI_IRQHandler(void)
+{
+  uint8_t *pbyte = LCD_AsyncQueue[LCD_AsyncHead];
+  uint8_t gap = LCD_ASYNC_DELAY;
+
+  if (((LCD_SPI->CR3 & SPI_CR3_TXIE) != 0) && ((LCD_SPI->SR & SPI_SR_TXE) != 0))
+  {
+    if (LCD_AsyncSPIByte == 1)
+    {
+      /* Send byte high nibble */
+      LCD_SPI->DR = (uint8_t)(pbyte[1] & (uint8_t)0xF0);
+      LCD_AsyncSPIByte = 2;
+    }
+    else if (LCD_AsyncSPIByte == 2)
+    {
+      /* Send byte low nibble */
+      LCD_SPI->DR = (uint8_t)((uint8_t)(pbyte[1] << 4) & (uint8_t)0xF0);
+      LCD_AsyncSPIByte = 3;
+    }
+    else
+    {
+      /* Low nibble is being shifted out: time the LCD processing delay */
+      LCD_SPI->CR3 &= (uint8_t)(~SPI_CR3_TXIE);
+
+      if ((pbyte[0] == COMMAND_TYPE) && (pbyte[1] == DISPLAY_CLR))
+      {
+        gap = LCD_ASYNC_CLR_DELAY;
+      }
+      LCD_TIM->ARR = gap;
+      LCD_TIM->CNTR = 0;
+      LCD_TIM->CR1 |= TIM4_CR1_CEN;
+
+      LCD_AsyncStats.Bytes++;
+      LCD_AsyncStats.Ticks += (uint16_t)((uint16_t)gap + 1);
+    }
+  }
+}
+
+/**
+  * @brief  LCD_TIM interrupt handler: ends the LCD byte in progress and starts
+  *         the next one, or calls the user callback when the queue is empty.
+  * @param  None
+  * @retval None
+  */
+void LCD_TIM_IRQHandler(void)
+{
+  if ((LCD_TIM->SR1 & TIM4_SR1_UIF) != 0)
+  {
+    LCD_TIM->SR1 = (uint8_t)(~TIM4_SR1_UIF);
+
+    /* Disable access to LCD */
+    LCD_NCS_LOW();
+
+    /* Release the LCD byte sent */
+    LCD_AsyncHead = (uint8_t)((uint8_t)(LCD_AsyncHead + 1) & (uint8_t)(LCD_ASYNC_QUEUE_SIZE - 1));
+
+    if (LCD_AsyncHead != LCD_AsyncTail)
+    {
+      LCD_AsyncStart();
+    }
+    else
+    {
+      LCD_AsyncSPIByte = 0;
+
+      if (LCD_AsyncCallback != 0)
+      {
+        LCD_AsyncCallback();
+      }
+    }
+  }
+}
+#endif /* USE_LCD_ASYNC */
+
 /**
   * @}
   */
@@ -393,6 +835,128 @@ static void LCD_DisplayCGRAM1(uint8_t address, uint8_t *ptrTable)
 
 }
 
+/**
+  * @brief  Write in the shadow buffer the characters of a scrolled line.
+  * @param  line : line index (0 or 1)
+  * @retval None
+  */
+static void LCD_ScrollDisplay(uint8_t line)
+{
+  LCD_Scroll_TypeDef *scroll = &LCD_Scroll[line];
+  uint8_t column = 0, index = scroll->Offset;
+
+  for (column = 0; column < LCD_SHADOW_LINE_CHAR; column++)
+  {
+    LCD_ShadowWriteChar((uint8_t)(LCD_LINE1 + (uint8_t)(line << 4)), column,
+                        scroll->Text[index]);
+    if (++index == scroll->Length)
+    {
+      index = 0;
+    }
+  }
+}
+
+#ifdef USE_LCD_ASYNC
+/**
+  * @brief  Start the transmission of the LCD byte at the head of the queue.
+  * @param  None
+  * @retval None
+  */
+static void LCD_AsyncStart(void)
+{
+  LCD_AsyncSPIByte = 1;
+
+  /* Enable access to LCD */
+  LCD_NCS_HIGH();
+
+  /* Send Synchro/Mode byte, the next ones are sent from LCD_SPI interrupt */
+  LCD_SPI->DR = LCD_AsyncQueue[LCD_AsyncHead][0];
+  LCD_SPI->CR3 |= SPI_CR3_TXIE;
+}
+
+/**
+  * @brief  Get the number of LCD bytes the transmit queue can take.
+  * @param  None
+  * @retval Number of free queue entries
+  */
+static uint8_t LCD_AsyncGetFree(void)
+{
+  return (uint8_t)((uint8_t)(LCD_AsyncHead - LCD_AsyncTail - 1) & (uint8_t)(LCD_ASYNC_QUEUE_SIZE - 1));
+}
+#endif /* USE_LCD_ASYNC */
+
+/**
+  * @brief  Fill the shadow buffer with blank characters and mark it as
+  *         displayed, in line with a cleared LCD.
+  * @param  None
+  * @retval None
+  */
+static void LCD_ShadowReset(void)
+{
+  uint8_t line = 0, column = 0;
+
+  for (line = 0; line < LCD_SHADOW_LINE_NB; line++)
+  {
+    for (column = 0; column < LCD_SHADOW_LINE_CHAR; column++)
+    {
+      LCD_ShadowBuffer[line][column] = ' ';
+    }
+    LCD_ShadowDirty[line] = 0;
+  }
+}
+
+/**
+  * @brief  Send to the LCD the characters modified in the shadow buffer.
+  * @note   The LCD DDRAM stores 2 characters per address: a modified character
+  *         is sent with its neighbour of the same pair. A single cursor
+  *         positioning command is sent per run of contiguous modified pairs.
+  * @param  Room : maximum number of LCD bytes to send, 0xFF for all
+  * @retval None
+  */
+static void LCD_ShadowSend(uint8_t Room)
+{
+  uint8_t line = 0, pair = 0;
+  uint8_t *pchar;
+
+  for (line = 0; line < LCD_SHADOW_LINE_NB; line++)
+  {
+    pair = 0;
+
+    while (LCD_ShadowDirty[line] != 0)
+    {
+      if ((LCD_ShadowDirty[line] & (uint8_t)((uint8_t)1 << pair)) == 0)
+      {
+        pair++;
+      }
+      else if (Room < 3)
+      {
+        /* No room for a cursor positioning and a pair: the dirty pairs
+           are left for the next call */
+        return;
+      }
+      else
+      {
+        /* Set cursor position at the beginning of the run */
+        LCD_SetCursorPos((uint8_t)(LCD_LINE1 + (uint8_t)(line << 4)), pair);
+        Room--;
+
+        /* The cursor auto-increments: send the whole run */
+        do
+        {
+          pchar = &LCD_ShadowBuffer[line][(uint8_t)(pair << 1)];
+          LCD_SendByte(DATA_TYPE, pchar[0]);
+          LCD_SendByte(DATA_TYPE, pchar[1]);
+          LCD_ShadowDirty[line] &= (uint8_t)~(uint8_t)((uint8_t)1 << pair);
+          Room -= 2;
+          pair++;
+        }
+        while ((pair < (uint8_t)(LCD_SHADOW_LINE_CHAR >> 1)) && (Room >= 2)
+               && ((LCD_ShadowDirty[line] & (uint8_t)((uint8_t)1 << pair)) != 0));
+      }
+    }
+  }
+}
+
 #ifndef USE_Delay
 /**
   * @brief  Inserts a delay time.
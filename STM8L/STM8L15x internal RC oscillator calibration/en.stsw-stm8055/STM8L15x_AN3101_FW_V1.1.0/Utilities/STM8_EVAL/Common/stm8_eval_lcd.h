@@ -57,6 +57,17 @@
   #define _delay_     delay      /* !< Default _delay_ function with less precise timing */
 #endif 	
 
+/*
+ * Uncomment the line below to drive the LCD through an interrupt driven
+ * transmit queue: LCD_SendByte() (and all the functions using it) only queues
+ * the byte and returns, LCD_SPI TXE interrupt sends it and LCD_TIM update
+ * interrupt times the LCD processing delay in place of the _delay_ loops.
+ * LCD_SPI_IRQHandler() and LCD_TIM_IRQHandler() must then be called from the
+ * LCD_SPI and LCD_TIM interrupt routines and interrupts must be enabled.
+ */
+
+/* #define USE_LCD_ASYNC */
+
 
 
 #ifdef USE_STM8L1526_EVAL
@@ -102,11 +113,38 @@
 #endif  /* USE_STM8L1526_EVAL */
 
 
+/**
+  * @brief  Timer used to time the LCD processing delays in USE_LCD_ASYNC mode
+  */
+#define LCD_TIM                          TIM4
+#define LCD_TIM_CLK                      CLK_Peripheral_TIM4
+#define LCD_TIM_PRESCALER                ((uint8_t)0x07) /* Fcpu/128: 8us tick with Fcpu = 16Mhz */
+
+/* Transmit queue size (power of 2) in LCD bytes and LCD processing delays
+   in LCD_TIM ticks, used in USE_LCD_ASYNC mode. The queue holds one entry
+   less than its size and must take a full LCD_ShadowFlush(): 2 lines of one
+   cursor positioning and 16 characters, 34 LCD bytes */
+#define LCD_ASYNC_QUEUE_SIZE ((uint8_t)64)
+#define LCD_ASYNC_DELAY      ((uint8_t)10)  /* 80us: LCD instruction execution time */
+#define LCD_ASYNC_CLR_DELAY  ((uint8_t)200) /* 1.6ms: LCD clear execution time */
+
 /* LCD managed as 2 Lines of 15 characters (2Lines * 15Char) */
 #define LCD_LINE_MAX_CHAR    ((uint8_t)15)
 #define LCD_LINE1            ((uint8_t)0x80)
 #define LCD_LINE2            ((uint8_t)0x90)
 
+/* Shadow frame buffer managed as 2 Lines of 16 characters; the LCD DDRAM
+   holds 2 characters per address so the buffer is flushed per characters pair */
+#define LCD_SHADOW_LINE_NB   ((uint8_t)2)
+#define LCD_SHADOW_LINE_CHAR ((uint8_t)16)
+
+/* Non blocking scroll: text buffer size per line and scroll speeds, expressed
+   in number of LCD_ScrollTick() calls per scroll step */
+#define LCD_SCROLL_MAX_LENGTH ((uint8_t)32)
+#define LCD_SCROLL_SPEED_FAST   ((uint8_t)1)
+#define LCD_SCROLL_SPEED_MEDIUM ((uint8_t)4)
+#define LCD_SCROLL_SPEED_SLOW   ((uint8_t)10)
+
 /* LCD Commands */
 #define COMMAND_TYPE         ((uint8_t)0xF8)
 #define DATA_TYPE            ((uint8_t)0xFA)
@@ -119,6 +157,25 @@
 #define ENTRY_MODE_SET_INC   ((uint8_t)0x06)
 
 
+/** @defgroup STM8_EVAL_LCD_Exported_Types
+  * @{
+  */
+
+/**
+  * @brief  Statistics of the last LCD update in USE_LCD_ASYNC mode. The blocking
+  *         driver keeps the CPU busy during the whole update, so Ticks gives the
+  *         CPU time saved, less one interrupt of each source per LCD byte.
+  */
+typedef struct
+{
+  uint16_t Bytes; /*!< LCD bytes (3 SPI bytes each) sent since the queue was empty */
+  uint16_t Ticks; /*!< Duration of the update in LCD_TIM ticks */
+} LCD_AsyncStats_TypeDef;
+
+/**
+  * @}
+  */
+
 /** @defgroup STM8_EVAL_LCD_Exported_Macros
   * @{
   */
@@ -143,6 +200,22 @@ void LCD_Clear(void);
 void LCD_Print(uint8_t *ptr);
 void LCD_DisplayLogo(uint8_t address);
 void LCD_RollString(uint8_t Line, uint8_t *ptr, uint16_t speed);
+void LCD_ShadowClear(void);
+void LCD_ShadowWriteChar(uint8_t Line, uint8_t Column, uint8_t Ascii);
+void LCD_ShadowPrint(uint8_t Line, uint8_t Column, uint8_t *ptr);
+void LCD_ShadowFlush(void);
+void LCD_ScrollStart(uint8_t Line, uint8_t *ptr, uint8_t Speed, uint16_t nScroll);
+void LCD_ScrollStop(uint8_t Line);
+FlagStatus LCD_ScrollGetStatus(uint8_t Line);
+void LCD_ScrollSetCallback(void (*Callback)(uint8_t Line));
+void LCD_ScrollTick(void);
+#ifdef USE_LCD_ASYNC
+void LCD_AsyncSetCallback(void (*Callback)(void));
+FlagStatus LCD_AsyncGetBusyStatus(void);
+void LCD_AsyncGetStats(LCD_AsyncStats_TypeDef *Stats);
+void LCD_SPI_IRQHandler(void);
+void LCD_TIM_IRQHandler(void);
+#endif /* USE_LCD_ASYNC */
 
 #endif /* __STM8_EVAL_LCD_H */
 
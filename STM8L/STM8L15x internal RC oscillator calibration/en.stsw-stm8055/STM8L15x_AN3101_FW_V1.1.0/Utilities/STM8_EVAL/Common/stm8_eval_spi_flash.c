@@ -16,6 +16,63 @@
   *          by just adapting the defines for hardware resources and
   *          sFLASH_LowLevel_Init() function.
   *
+  *          @note Sequential reads of large areas should use the stream
+  *                functions: sFLASH_StreamStart() selects the FLASH once with
+  *                the FAST_READ instruction at the highest SPI clock, then
+  *                each sFLASH_StreamGetChunk() returns the next
+  *                sFLASH_STREAM_CHUNK_SIZE bytes without sending again an
+  *                instruction and an address. When sFLASH_USE_DMA is defined
+  *                the next chunk is read by the DMA while the application
+  *                uses the current one.
+  *
+  *          @note sFLASH_QueueWriteBuffer(), sFLASH_QueueEraseSector() and
+  *                sFLASH_QueueEraseBulk() queue a write or erase operation
+  *                and return at once, the queue starting it if the FLASH is
+  *                idle. sFLASH_QueueTick() should then be called periodically
+  *                (from a timer interrupt routine for instance): it reads the
+  *                FLASH status register once and, when the FLASH is ready,
+  *                goes on with the next page of the write or the next queued
+  *                operation. The operation callback gets its latency, in
+  *                sFLASH_QueueTick() periods from its queuing to its end.
+  *                The other FLASH functions must not be called while
+  *                sFLASH_QueueGetPending() is not 0.
+  *
+  *          @note When sFLASH_USE_PAGE_CACHE is defined, sFLASH_WriteBuffer()
+  *                only copies the data into a RAM cache of
+  *                sFLASH_CACHE_PAGE_NB pages, so that small sequential or
+  *                unaligned writes to the same page end in a single Page
+  *                WRITE sequence. A cached page is written when it is full,
+  *                when a write to another page needs its place, on
+  *                sFLASH_CacheFlush() or once sFLASH_CacheTick() has been
+  *                called sFLASH_CACHE_TIMEOUT times without write to it.
+  *                The read and erase functions write the cached pages they
+  *                depend on first. The data written by sFLASH_WriteBuffer()
+  *                is only kept by the FLASH once written: sFLASH_CacheFlush()
+  *                should be called before a power down.
+  *
+  *          @note When sFLASH_USE_STATISTICS is defined, the driver counts the
+  *                read, write and erase sequences, the bytes transferred and
+  *                the status register reads finding the FLASH busy. Read by
+  *                sFLASH_GetStatistics() before and after a workload, they
+  *                give its number of FLASH operations and the time spent
+  *                waiting for the FLASH, to compare the driver options.
+  *
+  *          @note When sFLASH_USE_DMA is defined in stm8xx_eval.h, the data of
+  *                sFLASH_ReadBuffer() and sFLASH_WritePage() are transferred
+  *                by the DMA (except when number of requested data is equal
+  *                to 1), the CPU waiting for the end of the transfer.
+  *                sFLASH_ReadBufferDMA() and sFLASH_WritePageDMA() return once
+  *                the transfer is started: the application may then perform
+  *                other tasks while the DMA is transferring data and is
+  *                notified of the end of the transfer by a callback, or by
+  *                monitoring sFLASH_GetState().
+  *                Ending transfer tasks are performed into DMA interrupt
+  *                handlers by the mean of sFLASH_SPI_DMA_RX_IRQHandler() and
+  *                sFLASH_SPI_DMA_TX_IRQHandler() functions. These two
+  *                functions should be called in the stm8l15x_it.c file in the
+  *                interrupt handlers of the sFLASH_SPI_DMA_CHANNEL_RX and
+  *                sFLASH_SPI_DMA_CHANNEL_TX channels.
+  *
   *          +-----------------------------------------------------------+
   *          |                     Pin assignment                        |
   *          +-----------------------------+---------------+-------------+
@@ -66,6 +123,36 @@
 /** @defgroup STM8_EVAL_SPI_FLASH_Private_Types
   * @{
   */
+/**
+  * @brief  Write or erase operation of the queue
+  */
+typedef struct
+{
+  uint8_t Instruction;                /*!< sFLASH_CMD_WRITE, sFLASH_CMD_SE or
+                                           sFLASH_CMD_BE */
+  uint8_t* pBuffer;                   /*!< Data still to write */
+  uint32_t Addr;                      /*!< FLASH's internal address */
+  uint16_t NumByte;                   /*!< Number of bytes still to write */
+  uint16_t Time;                      /*!< Queue time at the queuing */
+  void (*Callback)(uint16_t Latency); /*!< Called at the end, 0 for none */
+}sFLASH_Operation_TypeDef;
+
+#ifdef sFLASH_USE_PAGE_CACHE
+/**
+  * @brief  FLASH page of the write cache
+  */
+typedef struct
+{
+  uint32_t Page;                      /*!< FLASH's internal address of the page */
+  uint8_t First;                      /*!< Offset of the first byte written */
+  uint8_t Last;                       /*!< Offset of the last byte written */
+  uint16_t Age;                       /*!< sFLASH_CacheTick() calls since the
+                                           last write */
+  FlagStatus Dirty;                   /*!< SET while data is not yet written
+                                           to the FLASH, RESET for a free page */
+  uint8_t Data[sFLASH_SPI_PAGESIZE];  /*!< Page data, 0xFF where not written */
+}sFLASH_CachePage_TypeDef;
+#endif /* sFLASH_USE_PAGE_CACHE */
 /**
   * @}
   */
@@ -74,6 +161,15 @@
 /** @defgroup STM8_EVAL_SPI_FLASH_Private_Defines
   * @{
   */
+/* SPI clock of the instructions and of the stream (FAST_READ): the highest
+   STM8 SPI clock, fSYSCLK / 2, is below the 50 MHz FAST_READ limit */
+#define sFLASH_SPI_PRESCALER        SPI_BaudRatePrescaler_4
+#define sFLASH_SPI_STREAM_PRESCALER SPI_BaudRatePrescaler_2
+
+#ifdef sFLASH_USE_DMA
+/* Largest DMA transfer, longer ones are split */
+#define sFLASH_DMA_MAX_SIZE       ((uint16_t)0xFF)
+#endif /* sFLASH_USE_DMA */
 /**
   * @}
   */
@@ -81,6 +177,14 @@
 /** @defgroup STM8_EVAL_SPI_FLASH_Private_Macros
   * @{
   */
+/**
+  * @brief  Adds a value to a counter of the FLASH operations
+  */
+#ifdef sFLASH_USE_STATISTICS
+#define sFLASH_STATISTICS_ADD(Counter, Value)  (sFLASHStatistics.Counter += (Value))
+#else
+#define sFLASH_STATISTICS_ADD(Counter, Value)
+#endif /* sFLASH_USE_STATISTICS */
 /**
   * @}
   */
@@ -89,6 +193,37 @@
 /** @defgroup STM8_EVAL_SPI_FLASH_Private_Variables
   * @{
   */
+#ifdef sFLASH_USE_DMA
+static __IO uint8_t sFLASHState = sFLASH_STATE_READY;
+static uint8_t* sFLASHDataPointer;          /* Buffer of the next DMA transfer */
+static uint16_t sFLASHDataNum = 0;          /* Bytes after the current one */
+static uint8_t sFLASHDataDirection = sFLASH_DIRECTION_RX;
+static FunctionalState sFLASHDataIT = DISABLE; /* Ended by the interrupts */
+static void (*sFLASHCallback)(void) = 0;
+static FlagStatus sFLASHDataHold = RESET;   /* FLASH kept selected at the end */
+#endif /* sFLASH_USE_DMA */
+
+/* Write and erase queue: operations are added at sFLASHQueueTail by the
+   application and removed from sFLASHQueueHead by sFLASH_QueueTick() */
+static sFLASH_Operation_TypeDef sFLASHQueue[sFLASH_QUEUE_SIZE];
+static __IO uint8_t sFLASHQueueHead = 0;
+static __IO uint8_t sFLASHQueueTail = 0;
+static __IO FlagStatus sFLASHQueueBusy = RESET; /* Operation in progress */
+static __IO uint16_t sFLASHQueueTime = 0;       /* sFLASH_QueueTick() calls */
+
+/* Stream chunks, the one of sFLASHStreamIndex being returned next */
+static uint8_t sFLASHStreamBuffer[2][sFLASH_STREAM_CHUNK_SIZE];
+static uint8_t sFLASHStreamIndex = 0;
+
+#ifdef sFLASH_USE_PAGE_CACHE
+/* Write cache, sFLASHCacheLast being the page written last */
+static sFLASH_CachePage_TypeDef sFLASHCache[sFLASH_CACHE_PAGE_NB];
+static uint8_t sFLASHCacheLast = 0;
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+#ifdef sFLASH_USE_STATISTICS
+static sFLASH_Statistics_TypeDef sFLASHStatistics;
+#endif /* sFLASH_USE_STATISTICS */
 /**
   * @}
   */
@@ -97,6 +232,27 @@
 /** @defgroup STM8_EVAL_SPI_FLASH_Private_Function_Prototypes
   * @{
   */
+static void sFLASH_StartErase(uint8_t Instruction, uint32_t SectorAddr);
+static void sFLASH_StartWritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
+static void sFLASH_SPIConfig(SPI_BaudRatePrescaler_TypeDef SPI_BaudRatePrescaler);
+static uint8_t sFLASH_ReadStatus(void);
+static ErrorStatus sFLASH_QueueAdd(uint8_t Instruction, uint8_t* pBuffer, uint32_t Addr,
+                                   uint16_t NumByte, void (*Callback)(uint16_t Latency));
+static void sFLASH_QueueIssue(sFLASH_Operation_TypeDef* Operation);
+#ifdef sFLASH_USE_PAGE_CACHE
+static void sFLASH_CacheWrite(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite);
+static void sFLASH_CacheFlushRange(uint32_t Addr, uint16_t NumByte);
+static void sFLASH_CacheWritePage(sFLASH_CachePage_TypeDef* CachePage);
+#endif /* sFLASH_USE_PAGE_CACHE */
+#ifdef sFLASH_USE_DMA
+static void sFLASH_DMAStart(uint8_t* pBuffer, uint32_t Addr, uint16_t NumByte,
+                            uint8_t Direction, void (*Callback)(void),
+                            FunctionalState NewState);
+static void sFLASH_DMATransfer(void);
+static void sFLASH_DMAComplete(void);
+static void sFLASH_DMAWait(void);
+static void sFLASH_DMAPrefetch(uint8_t* pBuffer);
+#endif /* sFLASH_USE_DMA */
 /**
   * @}
   */
@@ -112,6 +268,11 @@
   */
 void sFLASH_DeInit(void)
 {
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< Write the cached data before releasing the SPI */
+  sFLASH_CacheFlush();
+#endif /* sFLASH_USE_PAGE_CACHE */
+
   sFLASH_LowLevel_DeInit();
 }
 
@@ -129,12 +290,7 @@ void sFLASH_Init(void)
   sFLASH_CS_HIGH();
 
   /* SPI configuration */
-  SPI_Init(sFLASH_SPI, SPI_FirstBit_MSB, SPI_BaudRatePrescaler_4, SPI_Mode_Master,
-           SPI_CPOL_High, SPI_CPHA_2Edge, SPI_Direction_2Lines_FullDuplex,
-           SPI_NSS_Soft, 0x07);
-
-  /* Enable SPI  */
-  SPI_Cmd(sFLASH_SPI, ENABLE);
+  sFLASH_SPIConfig(sFLASH_SPI_PRESCALER);
 }
 
 /**
@@ -144,22 +300,12 @@ void sFLASH_Init(void)
   */
 void sFLASH_EraseSector(uint32_t SectorAddr)
 {
-  /*!< Send write enable instruction */
-  sFLASH_WriteEnable();
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< The cached data was written before the erase */
+  sFLASH_CacheFlush();
+#endif /* sFLASH_USE_PAGE_CACHE */
 
-  /*!< Sector Erase */
-  /*!< Select the FLASH: Chip Select low */
-  sFLASH_CS_LOW();
-  /*!< Send Sector Erase instruction */
-  sFLASH_SendByte(sFLASH_CMD_SE);
-  /*!< Send SectorAddr high nibble address byte */
-  sFLASH_SendByte((uint8_t)((SectorAddr & 0xFF0000) >> 16));
-  /*!< Send SectorAddr medium nibble address byte */
-  sFLASH_SendByte((uint8_t)((SectorAddr & 0xFF00) >> 8));
-  /*!< Send SectorAddr low nibble address byte */
-  sFLASH_SendByte((uint8_t)(SectorAddr & 0xFF));
-  /*!< Deselect the FLASH: Chip Select high */
-  sFLASH_CS_HIGH();
+  sFLASH_StartErase(sFLASH_CMD_SE, SectorAddr);
 
   /*!< Wait the end of Flash writing */
   sFLASH_WaitForWriteEnd();
@@ -172,16 +318,17 @@ void sFLASH_EraseSector(uint32_t SectorAddr)
   */
 void sFLASH_EraseBulk(void)
 {
-  /*!< Send write enable instruction */
-  sFLASH_WriteEnable();
+#ifdef sFLASH_USE_PAGE_CACHE
+  uint8_t index = 0;
 
-  /*!< Bulk Erase */
-  /*!< Select the FLASH: Chip Select low */
-  sFLASH_CS_LOW();
-  /*!< Send Bulk Erase instruction  */
-  sFLASH_SendByte(sFLASH_CMD_BE);
-  /*!< Deselect the FLASH: Chip Select high */
-  sFLASH_CS_HIGH();
+  /*!< The cached data would be erased: drop it */
+  for (index = 0; index < sFLASH_CACHE_PAGE_NB; index++)
+  {
+    sFLASHCache[index].Dirty = RESET;
+  }
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+  sFLASH_StartErase(sFLASH_CMD_BE, 0);
 
   /*!< Wait the end of Flash writing */
   sFLASH_WaitForWriteEnd();
@@ -200,31 +347,7 @@ void sFLASH_EraseBulk(void)
   */
 void sFLASH_WritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
 {
-  /*!< Enable the write access to the FLASH */
-  sFLASH_WriteEnable();
-
-  /*!< Select the FLASH: Chip Select low */
-  sFLASH_CS_LOW();
-  /*!< Send "Write to Memory " instruction */
-  sFLASH_SendByte(sFLASH_CMD_WRITE);
-  /*!< Send WriteAddr high nibble address byte to write to */
-  sFLASH_SendByte((uint8_t)((WriteAddr & 0xFF0000) >> 16));
-  /*!< Send WriteAddr medium nibble address byte to write to */
-  sFLASH_SendByte((uint8_t)((WriteAddr & 0xFF00) >> 8));
-  /*!< Send WriteAddr low nibble address byte to write to */
-  sFLASH_SendByte((uint8_t)(WriteAddr & 0xFF));
-
-  /*!< while there is data to be written on the FLASH */
-  while (NumByteToWrite--)
-  {
-    /*!< Send the current byte */
-    sFLASH_SendByte(*pBuffer);
-    /*!< Point on the next byte to be written */
-    pBuffer++;
-  }
-
-  /*!< Deselect the FLASH: Chip Select high */
-  sFLASH_CS_HIGH();
+  sFLASH_StartWritePage(pBuffer, WriteAddr, NumByteToWrite);
 
   /*!< Wait the end of Flash writing */
   sFLASH_WaitForWriteEnd();
@@ -241,6 +364,10 @@ void sFLASH_WritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWr
   */
 void sFLASH_WriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
 {
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< The FLASH pages are written from the cache */
+  sFLASH_CacheWrite(pBuffer, WriteAddr, NumByteToWrite);
+#else
   uint8_t NumOfPage = 0, NumOfSingle = 0, Addr = 0, count = 0, temp = 0;
 
   Addr = (uint8_t)(WriteAddr % sFLASH_SPI_PAGESIZE);
@@ -308,6 +435,7 @@ void sFLASH_WriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteTo
       }
     }
   }
+#endif /* sFLASH_USE_PAGE_CACHE */
 }
 
 /**
@@ -319,6 +447,24 @@ void sFLASH_WriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteTo
   */
 void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead)
 {
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< Write the cached pages to read first */
+  sFLASH_CacheFlushRange(ReadAddr, NumByteToRead);
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+  sFLASH_STATISTICS_ADD(ReadNb, 1);
+  sFLASH_STATISTICS_ADD(ReadByteNb, NumByteToRead);
+
+#ifdef sFLASH_USE_DMA
+  /*!< DMA could be used for number of data higher than 1 */
+  if (NumByteToRead > 1)
+  {
+    sFLASH_DMAStart(pBuffer, ReadAddr, NumByteToRead, sFLASH_DIRECTION_RX, 0, DISABLE);
+    sFLASH_DMAWait();
+    return;
+  }
+#endif /* sFLASH_USE_DMA */
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -344,6 +490,116 @@ void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRe
   sFLASH_CS_HIGH();
 }
 
+#ifdef sFLASH_USE_DMA
+/**
+  * @brief  Starts reading a block of data from the FLASH with the DMA and
+  *         returns without waiting for its end.
+  * @note   The buffer is transmitted as dummy bytes while it is received.
+  * @param  pBuffer: pointer to the buffer that receives the data read from the FLASH.
+  * @param  ReadAddr: FLASH's internal address to read from.
+  * @param  NumByteToRead: number of bytes to read from the FLASH.
+  * @param  Callback: function called from the DMA interrupt handler once the
+  *         data is read, 0 for none.
+  * @retval None
+  */
+void sFLASH_ReadBufferDMA(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead,
+                          void (*Callback)(void))
+{
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< Write the cached pages to read first */
+  sFLASH_CacheFlushRange(ReadAddr, NumByteToRead);
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+  sFLASH_STATISTICS_ADD(ReadNb, 1);
+  sFLASH_STATISTICS_ADD(ReadByteNb, NumByteToRead);
+
+  sFLASH_DMAStart(pBuffer, ReadAddr, NumByteToRead, sFLASH_DIRECTION_RX, Callback, ENABLE);
+}
+
+/**
+  * @brief  Starts writing more than one byte to the FLASH with a single WRITE
+  *         cycle (Page WRITE sequence) with the DMA and returns without
+  *         waiting for its end.
+  * @note   The number of byte can't exceed the FLASH page size.
+  * @note   Once the data is transferred the FLASH is still writing it: the
+  *         end of the writing must be checked (sFLASH_WaitForWriteEnd())
+  *         before the next instruction.
+  * @param  pBuffer: pointer to the buffer  containing the data to be written
+  *         to the FLASH.
+  * @param  WriteAddr: FLASH's internal address to write to.
+  * @param  NumByteToWrite: number of bytes to write to the FLASH, must be equal
+  *         or less than "sFLASH_PAGESIZE" value.
+  * @param  Callback: function called from the DMA interrupt handler once the
+  *         data is transferred, 0 for none.
+  * @retval None
+  */
+void sFLASH_WritePageDMA(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite,
+                         void (*Callback)(void))
+{
+  sFLASH_STATISTICS_ADD(ProgramNb, 1);
+  sFLASH_STATISTICS_ADD(ProgramByteNb, NumByteToWrite);
+
+  sFLASH_DMAStart(pBuffer, WriteAddr, NumByteToWrite, sFLASH_DIRECTION_TX, Callback, ENABLE);
+}
+
+/**
+  * @brief  Returns the state of the DMA transfers.
+  * @param  None
+  * @retval sFLASH_STATE_BUSY while a transfer is in progress,
+  *         sFLASH_STATE_READY otherwise.
+  */
+uint8_t sFLASH_GetState(void)
+{
+  return sFLASHState;
+}
+
+/**
+  * @brief  This function handles the DMA Rx Channel interrupt Handler.
+  *     @note This function should be called in the interrupt handler of
+  *       sFLASH_SPI_DMA_CHANNEL_RX in the stm8l15x_it.c file (for the
+  *       STM8L1526-EVAL board) just as follow.
+  *
+  *       // INTERRUPT_HANDLER(DMA1_CHANNEL0_1_IRQHandler, 2)
+  *       // {
+  *           // sFLASH_SPI_DMA_RX_IRQHandler();
+  *       // }
+  * @param  None
+  * @retval None
+  */
+void sFLASH_SPI_DMA_RX_IRQHandler(void)
+{
+  /* Check if the DMA transfer of a read is complete */
+  if ((sFLASHDataIT != DISABLE) && (sFLASHDataDirection == sFLASH_DIRECTION_RX)
+      && (DMA_GetFlagStatus(sFLASH_SPI_DMA_FLAG_RX_TC) != RESET))
+  {
+    sFLASH_DMAComplete();
+  }
+}
+
+/**
+  * @brief  This function handles the DMA Tx Channel interrupt Handler.
+  *     @note This function should be called in the interrupt handler of
+  *       sFLASH_SPI_DMA_CHANNEL_TX in the stm8l15x_it.c file (for the
+  *       STM8L1526-EVAL board) just as follow.
+  *
+  *       // INTERRUPT_HANDLER(DMA1_CHANNEL2_3_IRQHandler, 3)
+  *       // {
+  *           // sFLASH_SPI_DMA_TX_IRQHandler();
+  *       // }
+  * @param  None
+  * @retval None
+  */
+void sFLASH_SPI_DMA_TX_IRQHandler(void)
+{
+  /* Check if the DMA transfer of a write is complete */
+  if ((sFLASHDataIT != DISABLE) && (sFLASHDataDirection == sFLASH_DIRECTION_TX)
+      && (DMA_GetFlagStatus(sFLASH_SPI_DMA_FLAG_TX_TC) != RESET))
+  {
+    sFLASH_DMAComplete();
+  }
+}
+#endif /* sFLASH_USE_DMA */
+
 /**
   * @brief  Reads FLASH identification.
   * @param  None
@@ -387,6 +643,13 @@ uint32_t sFLASH_ReadID(void)
   */
 void sFLASH_StartReadSequence(uint32_t ReadAddr)
 {
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< The whole FLASH may be read */
+  sFLASH_CacheFlush();
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+  sFLASH_STATISTICS_ADD(ReadNb, 1);
+
   /*!< Select the FLASH: Chip Select low */
   sFLASH_CS_LOW();
 
@@ -402,6 +665,280 @@ void sFLASH_StartReadSequence(uint32_t ReadAddr)
   sFLASH_SendByte((uint8_t)(ReadAddr & 0xFF));
 }
 
+/**
+  * @brief  Starts a stream read from the FLASH: the FLASH is selected with the
+  *         FAST_READ instruction at the highest SPI clock and stays selected
+  *         until sFLASH_StreamStop() is called.
+  * @note   No other FLASH function may be called until sFLASH_StreamStop().
+  * @param  ReadAddr: FLASH's internal address to read from.
+  * @retval None
+  */
+void sFLASH_StreamStart(uint32_t ReadAddr)
+{
+#ifdef sFLASH_USE_DMA
+  /*!< Wait for the end of the previous transfer */
+  while (sFLASHState != sFLASH_STATE_READY)
+  {}
+#endif /* sFLASH_USE_DMA */
+
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< The whole FLASH may be read */
+  sFLASH_CacheFlush();
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+  sFLASH_STATISTICS_ADD(ReadNb, 1);
+
+  sFLASH_SPIConfig(sFLASH_SPI_STREAM_PRESCALER);
+
+  /*!< Select the FLASH: Chip Select low */
+  sFLASH_CS_LOW();
+
+  /*!< Send "Read from Memory at higher speed" instruction */
+  sFLASH_SendByte(sFLASH_CMD_FASTREAD);
+
+  /*!< Send ReadAddr high nibble address byte */
+  sFLASH_SendByte((uint8_t)((ReadAddr & 0xFF0000) >> 16));
+  /*!< Send ReadAddr medium nibble address byte */
+  sFLASH_SendByte((uint8_t)((ReadAddr& 0xFF00) >> 8));
+  /*!< Send ReadAddr low nibble address byte */
+  sFLASH_SendByte((uint8_t)(ReadAddr & 0xFF));
+  /*!< Send the dummy byte of the FAST_READ instruction */
+  sFLASH_SendByte(sFLASH_DUMMY_BYTE);
+
+  sFLASHStreamIndex = 0;
+
+#ifdef sFLASH_USE_DMA
+  /*!< Prefetch the first chunk */
+  sFLASH_DMAPrefetch(sFLASHStreamBuffer[0]);
+#endif /* sFLASH_USE_DMA */
+}
+
+/**
+  * @brief  Returns the next bytes of the stream read from the FLASH.
+  * @note   The chunk returned is valid until the next call: the following
+  *         one is meanwhile read by the DMA when sFLASH_USE_DMA is defined.
+  * @param  None
+  * @retval Pointer to the next sFLASH_STREAM_CHUNK_SIZE bytes
+  */
+uint8_t* sFLASH_StreamGetChunk(void)
+{
+  uint8_t* chunk = sFLASHStreamBuffer[sFLASHStreamIndex];
+#ifndef sFLASH_USE_DMA
+  uint8_t counter = 0;
+#endif /* sFLASH_USE_DMA */
+
+  sFLASHStreamIndex ^= 1;
+
+  sFLASH_STATISTICS_ADD(ReadByteNb, sFLASH_STREAM_CHUNK_SIZE);
+
+#ifdef sFLASH_USE_DMA
+  /*!< Wait for the end of the prefetch of the chunk */
+  sFLASH_DMAWait();
+
+  /*!< Prefetch the next chunk in the other buffer */
+  sFLASH_DMAPrefetch(sFLASHStreamBuffer[sFLASHStreamIndex]);
+#else
+  for (counter = 0; counter < sFLASH_STREAM_CHUNK_SIZE; counter++)
+  {
+    /*!< Read a byte from the FLASH */
+    chunk[counter] = sFLASH_SendByte(sFLASH_DUMMY_BYTE);
+  }
+#endif /* sFLASH_USE_DMA */
+
+  return chunk;
+}
+
+/**
+  * @brief  Stops the stream read from the FLASH: the FLASH is deselected and
+  *         the SPI clock of the instructions restored.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_StreamStop(void)
+{
+#ifdef sFLASH_USE_DMA
+  /*!< Wait for the end of the prefetch in progress */
+  sFLASH_DMAWait();
+#endif /* sFLASH_USE_DMA */
+
+  /*!< Deselect the FLASH: Chip Select high */
+  sFLASH_CS_HIGH();
+
+  sFLASH_SPIConfig(sFLASH_SPI_PRESCALER);
+}
+
+/**
+  * @brief  Queues the writing of a block of data to the FLASH, the FLASH
+  *         pages being written one by one by sFLASH_QueueTick().
+  * @note   The buffer must not be modified until the end of the operation.
+  * @param  pBuffer: pointer to the buffer  containing the data to be written
+  *         to the FLASH.
+  * @param  WriteAddr: FLASH's internal address to write to.
+  * @param  NumByteToWrite: number of bytes to write to the FLASH.
+  * @param  Callback: function called by sFLASH_QueueTick() once the data is
+  *         written, with the latency of the operation, 0 for none.
+  * @retval SUCCESS if the operation is queued, ERROR if the queue is full
+  */
+ErrorStatus sFLASH_QueueWriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite,
+                                    void (*Callback)(uint16_t Latency))
+{
+  return sFLASH_QueueAdd(sFLASH_CMD_WRITE, pBuffer, WriteAddr, NumByteToWrite, Callback);
+}
+
+/**
+  * @brief  Queues the erase of a FLASH sector.
+  * @param  SectorAddr: address of the sector to erase.
+  * @param  Callback: function called by sFLASH_QueueTick() once the sector is
+  *         erased, with the latency of the operation, 0 for none.
+  * @retval SUCCESS if the operation is queued, ERROR if the queue is full
+  */
+ErrorStatus sFLASH_QueueEraseSector(uint32_t SectorAddr, void (*Callback)(uint16_t Latency))
+{
+  return sFLASH_QueueAdd(sFLASH_CMD_SE, 0, SectorAddr, 0, Callback);
+}
+
+/**
+  * @brief  Queues the erase of the entire FLASH.
+  * @param  Callback: function called by sFLASH_QueueTick() once the FLASH is
+  *         erased, with the latency of the operation, 0 for none.
+  * @retval SUCCESS if the operation is queued, ERROR if the queue is full
+  */
+ErrorStatus sFLASH_QueueEraseBulk(void (*Callback)(uint16_t Latency))
+{
+  return sFLASH_QueueAdd(sFLASH_CMD_BE, 0, 0, 0, Callback);
+}
+
+/**
+  * @brief  Returns the number of operations of the queue, including the one
+  *         in progress.
+  * @param  None
+  * @retval Number of operations not ended
+  */
+uint8_t sFLASH_QueueGetPending(void)
+{
+  /*!< The operation in progress stays at the head of the queue */
+  return (uint8_t)((sFLASHQueueTail + (2 * sFLASH_QUEUE_SIZE) - sFLASHQueueHead) %
+                   (2 * sFLASH_QUEUE_SIZE));
+}
+
+/**
+  * @brief  Write and erase queue time base, to be called periodically. When
+  *         the FLASH is ready, goes on with the operation in progress or ends
+  *         it and starts the next one.
+  * @note   The FLASH status register is read once, without waiting.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_QueueTick(void)
+{
+  sFLASH_Operation_TypeDef* operation = 0;
+  void (*callback)(uint16_t Latency) = 0;
+  uint16_t latency = 0;
+
+  sFLASHQueueTime++;
+
+  /*!< Nothing to do while the queue is idle or the FLASH is busy */
+  if ((sFLASHQueueBusy == RESET) || ((sFLASH_ReadStatus() & sFLASH_WIP_FLAG) != 0))
+  {
+    return;
+  }
+
+  operation = &sFLASHQueue[sFLASHQueueHead % sFLASH_QUEUE_SIZE];
+
+  if (operation->NumByte != 0)
+  {
+    /*!< Write the next page */
+    sFLASH_QueueIssue(operation);
+    return;
+  }
+
+  /*!< The operation is ended: start the next one */
+  callback = operation->Callback;
+  latency = (uint16_t)(sFLASHQueueTime - operation->Time);
+
+  sFLASHQueueHead = (uint8_t)((sFLASHQueueHead + 1) % (2 * sFLASH_QUEUE_SIZE));
+  if (sFLASHQueueHead != sFLASHQueueTail)
+  {
+    sFLASH_QueueIssue(&sFLASHQueue[sFLASHQueueHead % sFLASH_QUEUE_SIZE]);
+  }
+  else
+  {
+    sFLASHQueueBusy = RESET;
+  }
+
+  if (callback != 0)
+  {
+    callback(latency);
+  }
+}
+
+#ifdef sFLASH_USE_PAGE_CACHE
+/**
+  * @brief  Writes all the data of the write cache to the FLASH.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_CacheFlush(void)
+{
+  uint8_t index = 0;
+
+  for (index = 0; index < sFLASH_CACHE_PAGE_NB; index++)
+  {
+    sFLASH_CacheWritePage(&sFLASHCache[index]);
+  }
+}
+
+/**
+  * @brief  Write cache time base, to be called periodically. Writes the cached
+  *         pages not written for sFLASH_CACHE_TIMEOUT calls to the FLASH.
+  * @note   As it may write a page, it must not interrupt another FLASH
+  *         function: it should be called from the same context as them.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_CacheTick(void)
+{
+  uint8_t index = 0;
+
+  for (index = 0; index < sFLASH_CACHE_PAGE_NB; index++)
+  {
+    if ((sFLASHCache[index].Dirty != RESET) &&
+        (++sFLASHCache[index].Age >= sFLASH_CACHE_TIMEOUT))
+    {
+      sFLASH_CacheWritePage(&sFLASHCache[index]);
+    }
+  }
+}
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+#ifdef sFLASH_USE_STATISTICS
+/**
+  * @brief  Returns the FLASH operations counted since the last
+  *         sFLASH_ClearStatistics().
+  * @param  Statistics: pointer to the structure that receives the counters.
+  * @retval None
+  */
+void sFLASH_GetStatistics(sFLASH_Statistics_TypeDef* Statistics)
+{
+  *Statistics = sFLASHStatistics;
+}
+
+/**
+  * @brief  Clears the counters of the FLASH operations.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_ClearStatistics(void)
+{
+  sFLASHStatistics.ReadNb = 0;
+  sFLASHStatistics.ReadByteNb = 0;
+  sFLASHStatistics.ProgramNb = 0;
+  sFLASHStatistics.ProgramByteNb = 0;
+  sFLASHStatistics.EraseNb = 0;
+  sFLASHStatistics.BusyNb = 0;
+}
+#endif /* sFLASH_USE_STATISTICS */
+
 /**
   * @brief  Reads a byte from the SPI Flash.
   * @note   This function must be used only if the Start_Read_Sequence function
@@ -411,6 +948,8 @@ void sFLASH_StartReadSequence(uint32_t ReadAddr)
   */
 uint8_t sFLASH_ReadByte(void)
 {
+  sFLASH_STATISTICS_ADD(ReadByteNb, 1);
+
   return (sFLASH_SendByte(sFLASH_DUMMY_BYTE));
 }
 
@@ -497,6 +1036,10 @@ void sFLASH_WaitForWriteEnd(void)
     and put the value of the status register in FLASH_Status variable */
     flashstatus = sFLASH_SendByte(sFLASH_DUMMY_BYTE);
 
+    if ((flashstatus & sFLASH_WIP_FLAG) == SET)
+    {
+      sFLASH_STATISTICS_ADD(BusyNb, 1);
+    }
   }
   while ((flashstatus & sFLASH_WIP_FLAG) == SET); /* Write in progress */
 
@@ -504,6 +1047,550 @@ void sFLASH_WaitForWriteEnd(void)
   sFLASH_CS_HIGH();
 }
 
+#ifdef sFLASH_USE_DMA
+/**
+  * @brief  Sends the READ or WRITE instruction and its address, then starts
+  *         transferring the data with the DMA.
+  * @note   Waits for the end of the previous transfer first.
+  * @param  pBuffer: pointer to the buffer to transfer.
+  * @param  Addr: FLASH's internal address to read from or write to.
+  * @param  NumByte: number of bytes to transfer.
+  * @param  Direction: sFLASH_DIRECTION_RX to read or sFLASH_DIRECTION_TX to
+  *         write.
+  * @param  Callback: function called once the data is transferred, 0 for none.
+  * @param  NewState: ENABLE to end the transfer in the DMA interrupt handler,
+  *         DISABLE to end it in sFLASH_DMAWait().
+  * @retval None
+  */
+static void sFLASH_DMAStart(uint8_t* pBuffer, uint32_t Addr, uint16_t NumByte,
+                            uint8_t Direction, void (*Callback)(void),
+                            FunctionalState NewState)
+{
+  /*!< Wait for the end of the previous transfer */
+  while (sFLASHState != sFLASH_STATE_READY)
+  {}
+
+  sFLASHState = sFLASH_STATE_BUSY;
+  sFLASHDataPointer = pBuffer;
+  sFLASHDataNum = NumByte;
+  sFLASHDataDirection = Direction;
+  sFLASHDataIT = NewState;
+  sFLASHCallback = Callback;
+  sFLASHDataHold = RESET;
+
+  if (Direction == sFLASH_DIRECTION_TX)
+  {
+    /*!< Enable the write access to the FLASH */
+    sFLASH_WriteEnable();
+  }
+
+  /*!< Select the FLASH: Chip Select low */
+  sFLASH_CS_LOW();
+  /*!< Send "Write to Memory " or "Read from Memory " instruction */
+  sFLASH_SendByte((uint8_t)((Direction == sFLASH_DIRECTION_TX) ? sFLASH_CMD_WRITE : sFLASH_CMD_READ));
+  /*!< Send Addr high nibble address byte */
+  sFLASH_SendByte((uint8_t)((Addr & 0xFF0000) >> 16));
+  /*!< Send Addr medium nibble address byte */
+  sFLASH_SendByte((uint8_t)((Addr & 0xFF00) >> 8));
+  /*!< Send Addr low nibble address byte */
+  sFLASH_SendByte((uint8_t)(Addr & 0xFF));
+
+  /* Global DMA Enable */
+  DMA_GlobalCmd(ENABLE);
+
+  sFLASH_DMATransfer();
+}
+
+/**
+  * @brief  Starts the DMA transfer of the next part of the data or, once all
+  *         the data is transferred, ends the sequence.
+  * @param  None
+  * @retval None
+  */
+static void sFLASH_DMATransfer(void)
+{
+  uint8_t size = 0;
+  void (*callback)(void) = sFLASHCallback;
+
+  if (sFLASHDataNum == 0)
+  {
+    /*!< Disable the sFLASH_SPI DMA requests */
+    SPI_DMACmd(sFLASH_SPI, SPI_DMAReq_RX, DISABLE);
+    SPI_DMACmd(sFLASH_SPI, SPI_DMAReq_TX, DISABLE);
+
+    if (sFLASHDataHold == RESET)
+    {
+      /*!< Deselect the FLASH: Chip Select high */
+      sFLASH_CS_HIGH();
+    }
+
+    sFLASHState = sFLASH_STATE_READY;
+
+    if (callback != 0)
+    {
+      callback();
+    }
+    return;
+  }
+
+  size = (uint8_t)((sFLASHDataNum > sFLASH_DMA_MAX_SIZE) ? sFLASH_DMA_MAX_SIZE : sFLASHDataNum);
+
+  /* Configure the DMA channels with the buffer address and the buffer size */
+  sFLASH_LowLevel_DMAConfig((uint16_t)sFLASHDataPointer, size, sFLASHDataDirection);
+  sFLASHDataPointer += size;
+  sFLASHDataNum -= size;
+
+  if (sFLASHDataDirection == sFLASH_DIRECTION_RX)
+  {
+    /* The Rx channel ends the transfer: enabled first */
+    DMA_ITConfig(sFLASH_SPI_DMA_CHANNEL_RX, DMA_ITx_TC, sFLASHDataIT);
+    SPI_DMACmd(sFLASH_SPI, SPI_DMAReq_RX, ENABLE);
+    DMA_Cmd(sFLASH_SPI_DMA_CHANNEL_RX, ENABLE);
+  }
+  else
+  {
+    DMA_ITConfig(sFLASH_SPI_DMA_CHANNEL_TX, DMA_ITx_TC, sFLASHDataIT);
+  }
+
+  SPI_DMACmd(sFLASH_SPI, SPI_DMAReq_TX, ENABLE);
+  DMA_Cmd(sFLASH_SPI_DMA_CHANNEL_TX, ENABLE);
+}
+
+/**
+  * @brief  Ends the current DMA transfer and starts the next one.
+  * @param  None
+  * @retval None
+  */
+static void sFLASH_DMAComplete(void)
+{
+  /* Disable the DMA Channels and Clear all their Flags */
+  DMA_Cmd(sFLASH_SPI_DMA_CHANNEL_TX, DISABLE);
+  DMA_ClearFlag(sFLASH_SPI_DMA_FLAG_TX_TC);
+
+  if (sFLASHDataDirection == sFLASH_DIRECTION_RX)
+  {
+    DMA_Cmd(sFLASH_SPI_DMA_CHANNEL_RX, DISABLE);
+    DMA_ClearFlag(sFLASH_SPI_DMA_FLAG_RX_TC);
+  }
+  else
+  {
+    /*!< Wait till all data have been physically transferred on the bus */
+    while (SPI_GetFlagStatus(sFLASH_SPI, SPI_FLAG_TXE) == RESET)
+    {}
+    while (SPI_GetFlagStatus(sFLASH_SPI, SPI_FLAG_BSY) != RESET)
+    {}
+
+    /*!< Discard the bytes received: reading DR then SR clears the overrun */
+    SPI_ReceiveData(sFLASH_SPI);
+    SPI_GetFlagStatus(sFLASH_SPI, SPI_FLAG_OVR);
+  }
+
+  sFLASH_DMATransfer();
+}
+
+/**
+  * @brief  Starts reading the next chunk of the stream with the DMA, the FLASH
+  *         staying selected at the end. The end of the transfer is waited for
+  *         by sFLASH_DMAWait(), its interrupts are not used.
+  * @param  pBuffer: pointer to the chunk that receives the data.
+  * @retval None
+  */
+static void sFLASH_DMAPrefetch(uint8_t* pBuffer)
+{
+  sFLASHState = sFLASH_STATE_BUSY;
+  sFLASHDataPointer = pBuffer;
+  sFLASHDataNum = sFLASH_STREAM_CHUNK_SIZE;
+  sFLASHDataDirection = sFLASH_DIRECTION_RX;
+  sFLASHDataIT = DISABLE;
+  sFLASHCallback = 0;
+  sFLASHDataHold = SET;
+
+  /* Global DMA Enable */
+  DMA_GlobalCmd(ENABLE);
+
+  sFLASH_DMATransfer();
+}
+
+/**
+  * @brief  Waits for the end of a DMA transfer started with its interrupts
+  *         disabled.
+  * @param  None
+  * @retval None
+  */
+static void sFLASH_DMAWait(void)
+{
+  while (sFLASHState != sFLASH_STATE_READY)
+  {
+    if (sFLASHDataDirection == sFLASH_DIRECTION_RX)
+    {
+      if (DMA_GetFlagStatus(sFLASH_SPI_DMA_FLAG_RX_TC) != RESET)
+      {
+        sFLASH_DMAComplete();
+      }
+    }
+    else if (DMA_GetFlagStatus(sFLASH_SPI_DMA_FLAG_TX_TC) != RESET)
+    {
+      sFLASH_DMAComplete();
+    }
+  }
+}
+#endif /* sFLASH_USE_DMA */
+
+/**
+  * @brief  Sends an erase instruction to the FLASH, without waiting for the
+  *         end of the erase.
+  * @param  Instruction: sFLASH_CMD_SE or sFLASH_CMD_BE.
+  * @param  SectorAddr: address of the sector to erase, not used by
+  *         sFLASH_CMD_BE.
+  * @retval None
+  */
+static void sFLASH_StartErase(uint8_t Instruction, uint32_t SectorAddr)
+{
+  sFLASH_STATISTICS_ADD(EraseNb, 1);
+
+  /*!< Send write enable instruction */
+  sFLASH_WriteEnable();
+
+  /*!< Select the FLASH: Chip Select low */
+  sFLASH_CS_LOW();
+  /*!< Send Sector Erase or Bulk Erase instruction */
+  sFLASH_SendByte(Instruction);
+  if (Instruction == sFLASH_CMD_SE)
+  {
+    /*!< Send SectorAddr high nibble address byte */
+    sFLASH_SendByte((uint8_t)((SectorAddr & 0xFF0000) >> 16));
+    /*!< Send SectorAddr medium nibble address byte */
+    sFLASH_SendByte((uint8_t)((SectorAddr & 0xFF00) >> 8));
+    /*!< Send SectorAddr low nibble address byte */
+    sFLASH_SendByte((uint8_t)(SectorAddr & 0xFF));
+  }
+  /*!< Deselect the FLASH: Chip Select high */
+  sFLASH_CS_HIGH();
+}
+
+/**
+  * @brief  Sends more than one byte to the FLASH with a single WRITE cycle
+  *         (Page WRITE sequence), without waiting for the end of the writing.
+  * @note   The number of byte can't exceed the FLASH page size.
+  * @param  pBuffer: pointer to the buffer  containing the data to be written
+  *         to the FLASH.
+  * @param  WriteAddr: FLASH's internal address to write to.
+  * @param  NumByteToWrite: number of bytes to write to the FLASH, must be equal
+  *         or less than "sFLASH_PAGESIZE" value.
+  * @retval None
+  */
+static void sFLASH_StartWritePage(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
+{
+  sFLASH_STATISTICS_ADD(ProgramNb, 1);
+  sFLASH_STATISTICS_ADD(ProgramByteNb, NumByteToWrite);
+
+#ifdef sFLASH_USE_DMA
+  /*!< DMA could be used for number of data higher than 1 */
+  if (NumByteToWrite > 1)
+  {
+    sFLASH_DMAStart(pBuffer, WriteAddr, NumByteToWrite, sFLASH_DIRECTION_TX, 0, DISABLE);
+    sFLASH_DMAWait();
+    return;
+  }
+#endif /* sFLASH_USE_DMA */
+
+  /*!< Enable the write access to the FLASH */
+  sFLASH_WriteEnable();
+
+  /*!< Select the FLASH: Chip Select low */
+  sFLASH_CS_LOW();
+  /*!< Send "Write to Memory " instruction */
+  sFLASH_SendByte(sFLASH_CMD_WRITE);
+  /*!< Send WriteAddr high nibble address byte to write to */
+  sFLASH_SendByte((uint8_t)((WriteAddr & 0xFF0000) >> 16));
+  /*!< Send WriteAddr medium nibble address byte to write to */
+  sFLASH_SendByte((uint8_t)((WriteAddr & 0xFF00) >> 8));
+  /*!< Send WriteAddr low nibble address byte to write to */
+  sFLASH_SendByte((uint8_t)(WriteAddr & 0xFF));
+
+  /*!< while there is data to be written on the FLASH */
+  while (NumByteToWrite--)
+  {
+    /*!< Send the current byte */
+    sFLASH_SendByte(*pBuffer);
+    /*!< Point on the next byte to be written */
+    pBuffer++;
+  }
+
+  /*!< Deselect the FLASH: Chip Select high */
+  sFLASH_CS_HIGH();
+}
+
+/**
+  * @brief  Reads the FLASH's status register.
+  * @param  None
+  * @retval FLASH's status register
+  */
+static uint8_t sFLASH_ReadStatus(void)
+{
+  uint8_t flashstatus = 0;
+
+  /*!< Select the FLASH: Chip Select low */
+  sFLASH_CS_LOW();
+
+  /*!< Send "Read Status Register" instruction */
+  sFLASH_SendByte(sFLASH_CMD_RDSR);
+
+  /*!< Send a dummy byte to generate the clock needed by the FLASH */
+  flashstatus = sFLASH_SendByte(sFLASH_DUMMY_BYTE);
+
+  /*!< Deselect the FLASH: Chip Select high */
+  sFLASH_CS_HIGH();
+
+  if ((flashstatus & sFLASH_WIP_FLAG) != 0)
+  {
+    sFLASH_STATISTICS_ADD(BusyNb, 1);
+  }
+
+  return flashstatus;
+}
+
+/**
+  * @brief  Adds a write or erase operation to the queue and starts it if the
+  *         queue is idle.
+  * @param  Instruction: sFLASH_CMD_WRITE, sFLASH_CMD_SE or sFLASH_CMD_BE.
+  * @param  pBuffer: pointer to the data to write.
+  * @param  Addr: FLASH's internal address.
+  * @param  NumByte: number of bytes to write.
+  * @param  Callback: function called at the end of the operation, 0 for none.
+  * @retval SUCCESS if the operation is queued, ERROR if the queue is full
+  */
+static ErrorStatus sFLASH_QueueAdd(uint8_t Instruction, uint8_t* pBuffer, uint32_t Addr,
+                                   uint16_t NumByte, void (*Callback)(uint16_t Latency))
+{
+  sFLASH_Operation_TypeDef* operation = 0;
+  uint8_t tail = sFLASHQueueTail;
+
+#ifdef sFLASH_USE_PAGE_CACHE
+  /*!< The cached data was written before the queued operation. No data is
+       cached while the queue is busy, the cache being flushed at its start */
+  sFLASH_CacheFlush();
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+  /*!< The indexes run over twice the queue size: equal when the queue is
+       empty, sFLASH_QUEUE_SIZE apart when it is full */
+  if (((tail + (2 * sFLASH_QUEUE_SIZE) - sFLASHQueueHead) % (2 * sFLASH_QUEUE_SIZE)) ==
+      sFLASH_QUEUE_SIZE)
+  {
+    return ERROR;
+  }
+
+  operation = &sFLASHQueue[tail % sFLASH_QUEUE_SIZE];
+  operation->Instruction = Instruction;
+  operation->pBuffer = pBuffer;
+  operation->Addr = Addr;
+  operation->NumByte = NumByte;
+  operation->Time = sFLASHQueueTime;
+  operation->Callback = Callback;
+
+  /*!< Publish the operation before checking whether the queue is idle: an
+       operation ending meanwhile in sFLASH_QueueTick() starts it */
+  sFLASHQueueTail = (uint8_t)((tail + 1) % (2 * sFLASH_QUEUE_SIZE));
+
+  if (sFLASHQueueBusy == RESET)
+  {
+    sFLASH_QueueIssue(operation);
+    sFLASHQueueBusy = SET;
+  }
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Sends the next instruction of a queued operation: the erase, or
+  *         the writing of the next page of the data.
+  * @param  Operation: pointer to the operation.
+  * @retval None
+  */
+static void sFLASH_QueueIssue(sFLASH_Operation_TypeDef* Operation)
+{
+  uint16_t count = 0;
+
+  if (Operation->Instruction != sFLASH_CMD_WRITE)
+  {
+    sFLASH_StartErase(Operation->Instruction, Operation->Addr);
+    return;
+  }
+
+  /*!< Up to the end of the page of the address */
+  count = (uint16_t)(sFLASH_SPI_PAGESIZE - (Operation->Addr % sFLASH_SPI_PAGESIZE));
+  if (count > Operation->NumByte)
+  {
+    count = Operation->NumByte;
+  }
+
+  if (count != 0)
+  {
+    sFLASH_StartWritePage(Operation->pBuffer, Operation->Addr, count);
+  }
+
+  Operation->pBuffer += count;
+  Operation->Addr += count;
+  Operation->NumByte -= count;
+}
+
+#ifdef sFLASH_USE_PAGE_CACHE
+/**
+  * @brief  Copies a block of data into the write cache, the cached page
+  *         written the earliest being written to the FLASH when a new page
+  *         needs its place.
+  * @note   The data is ANDed with the cached one, as the FLASH programming
+  *         does, so that several writes to the same byte end with the same
+  *         FLASH content as without the cache.
+  * @param  pBuffer: pointer to the buffer  containing the data to be written
+  *         to the FLASH.
+  * @param  WriteAddr: FLASH's internal address to write to.
+  * @param  NumByteToWrite: number of bytes to write to the FLASH.
+  * @retval None
+  */
+static void sFLASH_CacheWrite(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite)
+{
+  sFLASH_CachePage_TypeDef* cachepage = 0;
+  uint32_t page = 0;
+  uint16_t offset = 0, count = 0, index = 0;
+  uint8_t line = 0;
+
+  while (NumByteToWrite != 0)
+  {
+    /*!< Part of the data in the page of WriteAddr */
+    page = WriteAddr & ~((uint32_t)sFLASH_SPI_PAGESIZE - 1);
+    offset = (uint16_t)(WriteAddr - page);
+    count = (uint16_t)(sFLASH_SPI_PAGESIZE - offset);
+    if (count > NumByteToWrite)
+    {
+      count = NumByteToWrite;
+    }
+
+    /*!< Look for the page in the cache */
+    for (line = 0; line < sFLASH_CACHE_PAGE_NB; line++)
+    {
+      if ((sFLASHCache[line].Dirty != RESET) && (sFLASHCache[line].Page == page))
+      {
+        break;
+      }
+    }
+
+    if (line == sFLASH_CACHE_PAGE_NB)
+    {
+      /*!< Take a free cache page, else the one written the earliest */
+      for (line = 0; line < sFLASH_CACHE_PAGE_NB; line++)
+      {
+        if (sFLASHCache[line].Dirty == RESET)
+        {
+          break;
+        }
+      }
+      if (line == sFLASH_CACHE_PAGE_NB)
+      {
+        line = (uint8_t)((sFLASHCacheLast + 1) % sFLASH_CACHE_PAGE_NB);
+        sFLASH_CacheWritePage(&sFLASHCache[line]);
+      }
+
+      cachepage = &sFLASHCache[line];
+      for (index = 0; index < sFLASH_SPI_PAGESIZE; index++)
+      {
+        cachepage->Data[index] = 0xFF;
+      }
+      cachepage->Page = page;
+      cachepage->First = (uint8_t)offset;
+      cachepage->Last = (uint8_t)offset;
+      cachepage->Dirty = SET;
+    }
+
+    cachepage = &sFLASHCache[line];
+    sFLASHCacheLast = line;
+    cachepage->Age = 0;
+
+    /*!< Extend the range of bytes written */
+    if (offset < cachepage->First)
+    {
+      cachepage->First = (uint8_t)offset;
+    }
+    if ((offset + count - 1) > cachepage->Last)
+    {
+      cachepage->Last = (uint8_t)(offset + count - 1);
+    }
+
+    for (index = offset; index < (offset + count); index++)
+    {
+      cachepage->Data[index] &= *pBuffer;
+      pBuffer++;
+    }
+
+    /*!< A full page can not be gathered with anything else */
+    if ((cachepage->First == 0) && (cachepage->Last == (sFLASH_SPI_PAGESIZE - 1)))
+    {
+      sFLASH_CacheWritePage(cachepage);
+    }
+
+    WriteAddr += count;
+    NumByteToWrite -= count;
+  }
+}
+
+/**
+  * @brief  Writes the cached pages holding data of a FLASH area to the FLASH.
+  * @param  Addr: FLASH's internal address of the area.
+  * @param  NumByte: number of bytes of the area.
+  * @retval None
+  */
+static void sFLASH_CacheFlushRange(uint32_t Addr, uint16_t NumByte)
+{
+  uint8_t index = 0;
+
+  for (index = 0; index < sFLASH_CACHE_PAGE_NB; index++)
+  {
+    if ((sFLASHCache[index].Page < (Addr + NumByte)) &&
+        (Addr < (sFLASHCache[index].Page + sFLASH_SPI_PAGESIZE)))
+    {
+      sFLASH_CacheWritePage(&sFLASHCache[index]);
+    }
+  }
+}
+
+/**
+  * @brief  Writes a cached page to the FLASH, if it holds data not yet
+  *         written, and frees it.
+  * @note   The bytes from the first to the last one written are written with
+  *         a single Page WRITE sequence: the bytes not written in between are
+  *         0xFF, which leaves the FLASH unchanged.
+  * @param  CachePage: cached page to write.
+  * @retval None
+  */
+static void sFLASH_CacheWritePage(sFLASH_CachePage_TypeDef* CachePage)
+{
+  if (CachePage->Dirty != RESET)
+  {
+    CachePage->Dirty = RESET;
+    sFLASH_WritePage(&CachePage->Data[CachePage->First], CachePage->Page + CachePage->First,
+                     (uint16_t)(CachePage->Last - CachePage->First + 1));
+  }
+}
+#endif /* sFLASH_USE_PAGE_CACHE */
+
+/**
+  * @brief  Configures and enables the sFLASH_SPI.
+  * @param  SPI_BaudRatePrescaler: SPI clock prescaler.
+  * @retval None
+  */
+static void sFLASH_SPIConfig(SPI_BaudRatePrescaler_TypeDef SPI_BaudRatePrescaler)
+{
+  /* The SPI clock is only changed while the SPI is disabled */
+  SPI_Cmd(sFLASH_SPI, DISABLE);
+
+  SPI_Init(sFLASH_SPI, SPI_FirstBit_MSB, SPI_BaudRatePrescaler, SPI_Mode_Master,
+           SPI_CPOL_High, SPI_CPHA_2Edge, SPI_Direction_2Lines_FullDuplex,
+           SPI_NSS_Soft, 0x07);
+
+  /* Enable SPI  */
+  SPI_Cmd(sFLASH_SPI, ENABLE);
+}
+
 /**
   * @}
   */
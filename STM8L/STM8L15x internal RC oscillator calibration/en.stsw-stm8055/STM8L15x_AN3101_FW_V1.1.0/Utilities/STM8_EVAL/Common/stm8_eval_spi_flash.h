@@ -43,6 +43,19 @@
 /** @defgroup STM8_EVAL_SPI_FLASH_Exported_Types
   * @{
   */ 
+/**
+  * @brief  FLASH operations counted since the last sFLASH_ClearStatistics()
+  */
+typedef struct
+{
+  uint32_t ReadNb;        /*!< READ and FAST_READ sequences */
+  uint32_t ReadByteNb;    /*!< Bytes read */
+  uint32_t ProgramNb;     /*!< Page WRITE sequences */
+  uint32_t ProgramByteNb; /*!< Bytes written */
+  uint32_t EraseNb;       /*!< Sector and bulk erases */
+  uint32_t BusyNb;        /*!< Status register reads returning a write in
+                               progress: the time spent waiting for the FLASH */
+}sFLASH_Statistics_TypeDef;
 /**
   * @}
   */
@@ -57,6 +70,7 @@
 #define sFLASH_CMD_WRSR           0x01  /*!< Write Status Register instruction */
 #define sFLASH_CMD_WREN           0x06  /*!< Write enable instruction */
 #define sFLASH_CMD_READ           0x03  /*!< Read from Memory instruction */
+#define sFLASH_CMD_FASTREAD       0x0B  /*!< Read from Memory at higher speed instruction */
 #define sFLASH_CMD_RDSR           0x05  /*!< Read Status Register instruction  */
 #define sFLASH_CMD_RDID           0x9F  /*!< Read identification */
 #define sFLASH_CMD_SE             0xD8  /*!< Sector Erase instruction */
@@ -67,6 +81,34 @@
 #define sFLASH_DUMMY_BYTE         0xA5
 #define sFLASH_SPI_PAGESIZE       0x100
 
+/* Size of the chunks returned by sFLASH_StreamGetChunk(), at most 255. Two
+   chunks are allocated: one is prefetched while the other one is used */
+#define sFLASH_STREAM_CHUNK_SIZE  64
+
+/* Number of write and erase operations the queue can hold */
+#define sFLASH_QUEUE_SIZE         4
+
+/* Uncomment the line below to gather the data written by sFLASH_WriteBuffer()
+   in a RAM cache of sFLASH_CACHE_PAGE_NB FLASH pages. A cached page is written
+   with a single Page WRITE sequence when it is full or replaced by another
+   page, on sFLASH_CacheFlush(), or after sFLASH_CACHE_TIMEOUT calls of
+   sFLASH_CacheTick() without being written */
+/* #define sFLASH_USE_PAGE_CACHE */
+
+/* Uncomment the line below to count the FLASH operations, to compare the
+   throughput of the driver options: see sFLASH_GetStatistics() */
+/* #define sFLASH_USE_STATISTICS */
+
+/* Number of FLASH pages of the write cache, 1 or 2 */
+#define sFLASH_CACHE_PAGE_NB      1
+
+/* sFLASH_CacheTick() calls without write before a cached page is written */
+#define sFLASH_CACHE_TIMEOUT      100
+
+/* State of the DMA transfers */
+#define sFLASH_STATE_READY        0
+#define sFLASH_STATE_BUSY         1
+
 /**
   * @}
   */ 
@@ -102,6 +144,32 @@ void sFLASH_WriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteTo
 void sFLASH_ReadBuffer(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead);
 uint32_t sFLASH_ReadID(void);
 void sFLASH_StartReadSequence(uint32_t ReadAddr);  
+void sFLASH_StreamStart(uint32_t ReadAddr);
+uint8_t* sFLASH_StreamGetChunk(void);
+void sFLASH_StreamStop(void);
+ErrorStatus sFLASH_QueueWriteBuffer(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite,
+                                    void (*Callback)(uint16_t Latency));
+ErrorStatus sFLASH_QueueEraseSector(uint32_t SectorAddr, void (*Callback)(uint16_t Latency));
+ErrorStatus sFLASH_QueueEraseBulk(void (*Callback)(uint16_t Latency));
+uint8_t sFLASH_QueueGetPending(void);
+void sFLASH_QueueTick(void);
+#ifdef sFLASH_USE_PAGE_CACHE
+void sFLASH_CacheFlush(void);
+void sFLASH_CacheTick(void);
+#endif /* sFLASH_USE_PAGE_CACHE */
+#ifdef sFLASH_USE_STATISTICS
+void sFLASH_GetStatistics(sFLASH_Statistics_TypeDef* Statistics);
+void sFLASH_ClearStatistics(void);
+#endif /* sFLASH_USE_STATISTICS */
+#ifdef sFLASH_USE_DMA
+void sFLASH_ReadBufferDMA(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t NumByteToRead,
+                          void (*Callback)(void));
+void sFLASH_WritePageDMA(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t NumByteToWrite,
+                         void (*Callback)(void));
+uint8_t sFLASH_GetState(void);
+void sFLASH_SPI_DMA_RX_IRQHandler(void);
+void sFLASH_SPI_DMA_TX_IRQHandler(void);
+#endif /* sFLASH_USE_DMA */
 
 /**
   * @brief  Low layer functions
@@ -0,0 +1,580 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_spi_flash_log.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   This file provides a log-structured record store on the SPI
+  *          M25Pxxx FLASH memory, on top of the stm8_eval_spi_flash.c driver.
+  *          Records of 1 to sFLASH_LOG_RECORD_MAX bytes are appended one after
+  *          the other in the FLASH pages, a record never crossing a page. The
+  *          sectors of the log area are used in turn, as a ring, so that they
+  *          are all erased the same number of times, the oldest records being
+  *          erased when the log is full.
+  *
+  *          @note FLASH format:
+  *                - The first page of each sector holds the sector header: its
+  *                  sequence number (MSB first), incremented for each sector
+  *                  used, followed by 'L' 'G'.
+  *                - Each record is its length, its Fletcher-16 checksum over
+  *                  the length and the data (MSB first), then its data. A 0x00
+  *                  length ends the records of a page.
+  *                The data of a record is written before its header, and the
+  *                sequence number before 'L' 'G': a record or a sector is only
+  *                found once completely written. A record interrupted by a
+  *                power loss is skipped thanks to its checksum.
+  *
+  *          @note sFLASH_LogInit() recovers the write head after a reset: the
+  *                sector headers give the sector of highest sequence number,
+  *                in which the first free page is found by a binary search.
+  *                Only the last page used and the first free one are then
+  *                read, the page interrupted by a power loss being closed.
+  *
+  *          @note The sector following the write head is erased when the head
+  *                reaches it, or ahead of time by sFLASH_LogPrepare(), to be
+  *                called when the application has time for a sector erase.
+  *
+  *          @note Each record is written with two Page WRITE sequences (data
+  *                and header). When sFLASH_USE_PAGE_CACHE is defined, the
+  *                records of a page are written together with a single one;
+  *                sFLASH_CacheFlush() must then be called to make the last
+  *                records survive a power down.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_spi_flash_log.h"
+
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_SPI_FLASH_LOG
+  * @brief      This file includes the record log on the M25Pxxx SPI FLASH of
+  *             STM8-EVAL boards.
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Private_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Private_Defines
+  * @{
+  */
+#define sFLASH_LOG_SEQUENCE_SIZE  4     /* Sequence number of the sector header */
+#define sFLASH_LOG_MAGIC_0        0x4C  /* 'L' */
+#define sFLASH_LOG_MAGIC_1        0x47  /* 'G' */
+
+#define sFLASH_LOG_LENGTH_FREE    0xFF  /* Erased: no record written yet */
+#define sFLASH_LOG_LENGTH_END     0x00  /* No more records in the page */
+
+#define sFLASH_LOG_PAGE_NB        ((uint16_t)(sFLASH_LOG_SECTOR_SIZE / sFLASH_SPI_PAGESIZE))
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Private_Macros
+  * @{
+  */
+/**
+  * @brief  FLASH address of a sector of the log
+  */
+#define sFLASH_LOG_SECTOR_ADDR(Sector) \
+  (sFLASH_LOG_START_ADDR + ((uint32_t)(Sector) * sFLASH_LOG_SECTOR_SIZE))
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Private_Variables
+  * @{
+  */
+/* Write head: next record address, in the sector sFLASHLogSector */
+static FlagStatus sFLASHLogOpen = RESET;     /* SET once a sector is used */
+static uint16_t sFLASHLogSector = 0;
+static uint32_t sFLASHLogSequence = 0;
+static uint32_t sFLASHLogHead = 0;
+static FlagStatus sFLASHLogPrepared = RESET; /* Sector after the head erased */
+
+/* Read position of sFLASH_LogReadNext() */
+static uint16_t sFLASHLogReadSector = 0;
+static uint32_t sFLASHLogReadSequence = 0;
+static uint32_t sFLASHLogReadAddr = 0;
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Private_Function_Prototypes
+  * @{
+  */
+static void sFLASH_LogOpenSector(void);
+static uint32_t sFLASH_LogRecover(uint32_t SectorAddr);
+static FlagStatus sFLASH_LogReadHeader(uint16_t Sector, uint32_t* Sequence);
+static FlagStatus sFLASH_LogIsBlank(uint32_t Addr, uint16_t NumByte);
+static void sFLASH_LogEndPage(uint32_t Addr);
+static uint16_t sFLASH_LogChecksum(uint8_t Length, uint8_t* pBuffer);
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Recovers the write head of the log from the FLASH content.
+  * @note   The FLASH must have been initialized by sFLASH_Init().
+  * @param  None
+  * @retval None
+  */
+void sFLASH_LogInit(void)
+{
+  uint32_t sequence = 0;
+  uint16_t sector = 0;
+
+  sFLASHLogOpen = RESET;
+  sFLASHLogPrepared = RESET;
+
+  /*!< The write head is in the sector of highest sequence number */
+  for (sector = 0; sector < sFLASH_LOG_SECTOR_NB; sector++)
+  {
+    if ((sFLASH_LogReadHeader(sector, &sequence) != RESET) &&
+        ((sFLASHLogOpen == RESET) || (sequence > sFLASHLogSequence)))
+    {
+      sFLASHLogSector = sector;
+      sFLASHLogSequence = sequence;
+      sFLASHLogOpen = SET;
+    }
+  }
+
+  if (sFLASHLogOpen != RESET)
+  {
+    sFLASHLogHead = sFLASH_LogRecover(sFLASH_LOG_SECTOR_ADDR(sFLASHLogSector));
+  }
+}
+
+/**
+  * @brief  Appends a record to the log.
+  * @param  pBuffer: pointer to the record data.
+  * @param  NumByte: number of bytes of the record, from 1 to
+  *         sFLASH_LOG_RECORD_MAX.
+  * @retval SUCCESS if the record is written, ERROR if its size is not valid
+  */
+ErrorStatus sFLASH_LogAppend(uint8_t* pBuffer, uint8_t NumByte)
+{
+  uint8_t header[sFLASH_LOG_RECORD_HEADER];
+  uint16_t offset = 0, checksum = 0;
+
+  if ((NumByte == 0) || (NumByte > sFLASH_LOG_RECORD_MAX))
+  {
+    return ERROR;
+  }
+
+  if (sFLASHLogOpen == RESET)
+  {
+    sFLASH_LogOpenSector();
+  }
+  else
+  {
+    /*!< A record never crosses a page: end the records of the page if it does
+         not fit in */
+    offset = (uint16_t)(sFLASHLogHead % sFLASH_SPI_PAGESIZE);
+    if ((offset + sFLASH_LOG_RECORD_HEADER + NumByte) > sFLASH_SPI_PAGESIZE)
+    {
+      sFLASH_LogEndPage(sFLASHLogHead);
+      sFLASHLogHead += sFLASH_SPI_PAGESIZE - offset;
+    }
+
+    if (sFLASHLogHead >= (sFLASH_LOG_SECTOR_ADDR(sFLASHLogSector) + sFLASH_LOG_SECTOR_SIZE))
+    {
+      sFLASH_LogOpenSector();
+    }
+  }
+
+  checksum = sFLASH_LogChecksum(NumByte, pBuffer);
+  header[0] = NumByte;
+  header[1] = (uint8_t)(checksum >> 8);
+  header[2] = (uint8_t)checksum;
+
+  /*!< The data first: the record is found once its header is written */
+  sFLASH_WriteBuffer(pBuffer, sFLASHLogHead + sFLASH_LOG_RECORD_HEADER, NumByte);
+  sFLASH_WriteBuffer(header, sFLASHLogHead, sFLASH_LOG_RECORD_HEADER);
+
+  sFLASHLogHead += (uint32_t)sFLASH_LOG_RECORD_HEADER + NumByte;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Erases the sector following the write head, if not yet done, so
+  *         that the append reaching it does not wait for its erase.
+  * @note   The records of this sector, the oldest ones, are lost.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_LogPrepare(void)
+{
+  uint16_t sector = 0;
+
+  if (sFLASHLogPrepared == RESET)
+  {
+    if (sFLASHLogOpen != RESET)
+    {
+      sector = (uint16_t)((sFLASHLogSector + 1) % sFLASH_LOG_SECTOR_NB);
+    }
+
+    sFLASH_EraseSector(sFLASH_LOG_SECTOR_ADDR(sector));
+    sFLASHLogPrepared = SET;
+  }
+}
+
+/**
+  * @brief  Positions the reading of the log on its oldest record.
+  * @param  None
+  * @retval None
+  */
+void sFLASH_LogReadStart(void)
+{
+  uint32_t sequence = 0;
+  uint16_t sector = 0, count = 0;
+
+  sFLASHLogReadSector = sFLASHLogSector;
+  sFLASHLogReadSequence = sFLASHLogSequence;
+
+  /*!< Go back from the head sector while the sequence numbers follow */
+  for (count = 1; count < sFLASH_LOG_SECTOR_NB; count++)
+  {
+    sector = (uint16_t)((sFLASHLogReadSector + sFLASH_LOG_SECTOR_NB - 1) % sFLASH_LOG_SECTOR_NB);
+
+    if ((sFLASH_LogReadHeader(sector, &sequence) == RESET) ||
+        (sequence != (sFLASHLogReadSequence - 1)))
+    {
+      break;
+    }
+
+    sFLASHLogReadSector = sector;
+    sFLASHLogReadSequence = sequence;
+  }
+
+  sFLASHLogReadAddr = sFLASH_LOG_SECTOR_ADDR(sFLASHLogReadSector) + sFLASH_SPI_PAGESIZE;
+}
+
+/**
+  * @brief  Reads the next record of the log.
+  * @param  pBuffer: pointer to the buffer that receives the record, of
+  *         sFLASH_LOG_RECORD_MAX bytes.
+  * @retval Number of bytes of the record, 0 when there is no more record
+  */
+uint8_t sFLASH_LogReadNext(uint8_t* pBuffer)
+{
+  uint8_t header[sFLASH_LOG_RECORD_HEADER];
+  uint32_t sequence = 0;
+  uint16_t sector = 0, offset = 0;
+
+  if (sFLASHLogOpen == RESET)
+  {
+    return 0;
+  }
+
+  while (1)
+  {
+    /*!< End at the write head */
+    if ((sFLASHLogReadSequence == sFLASHLogSequence) && (sFLASHLogReadAddr >= sFLASHLogHead))
+    {
+      return 0;
+    }
+
+    if (sFLASHLogReadAddr >= (sFLASH_LOG_SECTOR_ADDR(sFLASHLogReadSector) + sFLASH_LOG_SECTOR_SIZE))
+    {
+      /*!< Go on in the next sector if it follows this one */
+      sector = (uint16_t)((sFLASHLogReadSector + 1) % sFLASH_LOG_SECTOR_NB);
+      if ((sFLASH_LogReadHeader(sector, &sequence) == RESET) ||
+          (sequence != (sFLASHLogReadSequence + 1)))
+      {
+        return 0;
+      }
+
+      sFLASHLogReadSector = sector;
+      sFLASHLogReadSequence = sequence;
+      sFLASHLogReadAddr = sFLASH_LOG_SECTOR_ADDR(sector) + sFLASH_SPI_PAGESIZE;
+      continue;
+    }
+
+    offset = (uint16_t)(sFLASHLogReadAddr % sFLASH_SPI_PAGESIZE);
+    if (offset <= (sFLASH_SPI_PAGESIZE - sFLASH_LOG_RECORD_HEADER - 1))
+    {
+      sFLASH_ReadBuffer(header, sFLASHLogReadAddr, sFLASH_LOG_RECORD_HEADER);
+    }
+    else
+    {
+      header[0] = sFLASH_LOG_LENGTH_END;
+    }
+
+    if ((header[0] == sFLASH_LOG_LENGTH_FREE) || (header[0] == sFLASH_LOG_LENGTH_END) ||
+        ((offset + sFLASH_LOG_RECORD_HEADER + header[0]) > sFLASH_SPI_PAGESIZE))
+    {
+      /*!< No more records in this page */
+      sFLASHLogReadAddr += sFLASH_SPI_PAGESIZE - offset;
+      continue;
+    }
+
+    sFLASH_ReadBuffer(pBuffer, sFLASHLogReadAddr + sFLASH_LOG_RECORD_HEADER, header[0]);
+    sFLASHLogReadAddr += (uint32_t)sFLASH_LOG_RECORD_HEADER + header[0];
+
+    /*!< Skip the records interrupted by a power loss */
+    if (sFLASH_LogChecksum(header[0], pBuffer) ==
+        (uint16_t)(((uint16_t)header[1] << 8) | header[2]))
+    {
+      return header[0];
+    }
+  }
+}
+
+/**
+  * @brief  Moves the write head to the next sector of the log, erasing it if
+  *         not yet done, and writes its header.
+  * @param  None
+  * @retval None
+  */
+static void sFLASH_LogOpenSector(void)
+{
+  uint8_t header[sFLASH_LOG_SEQUENCE_SIZE];
+  uint32_t addr = 0;
+
+  if (sFLASHLogOpen != RESET)
+  {
+    sFLASHLogSector = (uint16_t)((sFLASHLogSector + 1) % sFLASH_LOG_SECTOR_NB);
+    sFLASHLogSequence++;
+  }
+  else
+  {
+    sFLASHLogSector = 0;
+    sFLASHLogSequence = 0;
+  }
+
+  addr = sFLASH_LOG_SECTOR_ADDR(sFLASHLogSector);
+
+  if (sFLASHLogPrepared == RESET)
+  {
+    sFLASH_EraseSector(addr);
+  }
+  sFLASHLogPrepared = RESET;
+
+  /*!< The sequence number first: the sector is found once 'L' 'G' is written */
+  header[0] = (uint8_t)(sFLASHLogSequence >> 24);
+  header[1] = (uint8_t)(sFLASHLogSequence >> 16);
+  header[2] = (uint8_t)(sFLASHLogSequence >> 8);
+  header[3] = (uint8_t)sFLASHLogSequence;
+  sFLASH_WriteBuffer(header, addr, sFLASH_LOG_SEQUENCE_SIZE);
+
+  header[0] = sFLASH_LOG_MAGIC_0;
+  header[1] = sFLASH_LOG_MAGIC_1;
+  sFLASH_WriteBuffer(header, addr + sFLASH_LOG_SEQUENCE_SIZE, 2);
+
+  sFLASHLogHead = addr + sFLASH_SPI_PAGESIZE;
+  sFLASHLogOpen = SET;
+}
+
+/**
+  * @brief  Finds the write head in the sector holding it.
+  * @note   The pages of a sector are used in order: the first byte of the
+  *         pages used is not erased.
+  * @param  SectorAddr: FLASH address of the sector.
+  * @retval FLASH address of the next record
+  */
+static uint32_t sFLASH_LogRecover(uint32_t SectorAddr)
+{
+  uint32_t head = 0, page = 0;
+  uint16_t low = 1, high = sFLASH_LOG_PAGE_NB, middle = 0, offset = 0;
+  uint8_t length = 0;
+
+  /*!< Binary search of the first free page */
+  while (low < high)
+  {
+    middle = (uint16_t)((low + high) / 2);
+    sFLASH_ReadBuffer(&length, SectorAddr + ((uint32_t)middle * sFLASH_SPI_PAGESIZE), 1);
+    if (length == sFLASH_LOG_LENGTH_FREE)
+    {
+      high = middle;
+    }
+    else
+    {
+      low = (uint16_t)(middle + 1);
+    }
+  }
+  head = SectorAddr + ((uint32_t)low * sFLASH_SPI_PAGESIZE);
+
+  if (low > 1)
+  {
+    /*!< Follow the records of the last page used up to the first free byte */
+    page = head - sFLASH_SPI_PAGESIZE;
+    offset = 0;
+    length = sFLASH_LOG_LENGTH_END;
+    while (offset <= (sFLASH_SPI_PAGESIZE - sFLASH_LOG_RECORD_HEADER - 1))
+    {
+      sFLASH_ReadBuffer(&length, page + offset, 1);
+      if ((length == sFLASH_LOG_LENGTH_FREE) || (length == sFLASH_LOG_LENGTH_END) ||
+          ((offset + sFLASH_LOG_RECORD_HEADER + length) > sFLASH_SPI_PAGESIZE))
+      {
+        break;
+      }
+      offset += (uint16_t)(sFLASH_LOG_RECORD_HEADER + length);
+    }
+
+    if ((offset <= (sFLASH_SPI_PAGESIZE - sFLASH_LOG_RECORD_HEADER - 1)) &&
+        (length == sFLASH_LOG_LENGTH_FREE))
+    {
+      /*!< Go on in this page unless the rest of it was being written */
+      if (sFLASH_LogIsBlank(page + offset, (uint16_t)(sFLASH_SPI_PAGESIZE - offset)) != RESET)
+      {
+        return page + offset;
+      }
+      sFLASH_LogEndPage(page + offset);
+    }
+  }
+
+  /*!< A page being written at the power loss may have its first byte free */
+  while ((head < (SectorAddr + sFLASH_LOG_SECTOR_SIZE)) &&
+         (sFLASH_LogIsBlank(head, sFLASH_SPI_PAGESIZE) == RESET))
+  {
+    sFLASH_LogEndPage(head);
+    head += sFLASH_SPI_PAGESIZE;
+  }
+
+  return head;
+}
+
+/**
+  * @brief  Reads the header of a sector of the log.
+  * @param  Sector: sector of the log, from 0 to sFLASH_LOG_SECTOR_NB - 1.
+  * @param  Sequence: pointer to the variable that receives its sequence number.
+  * @retval SET if the sector header is valid, RESET otherwise
+  */
+static FlagStatus sFLASH_LogReadHeader(uint16_t Sector, uint32_t* Sequence)
+{
+  uint8_t header[sFLASH_LOG_SEQUENCE_SIZE + 2];
+
+  sFLASH_ReadBuffer(header, sFLASH_LOG_SECTOR_ADDR(Sector), sFLASH_LOG_SEQUENCE_SIZE + 2);
+
+  if ((header[sFLASH_LOG_SEQUENCE_SIZE] != sFLASH_LOG_MAGIC_0) ||
+      (header[sFLASH_LOG_SEQUENCE_SIZE + 1] != sFLASH_LOG_MAGIC_1))
+  {
+    return RESET;
+  }
+
+  *Sequence = ((uint32_t)header[0] << 24) | ((uint32_t)header[1] << 16) |
+              ((uint32_t)header[2] << 8) | header[3];
+
+  return SET;
+}
+
+/**
+  * @brief  Checks that a FLASH area is erased.
+  * @param  Addr: FLASH address of the area.
+  * @param  NumByte: number of bytes of the area.
+  * @retval SET if all the bytes are erased, RESET otherwise
+  */
+static FlagStatus sFLASH_LogIsBlank(uint32_t Addr, uint16_t NumByte)
+{
+  uint8_t buffer[16];
+  uint8_t count = 0, index = 0;
+
+  while (NumByte != 0)
+  {
+    count = (uint8_t)((NumByte > sizeof(buffer)) ? sizeof(buffer) : NumByte);
+    sFLASH_ReadBuffer(buffer, Addr, count);
+
+    for (index = 0; index < count; index++)
+    {
+      if (buffer[index] != 0xFF)
+      {
+        return RESET;
+      }
+    }
+
+    Addr += count;
+    NumByte -= count;
+  }
+
+  return SET;
+}
+
+/**
+  * @brief  Ends the records of a page: writes a 0x00 length, whatever the
+  *         byte already written there.
+  * @param  Addr: FLASH address of the first byte not used by the records.
+  * @retval None
+  */
+static void sFLASH_LogEndPage(uint32_t Addr)
+{
+  uint8_t length = sFLASH_LOG_LENGTH_END;
+
+  sFLASH_WriteBuffer(&length, Addr, 1);
+}
+
+/**
+  * @brief  Computes the Fletcher-16 checksum of a record.
+  * @param  Length: number of bytes of the record.
+  * @param  pBuffer: pointer to the record data.
+  * @retval Checksum, second sum in the MSB
+  */
+static uint16_t sFLASH_LogChecksum(uint8_t Length, uint8_t* pBuffer)
+{
+  uint16_t sum1 = Length, sum2 = Length;
+  uint8_t index = 0;
+
+  for (index = 0; index < Length; index++)
+  {
+    sum1 = (uint16_t)((sum1 + pBuffer[index]) % 255);
+    sum2 = (uint16_t)((sum2 + sum1) % 255);
+  }
+
+  return (uint16_t)((sum2 << 8) | sum1);
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
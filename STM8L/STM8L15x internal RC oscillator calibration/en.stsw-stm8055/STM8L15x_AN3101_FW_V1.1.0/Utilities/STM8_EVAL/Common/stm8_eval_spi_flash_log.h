@@ -0,0 +1,106 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_spi_flash_log.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header for stm8_eval_spi_flash_log.c module
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8_EVAL_SPI_FLASH_LOG_H
+#define __STM8_EVAL_SPI_FLASH_LOG_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_spi_flash.h"
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_SPI_FLASH_LOG
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Exported_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Exported_Constants
+  * @{
+  */
+/**
+  * @brief  FLASH area of the log: sFLASH_LOG_SECTOR_NB sectors from
+  *         sFLASH_LOG_START_ADDR (whole M25P64 of the STM8L15x-EVAL boards)
+  */
+#define sFLASH_LOG_START_ADDR     ((uint32_t)0x000000)
+#define sFLASH_LOG_SECTOR_SIZE    ((uint32_t)0x10000)
+#define sFLASH_LOG_SECTOR_NB      ((uint16_t)128)
+
+/* Bytes of a record header: length and Fletcher-16 checksum */
+#define sFLASH_LOG_RECORD_HEADER  3
+
+/* Largest record: a record never crosses a FLASH page */
+#define sFLASH_LOG_RECORD_MAX     ((uint8_t)(sFLASH_SPI_PAGESIZE - sFLASH_LOG_RECORD_HEADER))
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_SPI_FLASH_LOG_Exported_Functions
+  * @{
+  */
+void sFLASH_LogInit(void);
+ErrorStatus sFLASH_LogAppend(uint8_t* pBuffer, uint8_t NumByte);
+void sFLASH_LogPrepare(void);
+void sFLASH_LogReadStart(void);
+uint8_t sFLASH_LogReadNext(uint8_t* pBuffer);
+
+#endif /* __STM8_EVAL_SPI_FLASH_LOG_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
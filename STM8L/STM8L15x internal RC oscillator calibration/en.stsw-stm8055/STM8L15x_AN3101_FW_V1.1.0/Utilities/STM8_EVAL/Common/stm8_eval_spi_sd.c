@@ -16,6 +16,55 @@
   *          by just adapting the defines for hardware resources and
   *          SD_LowLevel_Init() function.
   *
+  *          @note When SD_USE_DMA is defined in stm8xx_eval.h, long sequential
+  *                reads and writes should use the streams: the blocks are
+  *                transferred by the DMA between the card and two block
+  *                buffers of the driver, the application using one buffer
+  *                while the other one is transferred.
+  *                - SD_StreamReadStart() starts a multiple block read, then
+  *                  each SD_StreamReadGetBlock() returns the next block read,
+  *                  or 0 while it is not read yet, and gives the previous one
+  *                  back to the driver. SD_StreamReadStop() ends the read.
+  *                  When 0 is returned, SD_StreamGetStatus() tells whether
+  *                  the stream failed and must be ended.
+  *                - SD_StreamWriteStart() starts a multiple block write, then
+  *                  the application fills the buffer returned by
+  *                  SD_StreamWriteGetBuffer(), 0 while both buffers are being
+  *                  written, and writes it with SD_StreamWriteBlock().
+  *                  SD_StreamWriteStop() waits for the blocks and ends the
+  *                  write.
+  *                The data tokens, CRC and data responses are handled in the
+  *                DMA interrupt handlers, by the mean of
+  *                SD_SPI_DMA_RX_IRQHandler() and SD_SPI_DMA_TX_IRQHandler()
+  *                to be called in the interrupt handlers of the
+  *                SD_SPI_DMA_CHANNEL_RX and SD_SPI_DMA_CHANNEL_TX channels.
+  *                SD_StreamTick() should be called periodically (from a timer
+  *                interrupt routine for instance): it looks for the data
+  *                token of the next block to read, or for the end of the
+  *                programming of the block written, reading at most
+  *                SD_STREAM_POLL_NB bytes.
+  *                The card stays selected during a stream: the other SD
+  *                functions, and the sFLASH ones on the boards sharing the
+  *                SPI, must not be called before its end.
+  *
+  *          @note When SD_USE_STATISTICS is defined in stm8_eval_spi_sd.h,
+  *                the driver counts the commands sent, the blocks read and
+  *                written, and the bytes read waiting for the card. Read by
+  *                SD_GetStatistics() before and after a workload, they give
+  *                its command overhead per block and the access and busy
+  *                times of the card, to compare the single and multiple
+  *                block transfers or the stream and SPI clock options.
+  *
+  *          @note When SD_USE_CRC is defined in stm8_eval_spi_sd.h, the card
+  *                checks the CRC of the commands and of the blocks written,
+  *                and the driver the CRC of the blocks read, returning
+  *                SD_DATA_CRC_ERROR for a corrupted block. The SPI CRC unit,
+  *                8-bit only, computes the CRC7 of the commands as they are
+  *                sent. The CRC16 of the blocks is computed with a table, each
+  *                byte while the SPI shifts the next one. The CRC16 of the
+  *                stream blocks, transferred by the DMA, is computed by
+  *                SD_StreamWriteBlock() and checked by SD_StreamReadGetBlock().
+  *
   *          +-------------------------------------------------------+
   *          |                     Pin assignment                    |
   *          +-------------------------+---------------+-------------+
@@ -73,6 +122,40 @@
 /** @defgroup STM8_EVAL_SPI_SD_Private_Defines
   * @{
   */
+/* CMD8 argument: 2.7-3.6 V supply and check pattern, echoed in the R7 response */
+#define SD_CHECK_PATTERN       ((uint32_t)0x000001AA)
+
+/* ACMD41 argument: the host supports the high capacity cards (HCS) */
+#define SD_HIGH_CAPACITY       ((uint32_t)0x40000000)
+
+/* OCR bit giving the high capacity cards (CCS), in the first OCR byte */
+#define SD_OCR_CCS             ((uint8_t)0x40)
+
+/* Number of ACMD41 or CMD1 sent before the card leaves the idle state: about
+   two seconds with the identification SPI clock */
+#define SD_INIT_TRIALS         ((uint16_t)0x1000)
+
+/* Number of bytes read before the R1 response of a command is got */
+#define SD_R1_TIMEOUT          ((uint8_t)16)
+
+/* SPI CRC polynomial x^8 + x^4 + x: x times the CRC7 polynomial of the
+   commands, x^7 + x^3 + 1. The SPI CRC unit then gives the CRC7 shifted left
+   by one bit, as in the last byte of a command */
+#define SD_CRC7_POLYNOMIAL     ((uint8_t)0x12)
+
+#ifdef SD_USE_DMA
+/* Largest DMA transfer, the blocks are split */
+#define SD_DMA_MAX_SIZE        ((uint16_t)0xFF)
+
+/* State of the streams */
+#define SD_STREAM_STOPPED      ((uint8_t)0x00) /*!< No stream in progress */
+#define SD_STREAM_RX_TOKEN     ((uint8_t)0x01) /*!< Data token of the next block looked for */
+#define SD_STREAM_RX_DATA      ((uint8_t)0x02) /*!< Block received by the DMA */
+#define SD_STREAM_TX_WAIT      ((uint8_t)0x03) /*!< Waiting for a block to write */
+#define SD_STREAM_TX_DATA      ((uint8_t)0x04) /*!< Block transmitted by the DMA */
+#define SD_STREAM_TX_BUSY      ((uint8_t)0x05) /*!< Card programming the block */
+#define SD_STREAM_ERROR        ((uint8_t)0x06) /*!< Stream failed */
+#endif /* SD_USE_DMA */
 /**
   * @}
   */
@@ -80,6 +163,23 @@
 /** @defgroup STM8_EVAL_SPI_SD_Private_Macros
   * @{
   */
+#ifdef SD_USE_CRC
+/**
+  * @brief  CRC16 (x^16 + x^12 + x^5 + 1) of the data blocks, updated with a
+  *         byte
+  */
+#define SD_CRC16_UPDATE(Crc, Byte) \
+  ((uint16_t)((uint16_t)(Crc) << 8) ^ SDCRC16Table[(uint8_t)((Crc) >> 8) ^ (uint8_t)(Byte)])
+#endif /* SD_USE_CRC */
+
+/**
+  * @brief  Adds a value to a counter of the card accesses
+  */
+#ifdef SD_USE_STATISTICS
+#define SD_STATISTICS_ADD(Counter, Value)  (SDStatistics.Counter += (Value))
+#else
+#define SD_STATISTICS_ADD(Counter, Value)
+#endif /* SD_USE_STATISTICS */
 /**
   * @}
   */
@@ -88,6 +188,76 @@
 /** @defgroup STM8_EVAL_SPI_SD_Private_Variables
   * @{
   */
+static uint8_t SD_CardType = SD_CARD_UNKNOWN;
+
+#ifdef SD_USE_CRC
+/* SPI clock of the SD, to configure the CRC unit again after the sFLASH
+   driver on the same SPI */
+static SPI_BaudRatePrescaler_TypeDef SDSPIPrescaler = SD_SPI_BAUDRATE_INIT;
+
+/* CRC16 of the bytes 0 to 255 */
+static const uint16_t SDCRC16Table[256] =
+{
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+  0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+  0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+  0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+  0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+  0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+  0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+  0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+  0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+  0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+  0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+  0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+  0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+  0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+  0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+  0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+  0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+  0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+  0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+  0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+  0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+  0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+  0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+  0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+  0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+  0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+  0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+  0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+  0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+  0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+  0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+#endif /* SD_USE_CRC */
+
+#ifdef SD_USE_DMA
+/* Stream buffers: the application owns the (SDStreamIn - SDStreamOut) blocks
+   read, from SDStreamOut, or writes into SDStreamIn while the card writes
+   from SDStreamOut. Each counter is only incremented on one side */
+static uint8_t SDStreamBuffer[2][SD_BLOCK_SIZE];
+static __IO uint8_t SDStreamIn = 0;
+static __IO uint8_t SDStreamOut = 0;
+static FlagStatus SDStreamHeld = RESET;          /* Block read owned by the application */
+static __IO uint8_t SDStreamState = SD_STREAM_STOPPED;
+static __IO FlagStatus SDStreamStop = RESET;     /* End of stream requested */
+static __IO uint16_t SDStreamTime = 0;           /* SD_StreamTick() calls without progress */
+#ifdef SD_USE_CRC
+static uint16_t SDStreamCRC[2];                  /* CRC16 of the stream buffers */
+static FlagStatus SDStreamCRCError = RESET;      /* Block read corrupted */
+#endif /* SD_USE_CRC */
+
+/* DMA transfer of the current block */
+static uint8_t* SDDataPointer;                   /* Buffer of the next DMA transfer */
+static uint16_t SDDataNum = 0;                   /* Bytes after the current transfer */
+static uint8_t SDDataDirection = SD_DIRECTION_RX;
+#endif /* SD_USE_DMA */
+
+#ifdef SD_USE_STATISTICS
+static SD_Statistics_TypeDef SDStatistics;
+#endif /* SD_USE_STATISTICS */
 /**
   * @}
   */
@@ -96,6 +266,29 @@
 /** @defgroup STM8_EVAL_SPI_SD_Private_Function_Prototypes
   * @{
   */
+static uint8_t SD_SendCmdR1(uint8_t Cmd, uint32_t Arg, uint8_t Crc);
+static uint8_t SD_ReadResponse(void);
+static uint32_t SD_BlockAddress(uint32_t Addr);
+static uint32_t SD_SectorAddress(uint32_t Sector);
+static uint8_t SD_ReadBlockAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize);
+static uint8_t SD_ReadMultiBlocksAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize, uint32_t NumberOfBlocks);
+static uint8_t SD_WriteBlockAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize);
+static uint8_t SD_WriteMultiBlocksAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize, uint32_t NumberOfBlocks);
+static void SD_SPIConfig(SPI_BaudRatePrescaler_TypeDef SPI_BaudRatePrescaler);
+static uint8_t SD_ReceiveData(uint8_t* pBuffer, uint16_t NumByte);
+static void SD_SendData(uint8_t* pBuffer, uint16_t NumByte);
+#ifdef SD_USE_DMA
+#ifdef SD_USE_CRC
+static uint16_t SD_CRC16(uint8_t* pBuffer, uint16_t NumByte);
+#endif /* SD_USE_CRC */
+static void SD_StreamNext(void);
+static void SD_StreamPollToken(void);
+static void SD_StreamPollBusy(void);
+static void SD_StreamEndBlock(void);
+static void SD_DMAStart(uint8_t* pBuffer, uint8_t Direction);
+static void SD_DMATransfer(void);
+static void SD_DMAComplete(void);
+#endif /* SD_USE_DMA */
 /**
   * @}
   */
@@ -125,12 +318,16 @@ void SD_DeInit(void)
 uint8_t SD_Init(void)
 {
   uint32_t i = 0;
+  uint8_t rvalue = SD_RESPONSE_FAILURE;
 
-  /*!< Initialize SD_SPI */
+  /*!< Initialize SD_SPI, with the identification clock */
   SD_LowLevel_Init();
+#ifdef SD_USE_CRC
+  SDSPIPrescaler = SD_SPI_BAUDRATE_INIT;
+#endif /* SD_USE_CRC */
 
   /*!< SD chip select high */
-  SD_CS_LOW();
+  SD_CS_HIGH();
 
   /*!< Send dummy byte 0xFF, 10 times with CS high */
   /*!< Rise CS and MOSI for 80 clocks cycles */
@@ -141,7 +338,15 @@ uint8_t SD_Init(void)
   }
   /*------------Put SD in SPI mode--------------*/
   /*!< SD initialized and set to SPI mode properly */
-  return (SD_GoIdleState());
+  rvalue = SD_GoIdleState();
+
+  if (rvalue == SD_RESPONSE_NO_ERROR)
+  {
+    /*!< The data is transferred with the fastest SPI clock */
+    SD_SPIConfig(SD_SPI_BAUDRATE_TRANSFER);
+  }
+
+  return rvalue;
 }
 
 /**
@@ -161,6 +366,21 @@ uint8_t SD_Detect(void)
   return status;
 }
 
+/**
+  * @brief  Returns the type of the card initialized by SD_Init().
+  * @param  None
+  * @retval The card type:
+  *         - SD_CARD_UNKNOWN: no card initialized
+  *         - SD_CARD_MMC: MultiMediaCard
+  *         - SD_CARD_STD_CAPACITY_V1: SD card version 1.x
+  *         - SD_CARD_STD_CAPACITY_V2: SD card version 2.0, standard capacity
+  *         - SD_CARD_HIGH_CAPACITY: SDHC or SDXC card
+  */
+uint8_t SD_GetCardType(void)
+{
+  return SD_CardType;
+}
+
 /**
   * @brief  Returns information about specific card.
   * @param  cardinfo: pointer to a SD_CardInfo structure that contains all SD
@@ -175,10 +395,33 @@ uint8_t SD_GetCardInfo(SD_CardInfo *cardinfo)
 
   status = SD_GetCSDRegister(&(cardinfo->SD_csd));
   status = SD_GetCIDRegister(&(cardinfo->SD_cid));
-  cardinfo->CardCapacity = (cardinfo->SD_csd.DeviceSize + 1) ;
-  cardinfo->CardCapacity *= (1 << (cardinfo->SD_csd.DeviceSizeMul + 2));
-  cardinfo->CardBlockSize = 1 << (cardinfo->SD_csd.RdBlockLen);
-  cardinfo->CardCapacity *= cardinfo->CardBlockSize;
+
+  if (cardinfo->SD_csd.CSDStruct == 1)
+  {
+    /*!< CSD version 2.0 (SDHC, SDXC): device size in units of 512 Kbytes */
+    cardinfo->CardBlockSize = SD_BLOCK_SIZE;
+    cardinfo->CardBlockNb = (cardinfo->SD_csd.DeviceSize + 1) << 10;
+
+    /*!< The capacity in bytes is limited to 32 bits */
+    if (cardinfo->CardBlockNb >= ((uint32_t)0x800000))
+    {
+      cardinfo->CardCapacity = 0xFFFFFFFF;
+    }
+    else
+    {
+      cardinfo->CardCapacity = cardinfo->CardBlockNb << 9;
+    }
+  }
+  else
+  {
+    /*!< CSD version 1.0 */
+    cardinfo->CardCapacity = (cardinfo->SD_csd.DeviceSize + 1) ;
+    cardinfo->CardCapacity *= (1 << (cardinfo->SD_csd.DeviceSizeMul + 2));
+    cardinfo->CardBlockSize = 1 << (cardinfo->SD_csd.RdBlockLen);
+    cardinfo->CardCapacity *= cardinfo->CardBlockSize;
+    cardinfo->CardBlockNb = cardinfo->CardCapacity / SD_BLOCK_SIZE;
+  }
+  cardinfo->CardType = SD_CardType;
 
   /*!< Returns the reponse */
   return status;
@@ -192,18 +435,35 @@ uint8_t SD_GetCardInfo(SD_CardInfo *cardinfo)
   * @param  BlockSize: the SD card Data block size.
   * @retval The SD Response:
   *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
   *         - SD_RESPONSE_NO_ERROR: Sequence succeed
   */
 uint8_t SD_ReadBlock(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize)
 {
-  uint32_t i = 0;
+  return SD_ReadBlockAt(pBuffer, SD_BlockAddress(ReadAddr), BlockSize);
+}
+
+/**
+  * @brief  Reads a block of data from the SD, at a command address.
+  * @param  pBuffer: pointer to the buffer that receives the data read from the
+  *                  SD.
+  * @param  CmdAddr: address of the command, in blocks for the high capacity
+  *         cards (SD_BlockAddress() or SD_SectorAddress()).
+  * @param  BlockSize: the SD card Data block size.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+static uint8_t SD_ReadBlockAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize)
+{
   uint8_t rvalue = SD_RESPONSE_FAILURE;
 
   /*!< SD chip select low */
   SD_CS_LOW();
 
   /*!< Send CMD17 (SD_CMD_READ_SINGLE_BLOCK) to read one block */
-  SD_SendCmd(SD_CMD_READ_SINGLE_BLOCK, ReadAddr, 0xFF);
+  SD_SendCmd(SD_CMD_READ_SINGLE_BLOCK, CmdAddr, 0xFF);
 
   /*!< Check if the SD acknowledged the read block command: R1 response (0x00: no errors) */
   if (!SD_GetResponse(SD_RESPONSE_NO_ERROR))
@@ -211,20 +471,99 @@ uint8_t SD_ReadBlock(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize)
     /*!< Now look for the data token to signify the start of the data */
     if (!SD_GetResponse(SD_START_DATA_SINGLE_BLOCK_READ))
     {
-      /*!< Read the SD block data : read NumByteToRead data */
-      for (i = 0; i < BlockSize; i++)
+      /*!< Read the SD block data : read BlockSize data, then its CRC */
+      rvalue = SD_ReceiveData(pBuffer, BlockSize);
+    }
+  }
+  /*!< SD chip select high */
+  SD_CS_HIGH();
+
+  /*!< Send dummy byte: 8 Clock pulses of delay */
+  SD_WriteByte(SD_DUMMY_BYTE);
+
+  /*!< Returns the reponse */
+  return rvalue;
+
+}
+
+/**
+  * @brief  Reads many consecutive blocks from the SD with a single read
+  *         command (READ_MULTIPLE_BLOCK), ended by STOP_TRANSMISSION.
+  * @param  pBuffer: pointer to the buffer that receives the data read from the
+  *                  SD.
+  * @param  ReadAddr: SD's internal address to read from.
+  * @param  BlockSize: the SD card Data block size.
+  * @param  NumberOfBlocks: number of blocks to be read.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_ReadMultiBlocks(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize, uint32_t NumberOfBlocks)
+{
+  return SD_ReadMultiBlocksAt(pBuffer, SD_BlockAddress(ReadAddr), BlockSize, NumberOfBlocks);
+}
+
+/**
+  * @brief  Reads many consecutive blocks from the SD, at a command address,
+  *         with a single read command (READ_MULTIPLE_BLOCK), ended by
+  *         STOP_TRANSMISSION.
+  * @param  pBuffer: pointer to the buffer that receives the data read from the
+  *                  SD.
+  * @param  CmdAddr: address of the command, in blocks for the high capacity
+  *         cards (SD_BlockAddress() or SD_SectorAddress()).
+  * @param  BlockSize: the SD card Data block size.
+  * @param  NumberOfBlocks: number of blocks to be read.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+static uint8_t SD_ReadMultiBlocksAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize, uint32_t NumberOfBlocks)
+{
+  uint8_t rvalue = SD_RESPONSE_FAILURE;
+
+  /*!< SD chip select low */
+  SD_CS_LOW();
+
+  /*!< Send CMD18 (SD_CMD_READ_MULT_BLOCK) to read the blocks */
+  SD_SendCmd(SD_CMD_READ_MULT_BLOCK, CmdAddr, 0xFF);
+
+  /*!< Check if the SD acknowledged the read command: R1 response (0x00: no errors) */
+  if (!SD_GetResponse(SD_RESPONSE_NO_ERROR))
+  {
+    rvalue = SD_RESPONSE_NO_ERROR;
+
+    while (NumberOfBlocks--)
+    {
+      /*!< Now look for the data token to signify the start of the data */
+      if (SD_GetResponse(SD_START_DATA_MULTIPLE_BLOCK_READ))
       {
-        /*!< Save the received data */
-        *pBuffer = SD_ReadByte();
+        rvalue = SD_RESPONSE_FAILURE;
+        break;
+      }
 
-        /*!< Point to the next location where the byte read will be saved */
-        pBuffer++;
+      /*!< Read the SD block data : read BlockSize data, then its CRC */
+      rvalue = SD_ReceiveData(pBuffer, BlockSize);
+      if (rvalue != SD_RESPONSE_NO_ERROR)
+      {
+        break;
       }
-      /*!< Get CRC bytes (not really needed by us, but required by SD) */
-      SD_ReadByte();
-      SD_ReadByte();
-      /*!< Set response value to success */
-      rvalue = SD_RESPONSE_NO_ERROR;
+      pBuffer += BlockSize;
+    }
+
+    /*!< Send CMD12 (SD_CMD_STOP_TRANSMISSION) to end the read */
+    SD_SendCmd(SD_CMD_STOP_TRANSMISSION, 0, 0xFF);
+    /*!< Skip the stuff byte sent by the SD after CMD12 */
+    SD_ReadByte();
+    if (SD_GetResponse(SD_RESPONSE_NO_ERROR))
+    {
+      rvalue = SD_RESPONSE_FAILURE;
+    }
+    /*!< Wait while the SD is busy */
+    while (SD_ReadByte() == 0)
+    {
+      SD_STATISTICS_ADD(BusyNb, 1);
     }
   }
   /*!< SD chip select high */
@@ -235,7 +574,6 @@ uint8_t SD_ReadBlock(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize)
 
   /*!< Returns the reponse */
   return rvalue;
-
 }
 
 /**
@@ -245,15 +583,23 @@ uint8_t SD_ReadBlock(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize)
   * @param  NumByteToRead : number of bytes to read from the SD.
   * @retval SD Response:
   *   - SD_RESPONSE_FAILURE: Sequence failed.
+  *   - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC).
   *   - SD_RESPONSE_NO_ERROR: Sequence succeed.
   */
 uint8_t SD_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead)
 {
-  uint32_t i = 0, NbrOfBlock = 0, Offset = 0;
+  uint32_t NbrOfBlock = 0, Offset = 0;
   uint8_t rvalue = SD_RESPONSE_FAILURE;
 
   /* Calculate number of blocks to read */
   NbrOfBlock = NumByteToRead / SD_BLOCK_SIZE;
+
+  /* Many blocks are read with a single command */
+  if (NbrOfBlock > 1)
+  {
+    return SD_ReadMultiBlocks(pBuffer, ReadAddr, SD_BLOCK_SIZE, NbrOfBlock);
+  }
+
   /* SD chip select low */
   SD_CS_LOW();
 
@@ -261,7 +607,7 @@ uint8_t SD_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRea
   while (NbrOfBlock --)
   {
     /* Send CMD17 (SD_READ_SINGLE_BLOCK) to read one block */
-    SD_SendCmd (SD_CMD_READ_SINGLE_BLOCK, ReadAddr + Offset, 0xFF);
+    SD_SendCmd (SD_CMD_READ_SINGLE_BLOCK, SD_BlockAddress(ReadAddr + Offset), 0xFF);
     /* Check if the SD acknowledged the read block command: R1 response (0x00: no errors) */
     if (SD_GetResponse(SD_RESPONSE_NO_ERROR))
     {
@@ -270,21 +616,11 @@ uint8_t SD_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRea
     /* Now look for the data token to signify the start of the data */
     if (!SD_GetResponse(SD_START_DATA_SINGLE_BLOCK_READ))
     {
-      /* Read the SD block data : read NumByteToRead data */
-      for (i = 0; i < SD_BLOCK_SIZE; i++)
-      {
-        /* Read the pointed data */
-        *pBuffer = SD_ReadByte();
-        /* Point to the next location where the byte read will be saved */
-        pBuffer++;
-      }
+      /* Read the SD block data : read SD_BLOCK_SIZE data, then its CRC */
+      rvalue = SD_ReceiveData(pBuffer, SD_BLOCK_SIZE);
+      pBuffer += SD_BLOCK_SIZE;
       /* Set next read address*/
       Offset += 512;
-      /* get CRC bytes (not really needed by us, but required by SD) */
-      SD_ReadByte();
-      SD_ReadByte();
-      /* Set response value to success */
-      rvalue = SD_RESPONSE_NO_ERROR;
     }
     else
     {
@@ -313,14 +649,29 @@ uint8_t SD_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRea
   */
 uint8_t SD_WriteBlock(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize)
 {
-  uint32_t i = 0;
+  return SD_WriteBlockAt(pBuffer, SD_BlockAddress(WriteAddr), BlockSize);
+}
+
+/**
+  * @brief  Writes a block on the SD, at a command address.
+  * @param  pBuffer: pointer to the buffer containing the data to be written on
+  *                  the SD.
+  * @param  CmdAddr: address of the command, in blocks for the high capacity
+  *         cards (SD_BlockAddress() or SD_SectorAddress()).
+  * @param  BlockSize: the SD card Data block size.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+static uint8_t SD_WriteBlockAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize)
+{
   uint8_t rvalue = SD_RESPONSE_FAILURE;
 
   /*!< SD chip select low */
   SD_CS_LOW();
 
   /*!< Send CMD24 (SD_CMD_WRITE_SINGLE_BLOCK) to write multiple block */
-  SD_SendCmd(SD_CMD_WRITE_SINGLE_BLOCK, WriteAddr, 0xFF);
+  SD_SendCmd(SD_CMD_WRITE_SINGLE_BLOCK, CmdAddr, 0xFF);
 
   /*!< Check if the SD acknowledged the write block command: R1 response (0x00: no errors) */
   if (!SD_GetResponse(SD_RESPONSE_NO_ERROR))
@@ -331,31 +682,119 @@ uint8_t SD_WriteBlock(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize)
     /*!< Send the data token to signify the start of the data */
     SD_WriteByte(0xFE);
 
-    /*!< Write the block data to SD : write count data by block */
-    for (i = 0; i < BlockSize; i++)
+    /*!< Write the block data to SD, completed by DUMMY bytes when the number
+         of data to be written are lower than the SD card BLOCK size (512
+         Byte), then its CRC */
+    SD_SendData(pBuffer, BlockSize);
+
+    /*!< Read data response */
+    if (SD_GetDataResponse() == SD_DATA_OK)
     {
-      /*!< Send the pointed byte */
-      SD_WriteByte(*pBuffer);
-      /*!< Point to the next location where the byte read will be saved */
-      pBuffer++;
+      rvalue = SD_RESPONSE_NO_ERROR;
     }
+  }
+  /*!< SD chip select high */
+  SD_CS_HIGH();
+  /*!< Send dummy byte: 8 Clock pulses of delay */
+  SD_WriteByte(SD_DUMMY_BYTE);
+
+  /*!< Returns the reponse */
+  return rvalue;
+
+}
+
+
+/**
+  * @brief  Writes many consecutive blocks on the SD with a single write
+  *         command (WRITE_MULTIPLE_BLOCK), ended by the stop token.
+  * @note   When SD_USE_PRE_ERASE is defined, the number of blocks is first
+  *         sent to the SD (SET_WR_BLK_ERASE_COUNT) so that it may erase them
+  *         beforehand. A card not supporting it just writes the blocks.
+  * @param  pBuffer: pointer to the buffer containing the data to be written on
+  *                  the SD.
+  * @param  WriteAddr: address to write on.
+  * @param  BlockSize: the SD card Data block size.
+  * @param  NumberOfBlocks: number of blocks to be written.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_WriteMultiBlocks(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize, uint32_t NumberOfBlocks)
+{
+  return SD_WriteMultiBlocksAt(pBuffer, SD_BlockAddress(WriteAddr), BlockSize, NumberOfBlocks);
+}
+
+/**
+  * @brief  Writes many consecutive blocks on the SD, at a command address,
+  *         with a single write command (WRITE_MULTIPLE_BLOCK), ended by the
+  *         stop token.
+  * @note   When SD_USE_PRE_ERASE is defined, the number of blocks is first
+  *         sent to the SD (SET_WR_BLK_ERASE_COUNT) so that it may erase them
+  *         beforehand. A card not supporting it just writes the blocks.
+  * @param  pBuffer: pointer to the buffer containing the data to be written on
+  *                  the SD.
+  * @param  CmdAddr: address of the command, in blocks for the high capacity
+  *         cards (SD_BlockAddress() or SD_SectorAddress()).
+  * @param  BlockSize: the SD card Data block size.
+  * @param  NumberOfBlocks: number of blocks to be written.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+static uint8_t SD_WriteMultiBlocksAt(uint8_t* pBuffer, uint32_t CmdAddr, uint16_t BlockSize, uint32_t NumberOfBlocks)
+{
+  uint8_t rvalue = SD_RESPONSE_FAILURE;
+
+  /*!< SD chip select low */
+  SD_CS_LOW();
+
+#ifdef SD_USE_PRE_ERASE
+  /*!< Send CMD55 (SD_CMD_APP_CMD) then ACMD23 (SD_ACMD_SET_WR_BLK_ERASE_COUNT)
+       with the number of blocks to write */
+  SD_SendCmd(SD_CMD_APP_CMD, 0, 0xFF);
+  SD_GetResponse(SD_RESPONSE_NO_ERROR);
+  SD_WriteByte(SD_DUMMY_BYTE);
+  SD_SendCmd(SD_ACMD_SET_WR_BLK_ERASE_COUNT, NumberOfBlocks, 0xFF);
+  SD_GetResponse(SD_RESPONSE_NO_ERROR);
+  SD_WriteByte(SD_DUMMY_BYTE);
+#endif /* SD_USE_PRE_ERASE */
+
+  /*!< Send CMD25 (SD_CMD_WRITE_MULT_BLOCK) to write the blocks */
+  SD_SendCmd(SD_CMD_WRITE_MULT_BLOCK, CmdAddr, 0xFF);
+
+  /*!< Check if the SD acknowledged the write command: R1 response (0x00: no errors) */
+  if (!SD_GetResponse(SD_RESPONSE_NO_ERROR))
+  {
+    rvalue = SD_RESPONSE_NO_ERROR;
 
-    /* Send DUMMY bytes when the number of data to be written are lower
-       than the SD card BLOCK size (512 Byte) */
-    for (; i != SD_BLOCK_SIZE; i++)
+    while (NumberOfBlocks--)
     {
-      /* Send the pointed byte */
+      /*!< Send a dummy byte */
       SD_WriteByte(SD_DUMMY_BYTE);
+
+      /*!< Send the data token to signify the start of the data */
+      SD_WriteByte(SD_START_DATA_MULTIPLE_BLOCK_WRITE);
+
+      /*!< Write the block data to SD : write BlockSize data, then its CRC */
+      SD_SendData(pBuffer, BlockSize);
+      pBuffer += BlockSize;
+
+      /*!< Read data response, the SD being no more busy on return */
+      if (SD_GetDataResponse() != SD_DATA_OK)
+      {
+        rvalue = SD_RESPONSE_FAILURE;
+        break;
+      }
     }
 
-    /*!< Put CRC bytes (not really needed by us, but required by SD) */
+    /*!< Send the stop token to end the write */
+    SD_WriteByte(SD_STOP_DATA_MULTIPLE_BLOCK_WRITE);
+    /*!< Skip the byte sent by the SD before it gets busy */
     SD_ReadByte();
-    SD_ReadByte();
-
-    /*!< Read data response */
-    if (SD_GetDataResponse() == SD_DATA_OK)
+    /*!< Wait while the SD is busy */
+    while (SD_ReadByte() == 0)
     {
-      rvalue = SD_RESPONSE_NO_ERROR;
+      SD_STATISTICS_ADD(BusyNb, 1);
     }
   }
   /*!< SD chip select high */
@@ -365,10 +804,8 @@ uint8_t SD_WriteBlock(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize)
 
   /*!< Returns the reponse */
   return rvalue;
-
 }
 
-
 /**
   * @brief  Write a buffer (many blocks) in the SD card.
   * @note   The amount of data to write should be a multiple of SD card BLOCK
@@ -382,11 +819,18 @@ uint8_t SD_WriteBlock(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize)
   */
 uint8_t SD_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NumByteToWrite)
 {
-  uint32_t i = 0, NbrOfBlock = 0, Offset = 0;
+  uint32_t NbrOfBlock = 0, Offset = 0;
   uint8_t rvalue = SD_RESPONSE_FAILURE;
 
   /* Calculate number of blocks to write */
   NbrOfBlock = NumByteToWrite / SD_BLOCK_SIZE;
+
+  /* Many blocks are written with a single command */
+  if (NbrOfBlock > 1)
+  {
+    return SD_WriteMultiBlocks(pBuffer, WriteAddr, SD_BLOCK_SIZE, NbrOfBlock);
+  }
+
   /* SD chip select low */
   SD_CS_LOW();
 
@@ -394,7 +838,7 @@ uint8_t SD_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NumByteToW
   while (NbrOfBlock--)
   {
     /* Send CMD24 (SD_WRITE_BLOCK) to write blocks */
-    SD_SendCmd(SD_CMD_WRITE_SINGLE_BLOCK, WriteAddr + Offset, 0xFF);
+    SD_SendCmd(SD_CMD_WRITE_SINGLE_BLOCK, SD_BlockAddress(WriteAddr + Offset), 0xFF);
 
     /* Check if the SD acknowledged the write block command: R1 response (0x00: no errors) */
     if (SD_GetResponse(SD_RESPONSE_NO_ERROR))
@@ -405,19 +849,11 @@ uint8_t SD_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NumByteToW
     SD_WriteByte(SD_DUMMY_BYTE);
     /* Send the data token to signify the start of the data */
     SD_WriteByte(SD_START_DATA_SINGLE_BLOCK_WRITE);
-    /* Write the block data to SD : write count data by block */
-    for (i = 0; i < SD_BLOCK_SIZE; i++)
-    {
-      /* Send the pointed byte */
-      SD_WriteByte(*pBuffer);
-      /* Point to the next location where the byte read will be saved */
-      pBuffer++;
-    }
+    /* Write the block data to SD : write SD_BLOCK_SIZE data, then its CRC */
+    SD_SendData(pBuffer, SD_BLOCK_SIZE);
+    pBuffer += SD_BLOCK_SIZE;
     /* Set next write address */
     Offset += 512;
-    /* Put CRC bytes (not really needed by us, but required by SD) */
-    SD_ReadByte();
-    SD_ReadByte();
     /* Read data response */
     if (SD_GetDataResponse() == SD_DATA_OK)
     {
@@ -440,48 +876,473 @@ uint8_t SD_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NumByteToW
 }
 
 /**
-  * @brief  Read the CSD card register.
-  *         Reading the contents of the CSD register in SPI mode is a simple
-  *         read-block transaction.
-  * @param  SD_csd: pointer on an SCD register structure
+  * @brief  Reads consecutive SD_BLOCK_SIZE byte sectors from the SD, addressed
+  *         by sector number so that the whole capacity of the high capacity
+  *         cards is reached (the byte addresses stop at 4 GBytes).
+  * @param  pBuffer: pointer to the buffer that receives the sectors.
+  * @param  Sector: first sector number.
+  * @param  SectorNb: number of sectors to read.
   * @retval The SD Response:
   *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
   *         - SD_RESPONSE_NO_ERROR: Sequence succeed
   */
-uint8_t SD_GetCSDRegister(SD_CSD* SD_csd)
+uint8_t SD_ReadSectors(uint8_t* pBuffer, uint32_t Sector, uint32_t SectorNb)
 {
-  uint32_t i = 0;
-  uint8_t rvalue = SD_RESPONSE_FAILURE;
-  uint8_t CSD_Tab[16];
+  if (SectorNb > 1)
+  {
+    return SD_ReadMultiBlocksAt(pBuffer, SD_SectorAddress(Sector), SD_BLOCK_SIZE, SectorNb);
+  }
+  else if (SectorNb == 1)
+  {
+    return SD_ReadBlockAt(pBuffer, SD_SectorAddress(Sector), SD_BLOCK_SIZE);
+  }
+  return SD_RESPONSE_NO_ERROR;
+}
+
+/**
+  * @brief  Writes consecutive SD_BLOCK_SIZE byte sectors on the SD, addressed
+  *         by sector number so that the whole capacity of the high capacity
+  *         cards is reached (the byte addresses stop at 4 GBytes).
+  * @param  pBuffer: pointer to the sectors to write.
+  * @param  Sector: first sector number.
+  * @param  SectorNb: number of sectors to write.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_WriteSectors(uint8_t* pBuffer, uint32_t Sector, uint32_t SectorNb)
+{
+  if (SectorNb > 1)
+  {
+    return SD_WriteMultiBlocksAt(pBuffer, SD_SectorAddress(Sector), SD_BLOCK_SIZE, SectorNb);
+  }
+  else if (SectorNb == 1)
+  {
+    return SD_WriteBlockAt(pBuffer, SD_SectorAddress(Sector), SD_BLOCK_SIZE);
+  }
+  return SD_RESPONSE_NO_ERROR;
+}
+
+#ifdef SD_USE_DMA
+/**
+  * @brief  Starts reading consecutive blocks from the SD with the DMA, in the
+  *         two stream buffers.
+  * @param  ReadAddr: SD's internal address to read from.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_StreamReadStart(uint32_t ReadAddr)
+{
+  SDStreamIn = 0;
+  SDStreamOut = 0;
+  SDStreamHeld = RESET;
+  SDStreamStop = RESET;
+  SDStreamTime = 0;
+#ifdef SD_USE_CRC
+  SDStreamCRCError = RESET;
+#endif /* SD_USE_CRC */
 
   /*!< SD chip select low */
   SD_CS_LOW();
-  /*!< Send CMD9 (CSD register) or CMD10(CSD register) */
-  SD_SendCmd(SD_CMD_SEND_CSD, 0, 0xFF);
-  /*!< Wait for response in the R1 format (0x00 is no errors) */
-  if (!SD_GetResponse(SD_RESPONSE_NO_ERROR))
+
+  /*!< Send CMD18 (SD_CMD_READ_MULT_BLOCK) to read the blocks */
+  SD_SendCmd(SD_CMD_READ_MULT_BLOCK, SD_BlockAddress(ReadAddr), 0xFF);
+
+  /*!< Check if the SD acknowledged the read command: R1 response (0x00: no errors) */
+  if (SD_GetResponse(SD_RESPONSE_NO_ERROR))
   {
-    if (!SD_GetResponse(SD_START_DATA_SINGLE_BLOCK_READ))
-    {
-      for (i = 0; i < 16; i++)
-      {
-        /*!< Store CSD register value on CSD_Tab */
-        CSD_Tab[i] = SD_ReadByte();
-      }
-    }
-    /*!< Get CRC bytes (not really needed by us, but required by SD) */
-    SD_WriteByte(SD_DUMMY_BYTE);
+    /*!< SD chip select high */
+    SD_CS_HIGH();
+    /*!< Send dummy byte: 8 Clock pulses of delay */
     SD_WriteByte(SD_DUMMY_BYTE);
-    /*!< Set response value to success */
-    rvalue = SD_RESPONSE_NO_ERROR;
+    return SD_RESPONSE_FAILURE;
   }
-  /*!< SD chip select high */
-  SD_CS_HIGH();
-  /*!< Send dummy byte: 8 Clock pulses of delay */
-  SD_WriteByte(SD_DUMMY_BYTE);
 
-  /*!< Byte 0 */
-  SD_csd->CSDStruct = (uint8_t)((CSD_Tab[0] & 0xC0) >> 6);
+  /* Global DMA Enable */
+  DMA_GlobalCmd(ENABLE);
+
+  /*!< The blocks are then read by SD_StreamTick() and the DMA */
+  SDStreamState = SD_STREAM_RX_TOKEN;
+
+  return SD_RESPONSE_NO_ERROR;
+}
+
+/**
+  * @brief  Returns the next block read by the stream, and gives the block
+  *         previously returned back to the driver.
+  * @param  None
+  * @retval Pointer to the SD_BLOCK_SIZE bytes of the block, valid until the
+  *         next call, or 0 when the block is not read yet, the stream failed
+  *         or the block is corrupted (SD_USE_CRC): SD_StreamGetStatus() tells
+  *         these cases apart.
+  */
+uint8_t* SD_StreamReadGetBlock(void)
+{
+  if (SD_StreamGetStatus() != SD_RESPONSE_NO_ERROR)
+  {
+    /*!< No more block: the stream must be ended by SD_StreamReadStop() */
+    return 0;
+  }
+
+  if (SDStreamHeld != RESET)
+  {
+    /*!< The previous block may be overwritten by the next ones */
+    SDStreamHeld = RESET;
+    SDStreamOut++;
+  }
+
+  if (SDStreamIn == SDStreamOut)
+  {
+    return 0;
+  }
+
+#ifdef SD_USE_CRC
+  if (SD_CRC16(SDStreamBuffer[SDStreamOut & 0x01], SD_BLOCK_SIZE) != SDStreamCRC[SDStreamOut & 0x01])
+  {
+    /*!< Corrupted block, not given: SD_StreamReadStop() reports the error */
+    SDStreamCRCError = SET;
+    return 0;
+  }
+#endif /* SD_USE_CRC */
+
+  SDStreamHeld = SET;
+  return SDStreamBuffer[SDStreamOut & 0x01];
+}
+
+/**
+  * @brief  Ends the read stream.
+  * @note   Waits for the end of the block being received, if any.
+  * @param  None
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_StreamReadStop(void)
+{
+  uint8_t rvalue = SD_RESPONSE_NO_ERROR;
+
+  /*!< Wait until the stream is stopped by SD_StreamTick() */
+  SDStreamStop = SET;
+  while ((SDStreamState != SD_STREAM_STOPPED) && (SDStreamState != SD_STREAM_ERROR))
+  {}
+
+  if (SDStreamState == SD_STREAM_ERROR)
+  {
+    rvalue = SD_RESPONSE_FAILURE;
+  }
+#ifdef SD_USE_CRC
+  else if (SDStreamCRCError != RESET)
+  {
+    rvalue = SD_DATA_CRC_ERROR;
+  }
+#endif /* SD_USE_CRC */
+  SDStreamState = SD_STREAM_STOPPED;
+
+  /*!< Send CMD12 (SD_CMD_STOP_TRANSMISSION) to end the read */
+  SD_SendCmd(SD_CMD_STOP_TRANSMISSION, 0, 0xFF);
+  /*!< Skip the stuff byte sent by the SD after CMD12 */
+  SD_ReadByte();
+  if (SD_GetResponse(SD_RESPONSE_NO_ERROR))
+  {
+    rvalue = SD_RESPONSE_FAILURE;
+  }
+  /*!< Wait while the SD is busy */
+  while (SD_ReadByte() == 0)
+  {
+    SD_STATISTICS_ADD(BusyNb, 1);
+  }
+
+  /*!< SD chip select high */
+  SD_CS_HIGH();
+  /*!< Send dummy byte: 8 Clock pulses of delay */
+  SD_WriteByte(SD_DUMMY_BYTE);
+
+  return rvalue;
+}
+
+/**
+  * @brief  Starts writing consecutive blocks on the SD with the DMA, from the
+  *         two stream buffers.
+  * @param  WriteAddr: address to write on.
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_StreamWriteStart(uint32_t WriteAddr)
+{
+  SDStreamIn = 0;
+  SDStreamOut = 0;
+  SDStreamStop = RESET;
+  SDStreamTime = 0;
+
+  /*!< SD chip select low */
+  SD_CS_LOW();
+
+  /*!< Send CMD25 (SD_CMD_WRITE_MULT_BLOCK) to write the blocks */
+  SD_SendCmd(SD_CMD_WRITE_MULT_BLOCK, SD_BlockAddress(WriteAddr), 0xFF);
+
+  /*!< Check if the SD acknowledged the write command: R1 response (0x00: no errors) */
+  if (SD_GetResponse(SD_RESPONSE_NO_ERROR))
+  {
+    /*!< SD chip select high */
+    SD_CS_HIGH();
+    /*!< Send dummy byte: 8 Clock pulses of delay */
+    SD_WriteByte(SD_DUMMY_BYTE);
+    return SD_RESPONSE_FAILURE;
+  }
+
+  /* Global DMA Enable */
+  DMA_GlobalCmd(ENABLE);
+
+  /*!< The blocks are then written by SD_StreamTick() and the DMA */
+  SDStreamState = SD_STREAM_TX_WAIT;
+
+  return SD_RESPONSE_NO_ERROR;
+}
+
+/**
+  * @brief  Returns the buffer to fill with the next block to write.
+  * @param  None
+  * @retval Pointer to the SD_BLOCK_SIZE bytes of the buffer, or 0 while both
+  *         buffers are being written or when the stream failed:
+  *         SD_StreamGetStatus() tells these cases apart.
+  */
+uint8_t* SD_StreamWriteGetBuffer(void)
+{
+  if ((uint8_t)(SDStreamIn - SDStreamOut) >= 2)
+  {
+    return 0;
+  }
+  return SDStreamBuffer[SDStreamIn & 0x01];
+}
+
+/**
+  * @brief  Writes the buffer returned by SD_StreamWriteGetBuffer(), once
+  *         filled, on the SD after the previous blocks.
+  * @note   Returns at once: the block is written by SD_StreamTick() and the
+  *         DMA.
+  * @param  None
+  * @retval None
+  */
+void SD_StreamWriteBlock(void)
+{
+#ifdef SD_USE_CRC
+  SDStreamCRC[SDStreamIn & 0x01] = SD_CRC16(SDStreamBuffer[SDStreamIn & 0x01], SD_BLOCK_SIZE);
+#endif /* SD_USE_CRC */
+  SDStreamIn++;
+}
+
+/**
+  * @brief  Returns the state of the read or write stream, to tell a stream
+  *         which failed from a block or buffer not available yet when
+  *         SD_StreamReadGetBlock() or SD_StreamWriteGetBuffer() returns 0.
+  * @param  None
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Stream failed, to be ended by its stop
+  *           function
+  *         - SD_DATA_CRC_ERROR: Corrupted block read (SD_USE_CRC), the stream
+  *           to be ended by SD_StreamReadStop()
+  *         - SD_RESPONSE_NO_ERROR: Stream in progress or stopped
+  */
+uint8_t SD_StreamGetStatus(void)
+{
+  uint8_t rvalue = SD_RESPONSE_NO_ERROR;
+
+  if (SDStreamState == SD_STREAM_ERROR)
+  {
+    rvalue = SD_RESPONSE_FAILURE;
+  }
+#ifdef SD_USE_CRC
+  else if (SDStreamCRCError != RESET)
+  {
+    rvalue = SD_DATA_CRC_ERROR;
+  }
+#endif /* SD_USE_CRC */
+
+  return rvalue;
+}
+
+/**
+  * @brief  Waits for the end of the writing of the blocks, then ends the
+  *         write stream.
+  * @param  None
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_StreamWriteStop(void)
+{
+  uint8_t rvalue = SD_RESPONSE_NO_ERROR;
+
+  /*!< Wait until the stream is stopped by SD_StreamTick(), once all the
+       blocks are written */
+  SDStreamStop = SET;
+  while ((SDStreamState != SD_STREAM_STOPPED) && (SDStreamState != SD_STREAM_ERROR))
+  {}
+
+  if (SDStreamState == SD_STREAM_ERROR)
+  {
+    rvalue = SD_RESPONSE_FAILURE;
+  }
+  SDStreamState = SD_STREAM_STOPPED;
+
+  /*!< Send the stop token to end the write */
+  SD_WriteByte(SD_STOP_DATA_MULTIPLE_BLOCK_WRITE);
+  /*!< Skip the byte sent by the SD before it gets busy */
+  SD_ReadByte();
+  /*!< Wait while the SD is busy */
+  while (SD_ReadByte() == 0)
+  {
+    SD_STATISTICS_ADD(BusyNb, 1);
+  }
+
+  /*!< SD chip select high */
+  SD_CS_HIGH();
+  /*!< Send dummy byte: 8 Clock pulses of delay */
+  SD_WriteByte(SD_DUMMY_BYTE);
+
+  return rvalue;
+}
+
+/**
+  * @brief  Goes on with the stream in progress: looks for the data token of
+  *         the next block to read, or for the end of the programming of the
+  *         block written.
+  * @note   This function should be called periodically, from a timer
+  *         interrupt routine for instance. A stream fails after
+  *         SD_STREAM_TIMEOUT calls without progress.
+  * @param  None
+  * @retval None
+  */
+void SD_StreamTick(void)
+{
+  if (((SDStreamState == SD_STREAM_RX_TOKEN) && (SDStreamStop == RESET)
+       && ((uint8_t)(SDStreamIn - SDStreamOut) < 2))
+      || (SDStreamState == SD_STREAM_TX_BUSY))
+  {
+    /*!< The card is expected to answer */
+    if (++SDStreamTime > SD_STREAM_TIMEOUT)
+    {
+      SDStreamState = SD_STREAM_ERROR;
+      return;
+    }
+  }
+
+  SD_StreamNext();
+}
+
+/**
+  * @brief  This function handles the DMA Rx Channel interrupt Handler.
+  *     @note This function should be called in the interrupt handler of
+  *       SD_SPI_DMA_CHANNEL_RX in the stm8l15x_it.c file (for the
+  *       STM8L1526-EVAL board) just as follow.
+  *
+  *       // INTERRUPT_HANDLER(DMA1_CHANNEL0_1_IRQHandler, 2)
+  *       // {
+  *           // SD_SPI_DMA_RX_IRQHandler();
+  *       // }
+  * @param  None
+  * @retval None
+  */
+void SD_SPI_DMA_RX_IRQHandler(void)
+{
+  /* Check if the DMA transfer of a block read is complete */
+  if ((SDStreamState == SD_STREAM_RX_DATA)
+      && (DMA_GetFlagStatus(SD_SPI_DMA_FLAG_RX_TC) != RESET))
+  {
+    SD_DMAComplete();
+  }
+}
+
+/**
+  * @brief  This function handles the DMA Tx Channel interrupt Handler.
+  *     @note This function should be called in the interrupt handler of
+  *       SD_SPI_DMA_CHANNEL_TX in the stm8l15x_it.c file (for the
+  *       STM8L1526-EVAL board) just as follow.
+  *
+  *       // INTERRUPT_HANDLER(DMA1_CHANNEL2_3_IRQHandler, 3)
+  *       // {
+  *           // SD_SPI_DMA_TX_IRQHandler();
+  *       // }
+  * @param  None
+  * @retval None
+  */
+void SD_SPI_DMA_TX_IRQHandler(void)
+{
+  /* Check if the DMA transfer of a block written is complete */
+  if ((SDStreamState == SD_STREAM_TX_DATA)
+      && (DMA_GetFlagStatus(SD_SPI_DMA_FLAG_TX_TC) != RESET))
+  {
+    SD_DMAComplete();
+  }
+}
+#endif /* SD_USE_DMA */
+
+#ifdef SD_USE_STATISTICS
+/**
+  * @brief  Returns the card accesses counted since the last
+  *         SD_ClearStatistics().
+  * @param  Statistics: pointer to the structure that receives the counters.
+  * @retval None
+  */
+void SD_GetStatistics(SD_Statistics_TypeDef* Statistics)
+{
+  *Statistics = SDStatistics;
+}
+
+/**
+  * @brief  Clears the counters of the card accesses.
+  * @param  None
+  * @retval None
+  */
+void SD_ClearStatistics(void)
+{
+  SDStatistics.CommandNb = 0;
+  SDStatistics.ReadBlockNb = 0;
+  SDStatistics.WriteBlockNb = 0;
+  SDStatistics.WaitNb = 0;
+  SDStatistics.BusyNb = 0;
+}
+#endif /* SD_USE_STATISTICS */
+
+/**
+  * @brief  Read the CSD card register.
+  *         Reading the contents of the CSD register in SPI mode is a simple
+  *         read-block transaction.
+  * @param  SD_csd: pointer on an SCD register structure
+  * @retval The SD Response:
+  *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+uint8_t SD_GetCSDRegister(SD_CSD* SD_csd)
+{
+  uint8_t rvalue = SD_RESPONSE_FAILURE;
+  uint8_t CSD_Tab[16];
+
+  /*!< SD chip select low */
+  SD_CS_LOW();
+  /*!< Send CMD9 (CSD register) or CMD10(CSD register) */
+  SD_SendCmd(SD_CMD_SEND_CSD, 0, 0xFF);
+  /*!< Wait for response in the R1 format (0x00 is no errors) */
+  if (!SD_GetResponse(SD_RESPONSE_NO_ERROR))
+  {
+    if (!SD_GetResponse(SD_START_DATA_SINGLE_BLOCK_READ))
+    {
+      /*!< Store CSD register value on CSD_Tab, then get its CRC */
+      rvalue = SD_ReceiveData(CSD_Tab, 16);
+    }
+  }
+  /*!< SD chip select high */
+  SD_CS_HIGH();
+  /*!< Send dummy byte: 8 Clock pulses of delay */
+  SD_WriteByte(SD_DUMMY_BYTE);
+
+  /*!< Byte 0 */
+  SD_csd->CSDStruct = (uint8_t)((CSD_Tab[0] & 0xC0) >> 6);
   SD_csd->SysSpecVersion = (uint8_t)((CSD_Tab[0] & 0x3C) >> 2);
   SD_csd->Reserved1 = (uint8_t)(CSD_Tab[0] & 0x03);
 
@@ -508,23 +1369,41 @@ uint8_t SD_GetCSDRegister(SD_CSD* SD_csd)
   SD_csd->DSRImpl = (uint8_t)((CSD_Tab[6] & 0x10) >> 4);
   SD_csd->Reserved2 = 0; /*!< Reserved */
 
-  SD_csd->DeviceSize = (CSD_Tab[6] & 0x03) << 10;
+  if (SD_csd->CSDStruct == 0)
+  {
+    /*!< CSD version 1.0 */
+    SD_csd->DeviceSize = (uint32_t)(CSD_Tab[6] & 0x03) << 10;
 
-  /*!< Byte 7 */
-  SD_csd->DeviceSize |= (CSD_Tab[7]) << 2;
+    /*!< Byte 7 */
+    SD_csd->DeviceSize |= (uint32_t)(CSD_Tab[7]) << 2;
 
-  /*!< Byte 8 */
-  SD_csd->DeviceSize |= (CSD_Tab[8] & 0xC0) >> 6;
+    /*!< Byte 8 */
+    SD_csd->DeviceSize |= (CSD_Tab[8] & 0xC0) >> 6;
 
-  SD_csd->MaxRdCurrentVDDMin = (uint8_t)((CSD_Tab[8] & 0x38) >> 3);
-  SD_csd->MaxRdCurrentVDDMax = (uint8_t)((CSD_Tab[8] & 0x07));
+    SD_csd->MaxRdCurrentVDDMin = (uint8_t)((CSD_Tab[8] & 0x38) >> 3);
+    SD_csd->MaxRdCurrentVDDMax = (uint8_t)((CSD_Tab[8] & 0x07));
 
-  /*!< Byte 9 */
-  SD_csd->MaxWrCurrentVDDMin = (uint8_t)((CSD_Tab[9] & 0xE0) >> 5);
-  SD_csd->MaxWrCurrentVDDMax = (uint8_t)((CSD_Tab[9] & 0x1C) >> 2);
-  SD_csd->DeviceSizeMul = (uint8_t)((CSD_Tab[9] & 0x03) << 1);
-  /*!< Byte 10 */
-  SD_csd->DeviceSizeMul |= (uint8_t)((CSD_Tab[10] & 0x80) >> 7);
+    /*!< Byte 9 */
+    SD_csd->MaxWrCurrentVDDMin = (uint8_t)((CSD_Tab[9] & 0xE0) >> 5);
+    SD_csd->MaxWrCurrentVDDMax = (uint8_t)((CSD_Tab[9] & 0x1C) >> 2);
+    SD_csd->DeviceSizeMul = (uint8_t)((CSD_Tab[9] & 0x03) << 1);
+    /*!< Byte 10 */
+    SD_csd->DeviceSizeMul |= (uint8_t)((CSD_Tab[10] & 0x80) >> 7);
+  }
+  else
+  {
+    /*!< CSD version 2.0: 22-bit device size in bytes 7 to 9, no current
+         ratings nor size multiplier */
+    SD_csd->DeviceSize = (uint32_t)(CSD_Tab[7] & 0x3F) << 16;
+    SD_csd->DeviceSize |= (uint32_t)(CSD_Tab[8]) << 8;
+    SD_csd->DeviceSize |= CSD_Tab[9];
+
+    SD_csd->MaxRdCurrentVDDMin = 0;
+    SD_csd->MaxRdCurrentVDDMax = 0;
+    SD_csd->MaxWrCurrentVDDMin = 0;
+    SD_csd->MaxWrCurrentVDDMax = 0;
+    SD_csd->DeviceSizeMul = 0;
+  }
 
   SD_csd->EraseGrSize = (uint8_t)((CSD_Tab[10] & 0x40) >> 6);
   SD_csd->EraseGrMul = (uint8_t)((CSD_Tab[10] & 0x3F) << 1);
@@ -568,11 +1447,11 @@ uint8_t SD_GetCSDRegister(SD_CSD* SD_csd)
   * @param  SD_cid: pointer on an CID register structure
   * @retval The SD Response:
   *         - SD_RESPONSE_FAILURE: Sequence failed
+  *         - SD_DATA_CRC_ERROR: CRC error on the data read (SD_USE_CRC)
   *         - SD_RESPONSE_NO_ERROR: Sequence succeed
   */
 uint8_t SD_GetCIDRegister(SD_CID* SD_cid)
 {
-  uint32_t i = 0;
   uint8_t rvalue = SD_RESPONSE_FAILURE;
   uint8_t CID_Tab[16];
 
@@ -587,17 +1466,9 @@ uint8_t SD_GetCIDRegister(SD_CID* SD_cid)
   {
     if (!SD_GetResponse(SD_START_DATA_SINGLE_BLOCK_READ))
     {
-      /*!< Store CID register value on CID_Tab */
-      for (i = 0; i < 16; i++)
-      {
-        CID_Tab[i] = SD_ReadByte();
-      }
+      /*!< Store CID register value on CID_Tab, then get its CRC */
+      rvalue = SD_ReceiveData(CID_Tab, 16);
     }
-    /*!< Get CRC bytes (not really needed by us, but required by SD) */
-    SD_WriteByte(SD_DUMMY_BYTE);
-    SD_WriteByte(SD_DUMMY_BYTE);
-    /*!< Set response value to success */
-    rvalue = SD_RESPONSE_NO_ERROR;
   }
   /*!< SD chip select high */
   SD_CS_HIGH();
@@ -660,6 +1531,8 @@ uint8_t SD_GetCIDRegister(SD_CID* SD_cid)
 
 /**
   * @brief  Send 5 bytes command to the SD card.
+  * @note   When SD_USE_CRC is defined, the CRC is computed by the SD_SPI
+  *         CRC unit and Crc is not used.
   * @param  Cmd: The user expected command to send to SD card.
   * @param  Arg: The command argument.
   * @param  Crc: The CRC.
@@ -681,12 +1554,39 @@ void SD_SendCmd(uint8_t Cmd, uint32_t Arg, uint8_t Crc)
 
   Frame[4] = (uint8_t)(Arg); /*!< Construct byte 5 */
 
+  SD_STATISTICS_ADD(CommandNb, 1);
+
+#ifdef SD_USE_CRC
+  /*!< The sFLASH driver may have configured the SPI shared with the SD */
+  if (SPI_GetCRCPolynomial(SD_SPI) != SD_CRC7_POLYNOMIAL)
+  {
+    SD_SPIConfig(SDSPIPrescaler);
+  }
+
+  /*!< Clear the CRC registers: the CRC of the bytes sent is computed */
+  SPI_ResetCRC(SD_SPI);
+
+  for (i = 0; i < 5; i++)
+  {
+    SD_WriteByte(Frame[i]); /*!< Send the Cmd bytes */
+  }
+
+  /*!< Construct CRC: byte 6, CRC7 and end bit */
+  Frame[5] = (uint8_t)(SPI_GetCRC(SD_SPI, SPI_CRC_TX) | 0x01);
+
+  /*!< The data blocks are sent without the CRC unit */
+  SPI_CalculateCRCCmd(SD_SPI, DISABLE);
+  SPI_Cmd(SD_SPI, ENABLE);
+
+  SD_WriteByte(Frame[5]);
+#else
   Frame[5] = (Crc); /*!< Construct CRC: byte 6 */
 
   for (i = 0; i < 6; i++)
   {
     SD_WriteByte(Frame[i]); /*!< Send the Cmd bytes */
   }
+#endif /* SD_USE_CRC */
 }
 
 /**
@@ -734,7 +1634,10 @@ uint8_t SD_GetDataResponse(void)
   }
 
   /*!< Wait null data */
-  while (SD_ReadByte() == 0);
+  while (SD_ReadByte() == 0)
+  {
+    SD_STATISTICS_ADD(BusyNb, 1);
+  }
 
   /*!< Return response */
   return response;
@@ -754,6 +1657,7 @@ uint8_t SD_GetResponse(uint8_t Response)
   /*!< Check if response is got or a timeout is happen */
   while ((SD_ReadByte() != Response) && Count)
   {
+    SD_STATISTICS_ADD(WaitNb, 1);
     Count--;
   }
   if (Count == 0)
@@ -796,7 +1700,14 @@ uint16_t SD_GetStatus(void)
 }
 
 /**
-  * @brief  Put SD in Idle state.
+  * @brief  Put SD in Idle state then initializes it, finding its type:
+  *         - CMD8 is only answered by the version 2.0 SD cards,
+  *         - ACMD41 initializes the SD cards, announcing the high capacity
+  *           support to the version 2.0 ones,
+  *         - CMD1 initializes the MultiMediaCards, rejecting ACMD41,
+  *         - CMD58 tells whether a version 2.0 card is a high capacity one,
+  *           which is addressed by blocks.
+  *         The block length of the standard capacity cards is set to 512.
   * @param  None
   * @retval The SD Response:
   *         - SD_RESPONSE_FAILURE: Sequence failed
@@ -804,6 +1715,13 @@ uint16_t SD_GetStatus(void)
   */
 uint8_t SD_GoIdleState(void)
 {
+  uint8_t i = 0, response = 0, R7[4];
+  uint16_t trials = 0;
+  uint32_t Arg = 0;
+  uint8_t rvalue = SD_RESPONSE_FAILURE;
+
+  SD_CardType = SD_CARD_UNKNOWN;
+
   /*!< SD chip select low */
   SD_CS_LOW();
 
@@ -811,28 +1729,111 @@ uint8_t SD_GoIdleState(void)
   SD_SendCmd(SD_CMD_GO_IDLE_STATE, 0, 0x95);
 
   /*!< Wait for In Idle State Response (R1 Format) equal to 0x01 */
-  if (SD_GetResponse(SD_IN_IDLE_STATE))
+  if (!SD_GetResponse(SD_IN_IDLE_STATE))
   {
-    /*!< No Idle State Response: return response failue */
-    return SD_RESPONSE_FAILURE;
+    /*!< Send CMD8 (SD_CMD_SEND_IF_COND): the version 2.0 cards echo the
+         check pattern, the others reject the command */
+    if (SD_SendCmdR1(SD_CMD_SEND_IF_COND, SD_CHECK_PATTERN, 0x87) == SD_IN_IDLE_STATE)
+    {
+      for (i = 0; i < 4; i++)
+      {
+        R7[i] = SD_ReadByte();
+      }
+      if (((R7[2] & 0x0F) == (uint8_t)(SD_CHECK_PATTERN >> 8))
+          && (R7[3] == (uint8_t)SD_CHECK_PATTERN))
+      {
+        SD_CardType = SD_CARD_STD_CAPACITY_V2;
+        Arg = SD_HIGH_CAPACITY;
+      }
+    }
+    else
+    {
+      SD_CardType = SD_CARD_STD_CAPACITY_V1;
+    }
   }
-  /*----------Activates the card initialization process-----------*/
-  do
-  {
-    /*!< SD chip select high */
-    SD_CS_HIGH();
 
-    /*!< Send Dummy byte 0xFF */
-    SD_WriteByte(SD_DUMMY_BYTE);
-
-    /*!< SD chip select low */
-    SD_CS_LOW();
+  if (SD_CardType != SD_CARD_UNKNOWN)
+  {
+    /*----------Activates the card initialization process-----------*/
+    trials = SD_INIT_TRIALS;
+    do
+    {
+      /*!< Send CMD55 (SD_CMD_APP_CMD) then ACMD41 (SD_ACMD_SD_SEND_OP_COND)
+           until the card leaves the idle state */
+      response = SD_SendCmdR1(SD_CMD_APP_CMD, 0, 0xFF);
+      if (response <= SD_IN_IDLE_STATE)
+      {
+        response = SD_SendCmdR1(SD_ACMD_SD_SEND_OP_COND, Arg, 0xFF);
+      }
+    }
+    while ((response == SD_IN_IDLE_STATE) && --trials);
 
-    /*!< Send CMD1 (Activates the card process) until response equal to 0x0 */
-    SD_SendCmd(SD_CMD_SEND_OP_COND, 0, 0xFF);
-    /*!< Wait for no error Response (R1 Format) equal to 0x00 */
-  }
-  while (SD_GetResponse(SD_RESPONSE_NO_ERROR));
+    if ((response != SD_RESPONSE_NO_ERROR) && (SD_CardType == SD_CARD_STD_CAPACITY_V1))
+    {
+      /*!< ACMD41 rejected: MultiMediaCard, activated by CMD1 */
+      SD_CardType = SD_CARD_MMC;
+      trials = SD_INIT_TRIALS;
+      do
+      {
+        /*!< Send CMD1 (Activates the card process) until response equal to 0x0 */
+        response = SD_SendCmdR1(SD_CMD_SEND_OP_COND, 0, 0xFF);
+      }
+      while ((response == SD_IN_IDLE_STATE) && --trials);
+    }
+
+    if (response == SD_RESPONSE_NO_ERROR)
+    {
+      rvalue = SD_RESPONSE_NO_ERROR;
+    }
+  }
+
+  if ((rvalue == SD_RESPONSE_NO_ERROR) && (SD_CardType == SD_CARD_STD_CAPACITY_V2))
+  {
+    /*!< Send CMD58 (SD_CMD_READ_OCR): the CCS bit tells the high capacity
+         cards */
+    if (SD_SendCmdR1(SD_CMD_READ_OCR, 0, 0xFF) == SD_RESPONSE_NO_ERROR)
+    {
+      for (i = 0; i < 4; i++)
+      {
+        R7[i] = SD_ReadByte();
+      }
+      if (R7[0] & SD_OCR_CCS)
+      {
+        SD_CardType = SD_CARD_HIGH_CAPACITY;
+      }
+    }
+    else
+    {
+      rvalue = SD_RESPONSE_FAILURE;
+    }
+  }
+
+  if ((rvalue == SD_RESPONSE_NO_ERROR) && (SD_CardType != SD_CARD_HIGH_CAPACITY))
+  {
+    /*!< Send CMD16 (SD_CMD_SET_BLOCKLEN): the standard capacity cards may
+         have another default block length */
+    if (SD_SendCmdR1(SD_CMD_SET_BLOCKLEN, SD_BLOCK_SIZE, 0xFF) != SD_RESPONSE_NO_ERROR)
+    {
+      rvalue = SD_RESPONSE_FAILURE;
+    }
+  }
+
+#ifdef SD_USE_CRC
+  if (rvalue == SD_RESPONSE_NO_ERROR)
+  {
+    /*!< Send CMD59 (SD_CMD_CRC_ON_OFF): the card checks the CRC of the
+         commands and of the blocks written from now on */
+    if (SD_SendCmdR1(SD_CMD_CRC_ON_OFF, 1, 0xFF) != SD_RESPONSE_NO_ERROR)
+    {
+      rvalue = SD_RESPONSE_FAILURE;
+    }
+  }
+#endif /* SD_USE_CRC */
+
+  if (rvalue != SD_RESPONSE_NO_ERROR)
+  {
+    SD_CardType = SD_CARD_UNKNOWN;
+  }
 
   /*!< SD chip select high */
   SD_CS_HIGH();
@@ -840,7 +1841,7 @@ uint8_t SD_GoIdleState(void)
   /*!< Send dummy byte 0xFF */
   SD_WriteByte(SD_DUMMY_BYTE);
 
-  return SD_RESPONSE_NO_ERROR;
+  return rvalue;
 }
 
 /**
@@ -890,6 +1891,505 @@ uint8_t SD_ReadByte(void)
   return Data;
 }
 
+/**
+  * @brief  Sends a command in a new chip select cycle and gets its R1
+  *         response. The chip select is left low to read the rest of the
+  *         response.
+  * @param  Cmd: The user expected command to send to SD card.
+  * @param  Arg: The command argument.
+  * @param  Crc: The CRC.
+  * @retval The R1 response, SD_RESPONSE_FAILURE after time out.
+  */
+static uint8_t SD_SendCmdR1(uint8_t Cmd, uint32_t Arg, uint8_t Crc)
+{
+  /*!< SD chip select high */
+  SD_CS_HIGH();
+
+  /*!< Send Dummy byte 0xFF */
+  SD_WriteByte(SD_DUMMY_BYTE);
+
+  /*!< SD chip select low */
+  SD_CS_LOW();
+
+  SD_SendCmd(Cmd, Arg, Crc);
+
+  return SD_ReadResponse();
+}
+
+/**
+  * @brief  Reads the R1 response of a command, whichever its value.
+  * @param  None
+  * @retval The R1 response, SD_RESPONSE_FAILURE after time out.
+  */
+static uint8_t SD_ReadResponse(void)
+{
+  uint8_t Count = SD_R1_TIMEOUT;
+  uint8_t response = SD_RESPONSE_FAILURE;
+
+  /*!< The R1 response is the first byte with its most significant bit reset */
+  do
+  {
+    response = SD_ReadByte();
+  }
+  while ((response & 0x80) && --Count);
+
+  return response;
+}
+
+/**
+  * @brief  Converts an address in bytes into the address of the read and
+  *         write commands: the high capacity cards are addressed by blocks.
+  * @param  Addr: address in bytes.
+  * @retval The command address.
+  */
+static uint32_t SD_BlockAddress(uint32_t Addr)
+{
+  if (SD_CardType == SD_CARD_HIGH_CAPACITY)
+  {
+    return (Addr >> 9);
+  }
+  return Addr;
+}
+
+/**
+  * @brief  Converts a sector number into the address of the read and write
+  *         commands: the standard capacity cards are addressed by bytes.
+  * @param  Sector: SD_BLOCK_SIZE byte sector number.
+  * @retval The command address.
+  */
+static uint32_t SD_SectorAddress(uint32_t Sector)
+{
+  if (SD_CardType == SD_CARD_HIGH_CAPACITY)
+  {
+    return Sector;
+  }
+  return (Sector << 9);
+}
+
+/**
+  * @brief  Configures and enables the SD_SPI.
+  * @param  SPI_BaudRatePrescaler: SPI clock prescaler.
+  * @retval None
+  */
+static void SD_SPIConfig(SPI_BaudRatePrescaler_TypeDef SPI_BaudRatePrescaler)
+{
+#ifdef SD_USE_CRC
+  SDSPIPrescaler = SPI_BaudRatePrescaler;
+#endif /* SD_USE_CRC */
+
+  /* The SPI clock is only changed while the SPI is disabled */
+  SPI_Cmd(SD_SPI, DISABLE);
+
+  SPI_Init(SD_SPI, SPI_FirstBit_MSB, SPI_BaudRatePrescaler, SPI_Mode_Master,
+           SPI_CPOL_High, SPI_CPHA_2Edge, SPI_Direction_2Lines_FullDuplex,
+           SPI_NSS_Soft, SD_CRC7_POLYNOMIAL);
+
+  /* Enable SPI  */
+  SPI_Cmd(SD_SPI, ENABLE);
+}
+
+/**
+  * @brief  Receives the data of a block, then its CRC.
+  * @note   When SD_USE_CRC is defined, the CRC16 of each byte is computed
+  *         while the next one is received, then checked.
+  * @param  pBuffer: pointer to the buffer that receives the data.
+  * @param  NumByte: number of data bytes.
+  * @retval The SD Response:
+  *         - SD_DATA_CRC_ERROR: CRC error on the data received
+  *         - SD_RESPONSE_NO_ERROR: Sequence succeed
+  */
+static uint8_t SD_ReceiveData(uint8_t* pBuffer, uint16_t NumByte)
+{
+  uint16_t i = 0;
+#ifdef SD_USE_CRC
+  uint16_t crc = 0;
+#endif /* SD_USE_CRC */
+
+  SD_STATISTICS_ADD(ReadBlockNb, 1);
+
+  for (i = 0; i < NumByte; i++)
+  {
+    /*!< Wait until the transmit buffer is empty */
+    while (SPI_GetFlagStatus(SD_SPI, SPI_FLAG_TXE) == RESET)
+    {}
+    /*!< Send the byte */
+    SPI_SendData(SD_SPI, SD_DUMMY_BYTE);
+
+#ifdef SD_USE_CRC
+    if (i != 0)
+    {
+      crc = SD_CRC16_UPDATE(crc, pBuffer[i - 1]);
+    }
+#endif /* SD_USE_CRC */
+
+    /*!< Wait until a data is received */
+    while (SPI_GetFlagStatus(SD_SPI, SPI_FLAG_RXNE) == RESET)
+    {}
+    /*!< Save the received data */
+    pBuffer[i] = SPI_ReceiveData(SD_SPI);
+  }
+
+#ifdef SD_USE_CRC
+  if (NumByte != 0)
+  {
+    crc = SD_CRC16_UPDATE(crc, pBuffer[NumByte - 1]);
+  }
+
+  /*!< Get CRC bytes: the CRC16 of the data followed by its CRC is zero */
+  crc = SD_CRC16_UPDATE(crc, SD_ReadByte());
+  crc = SD_CRC16_UPDATE(crc, SD_ReadByte());
+  if (crc != 0)
+  {
+    return SD_DATA_CRC_ERROR;
+  }
+#else
+  /*!< Get CRC bytes (not really needed by us, but required by SD) */
+  SD_ReadByte();
+  SD_ReadByte();
+#endif /* SD_USE_CRC */
+
+  return SD_RESPONSE_NO_ERROR;
+}
+
+/**
+  * @brief  Sends the data of a block, completed by dummy bytes up to
+  *         SD_BLOCK_SIZE, then its CRC.
+  * @note   When SD_USE_CRC is defined, the CRC16 of each byte is computed
+  *         while it is sent.
+  * @param  pBuffer: pointer to the data to send.
+  * @param  NumByte: number of data bytes.
+  * @retval None
+  */
+static void SD_SendData(uint8_t* pBuffer, uint16_t NumByte)
+{
+  uint16_t i = 0;
+  uint8_t data = 0;
+#ifdef SD_USE_CRC
+  uint16_t crc = 0;
+#endif /* SD_USE_CRC */
+
+  SD_STATISTICS_ADD(WriteBlockNb, 1);
+
+  for (i = 0; (i < NumByte) || (i < SD_BLOCK_SIZE); i++)
+  {
+    data = (i < NumByte) ? pBuffer[i] : SD_DUMMY_BYTE;
+
+    /*!< Wait until the transmit buffer is empty */
+    while (SPI_GetFlagStatus(SD_SPI, SPI_FLAG_TXE) == RESET)
+    {}
+    /*!< Send the byte */
+    SPI_SendData(SD_SPI, data);
+
+#ifdef SD_USE_CRC
+    crc = SD_CRC16_UPDATE(crc, data);
+#endif /* SD_USE_CRC */
+
+    /*!< Wait to receive a byte */
+    while (SPI_GetFlagStatus(SD_SPI, SPI_FLAG_RXNE) == RESET)
+    {}
+    SPI_ReceiveData(SD_SPI);
+  }
+
+#ifdef SD_USE_CRC
+  /*!< Put CRC bytes */
+  SD_WriteByte((uint8_t)(crc >> 8));
+  SD_WriteByte((uint8_t)crc);
+#else
+  /*!< Put CRC bytes (not really needed by us, but required by SD) */
+  SD_ReadByte();
+  SD_ReadByte();
+#endif /* SD_USE_CRC */
+}
+
+#ifdef SD_USE_DMA
+/**
+  * @brief  Starts the next step of the stream in progress, if possible.
+  * @param  None
+  * @retval None
+  */
+static void SD_StreamNext(void)
+{
+  if (SDStreamState == SD_STREAM_RX_TOKEN)
+  {
+    if (SDStreamStop != RESET)
+    {
+      SDStreamState = SD_STREAM_STOPPED;
+    }
+    else if ((uint8_t)(SDStreamIn - SDStreamOut) < 2)
+    {
+      /*!< A buffer is free for the next block */
+      SD_StreamPollToken();
+    }
+  }
+  else if (SDStreamState == SD_STREAM_TX_WAIT)
+  {
+    if (SDStreamIn != SDStreamOut)
+    {
+      SDStreamTime = 0;
+      SDStreamState = SD_STREAM_TX_DATA;
+
+      /*!< Send a dummy byte */
+      SD_WriteByte(SD_DUMMY_BYTE);
+      /*!< Send the data token to signify the start of the data */
+      SD_WriteByte(SD_START_DATA_MULTIPLE_BLOCK_WRITE);
+
+      SD_DMAStart(SDStreamBuffer[SDStreamOut & 0x01], SD_DIRECTION_TX);
+    }
+    else if (SDStreamStop != RESET)
+    {
+      SDStreamState = SD_STREAM_STOPPED;
+    }
+  }
+  else if (SDStreamState == SD_STREAM_TX_BUSY)
+  {
+    SD_StreamPollBusy();
+  }
+}
+
+/**
+  * @brief  Looks for the data token of the next block to read and starts
+  *         receiving the block with the DMA once found.
+  * @param  None
+  * @retval None
+  */
+static void SD_StreamPollToken(void)
+{
+  uint16_t i = 0;
+  uint8_t response = 0;
+  uint8_t* pBuffer = SDStreamBuffer[SDStreamIn & 0x01];
+
+  for (i = 0; i < SD_STREAM_POLL_NB; i++)
+  {
+    response = SD_ReadByte();
+
+    if (response == SD_START_DATA_MULTIPLE_BLOCK_READ)
+    {
+      SDStreamTime = 0;
+      SDStreamState = SD_STREAM_RX_DATA;
+
+      /*!< The buffer is transmitted while it is received: filled with
+           dummy bytes so that the SD sees no command */
+      for (i = 0; i < SD_BLOCK_SIZE; i++)
+      {
+        pBuffer[i] = SD_DUMMY_BYTE;
+      }
+
+      SD_DMAStart(pBuffer, SD_DIRECTION_RX);
+      return;
+    }
+    if (response != SD_DUMMY_BYTE)
+    {
+      /*!< Data error token */
+      SDStreamState = SD_STREAM_ERROR;
+      return;
+    }
+
+    SD_STATISTICS_ADD(WaitNb, 1);
+  }
+}
+
+/**
+  * @brief  Looks for the end of the programming of the block written, then
+  *         goes on with the next block.
+  * @param  None
+  * @retval None
+  */
+static void SD_StreamPollBusy(void)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < SD_STREAM_POLL_NB; i++)
+  {
+    /*!< The SD holds its data output low while it is busy */
+    if (SD_ReadByte() != 0)
+    {
+      SDStreamTime = 0;
+      SDStreamOut++;
+      SDStreamState = SD_STREAM_TX_WAIT;
+
+      SD_StreamNext();
+      return;
+    }
+
+    SD_STATISTICS_ADD(BusyNb, 1);
+  }
+}
+
+/**
+  * @brief  Ends the transfer of a block once its data is transferred by the
+  *         DMA: reads or sends its CRC and gets the data response of a write.
+  * @param  None
+  * @retval None
+  */
+static void SD_StreamEndBlock(void)
+{
+  uint8_t i = 0, response = 0;
+
+#ifdef SD_USE_CRC
+  if (SDDataDirection == SD_DIRECTION_RX)
+  {
+    /*!< Get CRC bytes, checked when the block is given to the application */
+    SDStreamCRC[SDStreamIn & 0x01] = (uint16_t)((uint16_t)SD_ReadByte() << 8);
+    SDStreamCRC[SDStreamIn & 0x01] |= SD_ReadByte();
+  }
+  else
+  {
+    /*!< Put CRC bytes, computed by SD_StreamWriteBlock() */
+    SD_WriteByte((uint8_t)(SDStreamCRC[SDStreamOut & 0x01] >> 8));
+    SD_WriteByte((uint8_t)SDStreamCRC[SDStreamOut & 0x01]);
+  }
+#else
+  /*!< Get or put CRC bytes (not really needed by us, but required by SD) */
+  SD_ReadByte();
+  SD_ReadByte();
+#endif /* SD_USE_CRC */
+
+  if (SDDataDirection == SD_DIRECTION_RX)
+  {
+    SD_STATISTICS_ADD(ReadBlockNb, 1);
+
+    /*!< The block read is given to the application */
+    SDStreamIn++;
+    SDStreamState = SD_STREAM_RX_TOKEN;
+  }
+  else
+  {
+    SD_STATISTICS_ADD(WriteBlockNb, 1);
+
+    /*!< Read data response xxx0sss1 */
+    for (i = 0; i < SD_STREAM_POLL_NB; i++)
+    {
+      response = SD_ReadByte();
+      if ((response & 0x11) == 0x01)
+      {
+        break;
+      }
+    }
+
+    if ((response & 0x1F) == SD_DATA_OK)
+    {
+      SDStreamState = SD_STREAM_TX_BUSY;
+    }
+    else
+    {
+      SDStreamState = SD_STREAM_ERROR;
+    }
+  }
+
+  SD_StreamNext();
+}
+
+/**
+  * @brief  Starts transferring a block with the DMA.
+  * @param  pBuffer: pointer to the block to transfer.
+  * @param  Direction: SD_DIRECTION_RX to read or SD_DIRECTION_TX to write.
+  * @retval None
+  */
+static void SD_DMAStart(uint8_t* pBuffer, uint8_t Direction)
+{
+  SDDataPointer = pBuffer;
+  SDDataNum = SD_BLOCK_SIZE;
+  SDDataDirection = Direction;
+
+  SD_DMATransfer();
+}
+
+/**
+  * @brief  Starts the DMA transfer of the next part of the block or, once all
+  *         the block is transferred, ends it.
+  * @param  None
+  * @retval None
+  */
+static void SD_DMATransfer(void)
+{
+  uint8_t size = 0;
+
+  if (SDDataNum == 0)
+  {
+    /*!< Disable the SD_SPI DMA requests */
+    SPI_DMACmd(SD_SPI, SPI_DMAReq_RX, DISABLE);
+    SPI_DMACmd(SD_SPI, SPI_DMAReq_TX, DISABLE);
+
+    SD_StreamEndBlock();
+    return;
+  }
+
+  size = (uint8_t)((SDDataNum > SD_DMA_MAX_SIZE) ? SD_DMA_MAX_SIZE : SDDataNum);
+
+  /* Configure the DMA channels with the buffer address and the buffer size */
+  SD_LowLevel_DMAConfig((uint16_t)SDDataPointer, size, SDDataDirection);
+  SDDataPointer += size;
+  SDDataNum -= size;
+
+  if (SDDataDirection == SD_DIRECTION_RX)
+  {
+    /* The Rx channel ends the transfer: enabled first */
+    DMA_ITConfig(SD_SPI_DMA_CHANNEL_RX, DMA_ITx_TC, ENABLE);
+    SPI_DMACmd(SD_SPI, SPI_DMAReq_RX, ENABLE);
+    DMA_Cmd(SD_SPI_DMA_CHANNEL_RX, ENABLE);
+  }
+  else
+  {
+    DMA_ITConfig(SD_SPI_DMA_CHANNEL_TX, DMA_ITx_TC, ENABLE);
+  }
+
+  SPI_DMACmd(SD_SPI, SPI_DMAReq_TX, ENABLE);
+  DMA_Cmd(SD_SPI_DMA_CHANNEL_TX, ENABLE);
+}
+
+/**
+  * @brief  Ends the current DMA transfer and starts the next one.
+  * @param  None
+  * @retval None
+  */
+static void SD_DMAComplete(void)
+{
+  /* Disable the DMA Channels and Clear all their Flags */
+  DMA_Cmd(SD_SPI_DMA_CHANNEL_TX, DISABLE);
+  DMA_ClearFlag(SD_SPI_DMA_FLAG_TX_TC);
+
+  if (SDDataDirection == SD_DIRECTION_RX)
+  {
+    DMA_Cmd(SD_SPI_DMA_CHANNEL_RX, DISABLE);
+    DMA_ClearFlag(SD_SPI_DMA_FLAG_RX_TC);
+  }
+  else
+  {
+    /*!< Wait till all data have been physically transferred on the bus */
+    while (SPI_GetFlagStatus(SD_SPI, SPI_FLAG_TXE) == RESET)
+    {}
+    while (SPI_GetFlagStatus(SD_SPI, SPI_FLAG_BSY) != RESET)
+    {}
+
+    /*!< Discard the bytes received: reading DR then SR clears the overrun */
+    SPI_ReceiveData(SD_SPI);
+    SPI_GetFlagStatus(SD_SPI, SPI_FLAG_OVR);
+  }
+
+  SD_DMATransfer();
+}
+
+#ifdef SD_USE_CRC
+/**
+  * @brief  Computes the CRC16 of a block.
+  * @param  pBuffer: pointer to the block.
+  * @param  NumByte: number of bytes of the block.
+  * @retval The CRC16 of the block.
+  */
+static uint16_t SD_CRC16(uint8_t* pBuffer, uint16_t NumByte)
+{
+  uint16_t crc = 0;
+
+  while (NumByte--)
+  {
+    crc = SD_CRC16_UPDATE(crc, *pBuffer++);
+  }
+
+  return crc;
+}
+#endif /* SD_USE_CRC */
+#endif /* SD_USE_DMA */
+
 /**
   * @}
   */
@@ -45,6 +45,19 @@
 /** @defgroup STM8_EVAL_SPI_SD_Exported_Types
   * @{
   */ 
+/**
+  * @brief  Card accesses counted since the last SD_ClearStatistics()
+  */
+typedef struct
+{
+  uint32_t CommandNb;     /*!< Commands sent */
+  uint32_t ReadBlockNb;   /*!< Data blocks read */
+  uint32_t WriteBlockNb;  /*!< Data blocks written */
+  uint32_t WaitNb;        /*!< Bytes read waiting for a response or a data
+                               token: the access time of the card */
+  uint32_t BusyNb;        /*!< Bytes read while the card was busy */
+}SD_Statistics_TypeDef;
+
 
 /** 
   * @brief  Card Specific Data: CSD Register   
@@ -114,8 +127,10 @@ typedef struct
 {
   SD_CSD SD_csd;
   SD_CID SD_cid;
-  uint32_t CardCapacity;  /*!< Card Capacity */
+  uint32_t CardCapacity;  /*!< Card Capacity in bytes, 0xFFFFFFFF above 4 GB */
   uint32_t CardBlockSize; /*!< Card Block Size */
+  uint32_t CardBlockNb;   /*!< Card Capacity in blocks of 512 bytes */
+  uint8_t  CardType;      /*!< Card type, see SD_GetCardType() */
 } SD_CardInfo;
 
 /**
@@ -165,9 +180,51 @@ typedef struct
 #define SD_START_DATA_SINGLE_BLOCK_READ    0xFE  /*!< Data token start byte, Start Single Block Read */
 #define SD_START_DATA_MULTIPLE_BLOCK_READ  0xFE  /*!< Data token start byte, Start Multiple Block Read */
 #define SD_START_DATA_SINGLE_BLOCK_WRITE   0xFE  /*!< Data token start byte, Start Single Block Write */
-#define SD_START_DATA_MULTIPLE_BLOCK_WRITE 0xFD  /*!< Data token start byte, Start Multiple Block Write */
+#define SD_START_DATA_MULTIPLE_BLOCK_WRITE 0xFC  /*!< Data token start byte, Start Multiple Block Write */
 #define SD_STOP_DATA_MULTIPLE_BLOCK_WRITE  0xFD  /*!< Data toke stop byte, Stop Multiple Block Write */
 
+/**
+  * @brief  Uncomment the line below to send the number of blocks of the
+  *         multiple block writes to the card (ACMD23), which may then erase
+  *         them beforehand
+  */
+/* #define SD_USE_PRE_ERASE */
+
+/**
+  * @brief  Uncomment the line below to turn the CRC checking of the card on
+  *         (CRC_ON_OFF): the commands are sent with their CRC7, computed by
+  *         the CRC unit of the SD_SPI, and the data blocks with their CRC16,
+  *         the CRC16 of the blocks read being checked
+  */
+/* #define SD_USE_CRC */
+
+/**
+  * @brief  Uncomment the line below to count the commands, blocks and waits
+  *         of the card accesses, to compare the single and multiple block
+  *         transfers: see SD_GetStatistics()
+  */
+/* #define SD_USE_STATISTICS */
+
+/**
+  * @brief  Bytes read by SD_StreamTick() when looking for the data token of a
+  *         block or for the end of the programming of a block
+  */
+#define SD_STREAM_POLL_NB     8
+
+/**
+  * @brief  SD_StreamTick() calls without progress before a stream fails
+  */
+#define SD_STREAM_TIMEOUT     500
+
+/**
+  * @brief  Card types found by SD_Init()
+  */
+#define SD_CARD_UNKNOWN              ((uint8_t)0x00)  /*!< No card initialized */
+#define SD_CARD_MMC                  ((uint8_t)0x01)  /*!< MultiMediaCard */
+#define SD_CARD_STD_CAPACITY_V1      ((uint8_t)0x02)  /*!< SD card version 1.x */
+#define SD_CARD_STD_CAPACITY_V2      ((uint8_t)0x03)  /*!< SD card version 2.0, standard capacity */
+#define SD_CARD_HIGH_CAPACITY        ((uint8_t)0x04)  /*!< SDHC or SDXC card: block addressing */
+
 /**
   * @brief  SD detection on its memory slot
   */
@@ -180,6 +237,7 @@ typedef struct
   */
 #define SD_CMD_GO_IDLE_STATE          0   /*!< CMD0 = 0x40 */
 #define SD_CMD_SEND_OP_COND           1   /*!< CMD1 = 0x41 */
+#define SD_CMD_SEND_IF_COND           8   /*!< CMD8 = 0x48 */
 #define SD_CMD_SEND_CSD               9   /*!< CMD9 = 0x49 */
 #define SD_CMD_SEND_CID               10  /*!< CMD10 = 0x4A */
 #define SD_CMD_STOP_TRANSMISSION      12  /*!< CMD12 = 0x4C */
@@ -201,6 +259,15 @@ typedef struct
 #define SD_CMD_ERASE_GRP_END          36  /*!< CMD36 = 0x64 */
 #define SD_CMD_UNTAG_ERASE_GROUP      37  /*!< CMD37 = 0x65 */
 #define SD_CMD_ERASE                  38  /*!< CMD38 = 0x66 */
+#define SD_CMD_APP_CMD                55  /*!< CMD55 = 0x77 */
+#define SD_CMD_READ_OCR               58  /*!< CMD58 = 0x7A */
+#define SD_CMD_CRC_ON_OFF             59  /*!< CMD59 = 0x7B */
+
+/**
+  * @brief  Application specific commands, sent after SD_CMD_APP_CMD
+  */
+#define SD_ACMD_SET_WR_BLK_ERASE_COUNT 23 /*!< ACMD23 = 0x57 */
+#define SD_ACMD_SD_SEND_OP_COND       41  /*!< ACMD41 = 0x69 */
 
 /**
   * @}
@@ -227,13 +294,35 @@ typedef struct
 void SD_DeInit(void);  
 uint8_t SD_Init(void);
 uint8_t SD_Detect(void);
+uint8_t SD_GetCardType(void);
 uint8_t SD_GetCardInfo(SD_CardInfo *cardinfo);
 uint8_t SD_ReadBlock(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize);
+uint8_t SD_ReadMultiBlocks(uint8_t* pBuffer, uint32_t ReadAddr, uint16_t BlockSize, uint32_t NumberOfBlocks);
 uint8_t SD_ReadBuffer(uint8_t *pBuffer, uint32_t ReadAddr, uint32_t NumByteToRead);
 uint8_t SD_WriteBlock(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize);
+uint8_t SD_WriteMultiBlocks(uint8_t* pBuffer, uint32_t WriteAddr, uint16_t BlockSize, uint32_t NumberOfBlocks);
 uint8_t SD_WriteBuffer(uint8_t *pBuffer, uint32_t WriteAddr, uint32_t NumByteToWrite);
+uint8_t SD_ReadSectors(uint8_t* pBuffer, uint32_t Sector, uint32_t SectorNb);
+uint8_t SD_WriteSectors(uint8_t* pBuffer, uint32_t Sector, uint32_t SectorNb);
 uint8_t SD_GetCSDRegister(SD_CSD* SD_csd);
 uint8_t SD_GetCIDRegister(SD_CID* SD_cid);
+#ifdef SD_USE_DMA
+uint8_t SD_StreamReadStart(uint32_t ReadAddr);
+uint8_t* SD_StreamReadGetBlock(void);
+uint8_t SD_StreamReadStop(void);
+uint8_t SD_StreamWriteStart(uint32_t WriteAddr);
+uint8_t* SD_StreamWriteGetBuffer(void);
+void SD_StreamWriteBlock(void);
+uint8_t SD_StreamWriteStop(void);
+uint8_t SD_StreamGetStatus(void);
+void SD_StreamTick(void);
+void SD_SPI_DMA_RX_IRQHandler(void);
+void SD_SPI_DMA_TX_IRQHandler(void);
+#endif /* SD_USE_DMA */
+#ifdef SD_USE_STATISTICS
+void SD_GetStatistics(SD_Statistics_TypeDef* Statistics);
+void SD_ClearStatistics(void);
+#endif /* SD_USE_STATISTICS */
 
 void SD_SendCmd(uint8_t Cmd, uint32_t Arg, uint8_t Crc);
 uint8_t SD_GetResponse(uint8_t Response);
@@ -0,0 +1,768 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_spi_sd_fat.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   This file provides a read-only access to the files of a FAT16 or
+  *          FAT32 volume on the SD card, on top of the stm8_eval_spi_sd.c
+  *          driver. The volume is either the whole card or its first
+  *          partition.
+  *
+  *          @note The files are found by their 8.3 names ("CONFIG.TXT"), in
+  *                the root directory or in sub-directories separated by
+  *                SD_FAT_PATH_SEPARATOR ("TABLES/LUT0.BIN"). The long file
+  *                names are not supported.
+  *
+  *          @note The module RAM is a single sector buffer, holding the last
+  *                FAT, directory or data sector read, and the 20-byte handle
+  *                of each file opened:
+  *                - SD_FATReadNext() returns the data of the file sector by
+  *                  sector from this buffer, without copy.
+  *                - SD_FATRead() copies the data into the application buffer.
+  *                  The whole sectors are read directly into it, the
+  *                  contiguous ones with a single multiple block read.
+  *                A FAT sector gives the next cluster of a file and, in the
+  *                same pass, the clusters contiguous to it: the FAT is only
+  *                read again at the end of this run of clusters. A file
+  *                written in one go is usually contiguous, and then read with
+  *                a few multiple block reads and FAT sector reads.
+  *                When SD_FAT_USE_BLOCK_CACHE is defined, the sectors are read
+  *                through the stm8_eval_block.c cache instead of the sector
+  *                buffer: the FAT and directory sectors stay in RAM while the
+  *                file data is read by SD_FATReadNext().
+  *
+  *          @note The sectors are read by their sector number, with
+  *                SD_ReadSectors(): the whole capacity of the high capacity
+  *                cards is reachable.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_spi_sd_fat.h"
+#ifdef SD_FAT_USE_BLOCK_CACHE
+#include "stm8_eval_block.h"
+#endif /* SD_FAT_USE_BLOCK_CACHE */
+
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_SPI_SD_FAT
+  * @brief      This file includes the FAT file reader of the SD card of
+  *             STM8-EVAL boards.
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Private_Types
+  * @{
+  */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Private_Defines
+  * @{
+  */
+#define SD_FAT_NO_SECTOR        ((uint32_t)0xFFFFFFFF) /* Sector buffer empty */
+#define SD_FAT_EOC              ((uint32_t)0x0FFFFFF8) /* End of cluster chain */
+#define SD_FAT_DIR_SIZE         ((uint32_t)0xFFFFFFFF) /* Directory: read up to the end of its chain */
+
+/* Directory entries */
+#define SD_FAT_ENTRY_SIZE       32
+#define SD_FAT_NAME_SIZE        11    /* Name and extension, padded with spaces */
+#define SD_FAT_ENTRY_END        0x00  /* No more entries in the directory */
+#define SD_FAT_ENTRY_FREE       0xE5  /* Deleted file */
+#define SD_FAT_ATTR_VOLUME_ID   0x08  /* Volume label or long file name part */
+#define SD_FAT_ATTR_DIRECTORY   0x10
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Private_Macros
+  * @{
+  */
+/**
+  * @brief  Little endian fields of the FAT structures
+  */
+#define SD_FAT_WORD(p)  ((uint16_t)(((uint16_t)(p)[1] << 8) | (p)[0]))
+#define SD_FAT_LONG(p)  (((uint32_t)SD_FAT_WORD((p) + 2) << 16) | SD_FAT_WORD(p))
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Private_Variables
+  * @{
+  */
+/* Volume mounted by SD_FATMount() */
+static uint8_t SDFATType = SD_FAT_NONE;
+static uint8_t SDFATClusterShift = 0;     /* Cluster size: 1 << SDFATClusterShift bytes */
+static uint32_t SDFATFatStart = 0;        /* First sector of the FAT */
+static uint32_t SDFATRootStart = 0;       /* First sector of the FAT16 root directory */
+static uint32_t SDFATRootSize = 0;        /* Bytes of the FAT16 root directory */
+static uint32_t SDFATRootCluster = 0;     /* First cluster of the FAT32 root directory */
+static uint32_t SDFATDataStart = 0;       /* Sector of the cluster 2 */
+static uint32_t SDFATClusterNb = 0;
+
+/* Sector buffer */
+#ifdef SD_FAT_USE_BLOCK_CACHE
+static uint8_t* SDFATBuffer = 0;          /* Last sector read, in the block cache */
+#else
+static uint8_t SDFATBuffer[SD_BLOCK_SIZE];
+static uint32_t SDFATBufferSector = SD_FAT_NO_SECTOR;
+#endif /* SD_FAT_USE_BLOCK_CACHE */
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Private_Function_Prototypes
+  * @{
+  */
+static ErrorStatus SD_FATLoadSector(uint32_t Sector);
+static ErrorStatus SD_FATGetSector(SD_FATFile_TypeDef* File, uint32_t* Sector);
+static ErrorStatus SD_FATNextCluster(SD_FATFile_TypeDef* File);
+static uint32_t SD_FATGetEntry(uint32_t Cluster);
+static void SD_FATScanRun(SD_FATFile_TypeDef* File);
+static void SD_FATRewind(SD_FATFile_TypeDef* File);
+static const char* SD_FATGetName(const char* Path, uint8_t* Name);
+/**
+  * @}
+  */
+
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Private_Functions
+  * @{
+  */
+/**
+  * @brief  Mounts the FAT volume of the SD card.
+  * @note   The SD must have been initialized by SD_Init().
+  * @param  None
+  * @retval The FAT type: SD_FAT_16, SD_FAT_32, or SD_FAT_NONE when no
+  *         supported volume is found.
+  */
+uint8_t SD_FATMount(void)
+{
+  uint32_t start = 0, total = 0, fatsize = 0, rootsectors = 0;
+  uint8_t* p = 0;
+  uint8_t clustersectors = 0;
+
+  SDFATType = SD_FAT_NONE;
+#ifdef SD_FAT_USE_BLOCK_CACHE
+  BLOCK_Invalidate(&BLOCK_SDDevice);
+#else
+  SDFATBufferSector = SD_FAT_NO_SECTOR;
+#endif /* SD_FAT_USE_BLOCK_CACHE */
+
+  if (SD_FATLoadSector(0) != SUCCESS)
+  {
+    return SD_FAT_NONE;
+  }
+  p = SDFATBuffer;
+
+  /*!< Sector 0 is a boot sector, starting with a jump instruction, or a
+       master boot record giving the first sector of the first partition */
+  if ((p[0] != 0xEB) && (p[0] != 0xE9))
+  {
+    if ((p[510] != 0x55) || (p[511] != 0xAA))
+    {
+      return SD_FAT_NONE;
+    }
+    start = SD_FAT_LONG(p + 0x1C6);
+    if (SD_FATLoadSector(start) != SUCCESS)
+    {
+      return SD_FAT_NONE;
+    }
+    p = SDFATBuffer;
+  }
+
+  /*!< BIOS parameter block: 512-byte sectors, 2^n sectors per cluster */
+  clustersectors = p[13];
+  if ((p[510] != 0x55) || (p[511] != 0xAA) || (SD_FAT_WORD(p + 11) != SD_BLOCK_SIZE)
+      || (clustersectors == 0) || ((clustersectors & (clustersectors - 1)) != 0))
+  {
+    return SD_FAT_NONE;
+  }
+
+  SDFATClusterShift = 9;
+  while (clustersectors > 1)
+  {
+    clustersectors >>= 1;
+    SDFATClusterShift++;
+  }
+
+  total = SD_FAT_WORD(p + 19);
+  if (total == 0)
+  {
+    total = SD_FAT_LONG(p + 32);
+  }
+  fatsize = SD_FAT_WORD(p + 22);
+  if (fatsize == 0)
+  {
+    fatsize = SD_FAT_LONG(p + 36);
+  }
+  SDFATRootSize = (uint32_t)SD_FAT_WORD(p + 17) * SD_FAT_ENTRY_SIZE;
+  rootsectors = (SDFATRootSize + SD_BLOCK_SIZE - 1) >> 9;
+
+  /*!< Reserved sectors, FATs, FAT16 root directory then clusters */
+  SDFATFatStart = start + SD_FAT_WORD(p + 14);
+  SDFATRootStart = SDFATFatStart + (p[16] * fatsize);
+  SDFATDataStart = SDFATRootStart + rootsectors;
+  SDFATClusterNb = (total - (SDFATDataStart - start)) >> (SDFATClusterShift - 9);
+  SDFATRootCluster = SD_FAT_LONG(p + 44);
+
+  /*!< The FAT type only depends on the number of clusters (FAT12 not
+       supported) */
+  if (SDFATClusterNb >= 65525)
+  {
+    SDFATType = SD_FAT_32;
+  }
+  else if (SDFATClusterNb >= 4085)
+  {
+    SDFATType = SD_FAT_16;
+  }
+
+  return SDFATType;
+}
+
+/**
+  * @brief  Opens a file of the mounted volume.
+  * @param  File: pointer to the file handle to initialize.
+  * @param  Path: 8.3 names of the sub-directories, if any, and of the file,
+  *         separated by SD_FAT_PATH_SEPARATOR. The case is not significant.
+  * @retval SUCCESS if the file is found, ERROR otherwise
+  */
+ErrorStatus SD_FATOpen(SD_FATFile_TypeDef* File, const char* Path)
+{
+  SD_FATFile_TypeDef dir;
+  uint8_t name[SD_FAT_NAME_SIZE];
+  uint8_t* entry = 0;
+  uint16_t num = 0, offset = 0;
+  uint8_t i = 0;
+
+  if (SDFATType == SD_FAT_NONE)
+  {
+    return ERROR;
+  }
+
+  /*!< Root directory: fixed area of the FAT16 volumes (first cluster 0) */
+  if (SDFATType == SD_FAT_16)
+  {
+    dir.FirstCluster = 0;
+    dir.Size = SDFATRootSize;
+  }
+  else
+  {
+    dir.FirstCluster = SDFATRootCluster;
+    dir.Size = SD_FAT_DIR_SIZE;
+  }
+  SD_FATRewind(&dir);
+
+  while (1)
+  {
+    Path = SD_FATGetName(Path, name);
+    if (Path == 0)
+    {
+      return ERROR;
+    }
+
+    /*!< Look for the name in the directory, a sector at a time */
+    entry = 0;
+    while (entry == 0)
+    {
+      entry = SD_FATReadNext(&dir, &num);
+      if (entry == 0)
+      {
+        return ERROR;
+      }
+
+      for (offset = 0; offset < num; offset += SD_FAT_ENTRY_SIZE)
+      {
+        if (entry[offset] == SD_FAT_ENTRY_END)
+        {
+          return ERROR;
+        }
+        if ((entry[offset] != SD_FAT_ENTRY_FREE)
+            && ((entry[offset + 11] & SD_FAT_ATTR_VOLUME_ID) == 0))
+        {
+          for (i = 0; (i < SD_FAT_NAME_SIZE) && (entry[offset + i] == name[i]); i++)
+          {}
+          if (i == SD_FAT_NAME_SIZE)
+          {
+            break;
+          }
+        }
+      }
+
+      if (offset < num)
+      {
+        entry += offset;
+      }
+      else
+      {
+        entry = 0;
+      }
+    }
+
+    File->FirstCluster = ((uint32_t)SD_FAT_WORD(entry + 20) << 16) | SD_FAT_WORD(entry + 26);
+    File->Size = SD_FAT_LONG(entry + 28);
+
+    if (*Path == '\0')
+    {
+      /*!< Last name: a file with its data clusters */
+      if (((entry[11] & SD_FAT_ATTR_DIRECTORY) != 0) ||
+          ((File->Size != 0) && ((File->FirstCluster < 2) ||
+                                 (File->FirstCluster >= SDFATClusterNb + 2))))
+      {
+        return ERROR;
+      }
+      SD_FATRewind(File);
+      return SUCCESS;
+    }
+
+    /*!< Name followed by a separator: a sub-directory */
+    if (((entry[11] & SD_FAT_ATTR_DIRECTORY) == 0) || (File->FirstCluster < 2))
+    {
+      return ERROR;
+    }
+    Path++;
+    dir.FirstCluster = File->FirstCluster;
+    dir.Size = SD_FAT_DIR_SIZE;
+    SD_FATRewind(&dir);
+  }
+}
+
+/**
+  * @brief  Returns the next data of a file, up to the end of its sector.
+  * @param  File: pointer to the file handle.
+  * @param  NumByte: pointer to the variable receiving the number of bytes
+  *         returned, 0 at the end of the file.
+  * @retval Pointer to the data in the sector buffer of the module, valid until
+  *         the next call of a function of the module (or of the block cache
+  *         with SD_FAT_USE_BLOCK_CACHE), or 0 at the end of the file or on a
+  *         read error.
+  */
+uint8_t* SD_FATReadNext(SD_FATFile_TypeDef* File, uint16_t* NumByte)
+{
+  uint32_t sector = 0;
+  uint16_t offset = 0, num = 0;
+
+  *NumByte = 0;
+
+  if ((File->Position >= File->Size) || (SD_FATGetSector(File, &sector) != SUCCESS)
+      || (SD_FATLoadSector(sector) != SUCCESS))
+  {
+    return 0;
+  }
+
+  offset = (uint16_t)(File->Position & (SD_BLOCK_SIZE - 1));
+  num = (uint16_t)(SD_BLOCK_SIZE - offset);
+  if (num > (File->Size - File->Position))
+  {
+    num = (uint16_t)(File->Size - File->Position);
+  }
+
+  File->Position += num;
+  *NumByte = num;
+
+  return &SDFATBuffer[offset];
+}
+
+/**
+  * @brief  Reads data from a file.
+  * @note   The whole sectors are read directly into pBuffer, the consecutive
+  *         sectors of contiguous clusters with a single multiple block read.
+  * @param  File: pointer to the file handle.
+  * @param  pBuffer: pointer to the buffer that receives the data.
+  * @param  NumByteToRead: number of bytes to read.
+  * @retval Number of bytes read, less than NumByteToRead at the end of the
+  *         file or on a read error.
+  */
+uint32_t SD_FATRead(SD_FATFile_TypeDef* File, uint8_t* pBuffer, uint32_t NumByteToRead)
+{
+  uint32_t count = 0, left = 0, sector = 0, num = 0, offset = 0, clusters = 0;
+  uint8_t* pData = 0;
+  uint16_t size = 0, index = 0;
+
+  if (NumByteToRead > (File->Size - File->Position))
+  {
+    NumByteToRead = File->Size - File->Position;
+  }
+
+  while (count < NumByteToRead)
+  {
+    left = NumByteToRead - count;
+
+    if (((File->Position & (SD_BLOCK_SIZE - 1)) == 0) && (left >= SD_BLOCK_SIZE))
+    {
+      if (SD_FATGetSector(File, &sector) != SUCCESS)
+      {
+        break;
+      }
+
+      /*!< Sectors up to the end of the cluster and of the clusters
+           contiguous to it */
+      offset = File->Position & (((uint32_t)1 << SDFATClusterShift) - 1);
+      num = ((((uint32_t)1 << SDFATClusterShift) - offset) >> 9)
+            + (File->RunLength << (SDFATClusterShift - 9));
+      if (num > (left >> 9))
+      {
+        num = left >> 9;
+      }
+
+      if (SD_ReadSectors(pBuffer + count, sector, num) != SD_RESPONSE_NO_ERROR)
+      {
+        break;
+      }
+
+      /*!< Cluster of the last byte read */
+      clusters = (offset + (num << 9) - 1) >> SDFATClusterShift;
+      File->Cluster += clusters;
+      File->RunLength -= clusters;
+
+      File->Position += num << 9;
+      count += num << 9;
+    }
+    else
+    {
+      pData = SD_FATReadNext(File, &size);
+      if (pData == 0)
+      {
+        break;
+      }
+      if (size > left)
+      {
+        /*!< Only the beginning of the sector is wanted */
+        File->Position -= size - left;
+        size = (uint16_t)left;
+      }
+      for (index = 0; index < size; index++)
+      {
+        pBuffer[count++] = pData[index];
+      }
+    }
+  }
+
+  return count;
+}
+
+/**
+  * @brief  Sets the position of the next data read from a file.
+  * @note   A position before the current one follows the cluster chain from
+  *         the beginning of the file again.
+  * @param  File: pointer to the file handle.
+  * @param  Position: offset from the beginning of the file, at most its size.
+  * @retval SUCCESS if the position is set, ERROR otherwise
+  */
+ErrorStatus SD_FATSeek(SD_FATFile_TypeDef* File, uint32_t Position)
+{
+  uint32_t index = 0, target = 0, step = 0;
+
+  if (Position > File->Size)
+  {
+    return ERROR;
+  }
+
+  if (File->FirstCluster >= 2)
+  {
+    /*!< Index in the chain of the cluster of the byte before the position */
+    index = (File->Position == 0) ? 0 : ((File->Position - 1) >> SDFATClusterShift);
+    target = (Position == 0) ? 0 : ((Position - 1) >> SDFATClusterShift);
+
+    if (target < index)
+    {
+      SD_FATRewind(File);
+      index = 0;
+    }
+
+    while (index < target)
+    {
+      if (File->RunLength != 0)
+      {
+        /*!< Contiguous clusters skipped without reading the FAT */
+        step = target - index;
+        if (step > File->RunLength)
+        {
+          step = File->RunLength;
+        }
+        File->Cluster += step;
+        File->RunLength -= step;
+        index += step;
+      }
+      else
+      {
+        if (SD_FATNextCluster(File) != SUCCESS)
+        {
+          return ERROR;
+        }
+        index++;
+      }
+    }
+  }
+
+  File->Position = Position;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reads a sector into the sector buffer, unless already there.
+  * @param  Sector: sector number.
+  * @retval SUCCESS if the sector is in the buffer, ERROR otherwise
+  */
+static ErrorStatus SD_FATLoadSector(uint32_t Sector)
+{
+#ifdef SD_FAT_USE_BLOCK_CACHE
+  SDFATBuffer = BLOCK_Get(&BLOCK_SDDevice, Sector);
+  if (SDFATBuffer == 0)
+  {
+    return ERROR;
+  }
+#else
+  if (Sector != SDFATBufferSector)
+  {
+    if (SD_ReadSectors(SDFATBuffer, Sector, 1) != SD_RESPONSE_NO_ERROR)
+    {
+      SDFATBufferSector = SD_FAT_NO_SECTOR;
+      return ERROR;
+    }
+    SDFATBufferSector = Sector;
+  }
+#endif /* SD_FAT_USE_BLOCK_CACHE */
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Returns the sector holding the byte at the position of a file,
+  *         following its cluster chain when the position enters a new
+  *         cluster.
+  * @param  File: pointer to the file handle.
+  * @param  Sector: pointer to the variable receiving the sector number.
+  * @retval SUCCESS if the sector is found, ERROR at the end of the cluster
+  *         chain or on a read error.
+  */
+static ErrorStatus SD_FATGetSector(SD_FATFile_TypeDef* File, uint32_t* Sector)
+{
+  uint32_t offset = 0;
+
+  if (File->FirstCluster == 0)
+  {
+    /*!< FAT16 root directory */
+    *Sector = SDFATRootStart + (File->Position >> 9);
+    return SUCCESS;
+  }
+
+  offset = File->Position & (((uint32_t)1 << SDFATClusterShift) - 1);
+  if ((offset == 0) && (File->Position != 0))
+  {
+    if (SD_FATNextCluster(File) != SUCCESS)
+    {
+      return ERROR;
+    }
+  }
+
+  *Sector = SDFATDataStart + ((File->Cluster - 2) << (SDFATClusterShift - 9)) + (offset >> 9);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Moves a file to the next cluster of its chain.
+  * @param  File: pointer to the file handle.
+  * @retval SUCCESS if the next cluster is valid, ERROR otherwise
+  */
+static ErrorStatus SD_FATNextCluster(SD_FATFile_TypeDef* File)
+{
+  if (File->RunLength != 0)
+  {
+    File->Cluster++;
+    File->RunLength--;
+    return SUCCESS;
+  }
+
+  File->Cluster = SD_FATGetEntry(File->Cluster);
+  if ((File->Cluster < 2) || (File->Cluster >= (SDFATClusterNb + 2)))
+  {
+    /*!< End of chain, free cluster or read error */
+    return ERROR;
+  }
+
+  SD_FATScanRun(File);
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Reads the FAT entry of a cluster.
+  * @param  Cluster: cluster number.
+  * @retval The next cluster of the chain, SD_FAT_EOC at its end, or 0 on a
+  *         read error.
+  */
+static uint32_t SD_FATGetEntry(uint32_t Cluster)
+{
+  uint32_t entry = 0;
+
+  if (SDFATType == SD_FAT_32)
+  {
+    /*!< 128 entries of 4 bytes per sector, 28 bits used */
+    if (SD_FATLoadSector(SDFATFatStart + (Cluster >> 7)) != SUCCESS)
+    {
+      return 0;
+    }
+    entry = SD_FAT_LONG(&SDFATBuffer[(uint16_t)(Cluster & 0x7F) << 2]) & 0x0FFFFFFF;
+  }
+  else
+  {
+    /*!< 256 entries of 2 bytes per sector */
+    if (SD_FATLoadSector(SDFATFatStart + (Cluster >> 8)) != SUCCESS)
+    {
+      return 0;
+    }
+    entry = SD_FAT_WORD(&SDFATBuffer[(uint16_t)(Cluster & 0xFF) << 1]);
+    if (entry >= 0xFFF8)
+    {
+      entry = SD_FAT_EOC;
+    }
+  }
+
+  return entry;
+}
+
+/**
+  * @brief  Counts the clusters following the current cluster of a file
+  *         contiguously, in the FAT sector describing it.
+  * @param  File: pointer to the file handle.
+  * @retval None
+  */
+static void SD_FATScanRun(SD_FATFile_TypeDef* File)
+{
+  uint32_t cluster = File->Cluster;
+  uint32_t last = cluster | ((SDFATType == SD_FAT_32) ? 0x7F : 0xFF);
+
+  if (last >= (SDFATClusterNb + 1))
+  {
+    last = SDFATClusterNb;
+  }
+
+  File->RunLength = 0;
+  while ((cluster <= last) && (SD_FATGetEntry(cluster) == (cluster + 1)))
+  {
+    cluster++;
+    File->RunLength++;
+  }
+}
+
+/**
+  * @brief  Sets the position of a file, or directory, to its beginning.
+  * @param  File: pointer to the file handle.
+  * @retval None
+  */
+static void SD_FATRewind(SD_FATFile_TypeDef* File)
+{
+  File->Position = 0;
+  File->Cluster = File->FirstCluster;
+  File->RunLength = 0;
+
+  if (File->FirstCluster >= 2)
+  {
+    SD_FATScanRun(File);
+  }
+}
+
+/**
+  * @brief  Converts the first name of a path into a directory entry name:
+  *         upper case name and extension padded with spaces.
+  * @param  Path: path starting with the name.
+  * @param  Name: pointer to the SD_FAT_NAME_SIZE bytes receiving the name.
+  * @retval The rest of the path, from the separator following the name, or 0
+  *         when the name is not a valid 8.3 name.
+  */
+static const char* SD_FATGetName(const char* Path, uint8_t* Name)
+{
+  uint8_t i = 0, max = 8;
+  char c = 0;
+
+  for (i = 0; i < SD_FAT_NAME_SIZE; i++)
+  {
+    Name[i] = ' ';
+  }
+
+  i = 0;
+  while ((*Path != '\0') && (*Path != SD_FAT_PATH_SEPARATOR))
+  {
+    c = *Path++;
+    if (c == '.')
+    {
+      if (max != 8)
+      {
+        return 0;
+      }
+      /*!< The extension follows the 8 characters of the name */
+      i = 8;
+      max = SD_FAT_NAME_SIZE;
+    }
+    else
+    {
+      if (i >= max)
+      {
+        return 0;
+      }
+      if ((c >= 'a') && (c <= 'z'))
+      {
+        c -= 'a' - 'A';
+      }
+      Name[i++] = (uint8_t)c;
+    }
+  }
+
+  if (Name[0] == ' ')
+  {
+    return 0;
+  }
+
+  return Path;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    stm8_eval_spi_sd_fat.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header for stm8_eval_spi_sd_fat.c module
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8_EVAL_SPI_SD_FAT_H
+#define __STM8_EVAL_SPI_SD_FAT_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8_eval_spi_sd.h"
+/** @addtogroup Utilities
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL
+  * @{
+  */
+
+/** @addtogroup Common
+  * @{
+  */
+
+/** @addtogroup STM8_EVAL_SPI_SD_FAT
+  * @{
+  */
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Exported_Types
+  * @{
+  */
+/**
+  * @brief  File opened by SD_FATOpen()
+  */
+typedef struct
+{
+  uint32_t Size;          /*!< File size in bytes */
+  uint32_t Position;      /*!< Offset of the next byte to read */
+  uint32_t FirstCluster;  /*!< First cluster, 0 for an empty file */
+  uint32_t Cluster;       /*!< Cluster of the last byte read (of the first
+                               byte before any read) */
+  uint32_t RunLength;     /*!< Clusters known to follow Cluster contiguously */
+} SD_FATFile_TypeDef;
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Exported_Constants
+  * @{
+  */
+/**
+  * @brief  FAT types found by SD_FATMount()
+  */
+#define SD_FAT_NONE      ((uint8_t)0x00)  /*!< No volume mounted */
+#define SD_FAT_16        ((uint8_t)0x10)
+#define SD_FAT_32        ((uint8_t)0x20)
+
+/**
+  * @brief  Separator of the directory names in the paths given to SD_FATOpen()
+  */
+#define SD_FAT_PATH_SEPARATOR  '/'
+
+/* Uncomment the line below to read the sectors through the block cache of
+   stm8_eval_block.c (BLOCK_Init() to be called first) instead of the sector
+   buffer of the module */
+/* #define SD_FAT_USE_BLOCK_CACHE */
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Exported_Macros
+  * @{
+  */
+/**
+  * @}
+  */
+
+/** @defgroup STM8_EVAL_SPI_SD_FAT_Exported_Functions
+  * @{
+  */
+uint8_t SD_FATMount(void);
+ErrorStatus SD_FATOpen(SD_FATFile_TypeDef* File, const char* Path);
+uint8_t* SD_FATReadNext(SD_FATFile_TypeDef* File, uint16_t* NumByte);
+uint32_t SD_FATRead(SD_FATFile_TypeDef* File, uint8_t* pBuffer, uint32_t NumByteToRead);
+ErrorStatus SD_FATSeek(SD_FATFile_TypeDef* File, uint32_t Position);
+
+#endif /* __STM8_EVAL_SPI_SD_FAT_H */
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -310,6 +310,14 @@ void SD_LowLevel_DeInit(void)
 
   /*!< Configure SD_SPI_DETECT_PIN pin: SD Card detect pin */
   GPIO_Init(SD_DETECT_GPIO_PORT, SD_DETECT_PIN, GPIO_Mode_In_FL_No_IT);
+
+#ifdef SD_USE_DMA
+  /* Disable and Deinitialize the DMA channels */
+  DMA_Cmd(SD_SPI_DMA_CHANNEL_TX, DISABLE);
+  DMA_Cmd(SD_SPI_DMA_CHANNEL_RX, DISABLE);
+  DMA_DeInit(SD_SPI_DMA_CHANNEL_TX);
+  DMA_DeInit(SD_SPI_DMA_CHANNEL_RX);
+#endif /* SD_USE_DMA */
 }
 
 /**
@@ -327,7 +335,7 @@ void SD_LowLevel_Init(void)
                             SD_SPI_SCK_PIN, ENABLE);
 
   /* SD_SPI Config */
-  SPI_Init(SD_SPI, SPI_FirstBit_MSB, SPI_BaudRatePrescaler_4, SPI_Mode_Master,
+  SPI_Init(SD_SPI, SPI_FirstBit_MSB, SD_SPI_BAUDRATE_INIT, SPI_Mode_Master,
            SPI_CPOL_High, SPI_CPHA_2Edge, SPI_Direction_2Lines_FullDuplex,
            SPI_NSS_Soft, 0x07);
 
@@ -337,8 +345,43 @@ void SD_LowLevel_Init(void)
 
   /* Set MSD ChipSelect pin in Output push-pull high level */
   GPIO_Init(SD_CS_GPIO_PORT, SD_CS_PIN, GPIO_Mode_Out_PP_High_Slow);
+
+#ifdef SD_USE_DMA
+  /*!< Enable the DMA clock */
+  CLK_PeripheralClockConfig(CLK_Peripheral_DMA1, ENABLE);
+#endif /* SD_USE_DMA */
 }
 
+#ifdef SD_USE_DMA
+/**
+  * @brief  Configures the DMA channels used by the SD driver for a transfer.
+  *         They are enabled by the driver.
+  * @param  pBuffer: address of the buffer to transmit or to receive into.
+  * @param  BufferSize: number of bytes to transfer.
+  * @param  Direction: SD_DIRECTION_TX to transmit the buffer, the bytes
+  *         received being ignored, or SD_DIRECTION_RX to receive into the
+  *         buffer, its content (filled with dummy bytes by the driver) being
+  *         transmitted.
+  * @retval None
+  */
+void SD_LowLevel_DMAConfig(uint16_t pBuffer, uint8_t BufferSize, uint8_t Direction)
+{
+  /* The Tx channel clocks the transfer in both directions: each byte is
+     read from the buffer before the Rx channel overwrites it */
+  DMA_Init(SD_SPI_DMA_CHANNEL_TX, pBuffer, SD_SPI_DR_Address, BufferSize,
+           DMA_DIR_MemoryToPeripheral, DMA_Mode_Normal, DMA_MemoryIncMode_Inc,
+           DMA_Priority_High, DMA_MemoryDataSize_Byte);
+
+  if (Direction == SD_DIRECTION_RX)
+  {
+    /* The Rx channel has the highest priority to avoid overruns */
+    DMA_Init(SD_SPI_DMA_CHANNEL_RX, pBuffer, SD_SPI_DR_Address, BufferSize,
+             DMA_DIR_PeripheralToMemory, DMA_Mode_Normal, DMA_MemoryIncMode_Inc,
+             DMA_Priority_VeryHigh, DMA_MemoryDataSize_Byte);
+  }
+}
+#endif /* SD_USE_DMA */
+
 /**
   * @brief  DeInitializes the peripherals used by the SPI FLASH driver.
   * @param  None
@@ -363,6 +406,14 @@ void sFLASH_LowLevel_DeInit(void)
 
   /*!< Configure sFLASH_CS_PIN pin: sFLASH Card CS pin */
   GPIO_Init(sFLASH_CS_GPIO_PORT, sFLASH_CS_PIN, GPIO_Mode_In_FL_No_IT);
+
+#ifdef sFLASH_USE_DMA
+  /* Disable and Deinitialize the DMA channels */
+  DMA_Cmd(sFLASH_SPI_DMA_CHANNEL_TX, DISABLE);
+  DMA_Cmd(sFLASH_SPI_DMA_CHANNEL_RX, DISABLE);
+  DMA_DeInit(sFLASH_SPI_DMA_CHANNEL_TX);
+  DMA_DeInit(sFLASH_SPI_DMA_CHANNEL_RX);
+#endif /* sFLASH_USE_DMA */
 }
 
 /**
@@ -383,8 +434,42 @@ void sFLASH_LowLevel_Init(void)
   /* Configure FLASH_CS as Output push-pull, used as Flash Chip select */
   GPIO_Init(sFLASH_CS_GPIO_PORT, sFLASH_CS_PIN, GPIO_Mode_Out_PP_High_Slow);
 
+#ifdef sFLASH_USE_DMA
+  /*!< Enable the DMA clock */
+  CLK_PeripheralClockConfig(CLK_Peripheral_DMA1, ENABLE);
+#endif /* sFLASH_USE_DMA */
+
 }
 
+#ifdef sFLASH_USE_DMA
+/**
+  * @brief  Configures the DMA channels used by the SPI FLASH driver for a
+  *         transfer. They are enabled by the driver.
+  * @param  pBuffer: address of the buffer to transmit or to receive into.
+  * @param  BufferSize: number of bytes to transfer.
+  * @param  Direction: sFLASH_DIRECTION_TX to transmit the buffer, the bytes
+  *         received being ignored, or sFLASH_DIRECTION_RX to receive into the
+  *         buffer, its content being transmitted as dummy bytes.
+  * @retval None
+  */
+void sFLASH_LowLevel_DMAConfig(uint16_t pBuffer, uint8_t BufferSize, uint8_t Direction)
+{
+  /* The Tx channel clocks the transfer in both directions: each byte is
+     read from the buffer before the Rx channel overwrites it */
+  DMA_Init(sFLASH_SPI_DMA_CHANNEL_TX, pBuffer, sFLASH_SPI_DR_Address, BufferSize,
+           DMA_DIR_MemoryToPeripheral, DMA_Mode_Normal, DMA_MemoryIncMode_Inc,
+           DMA_Priority_High, DMA_MemoryDataSize_Byte);
+
+  if (Direction == sFLASH_DIRECTION_RX)
+  {
+    /* The Rx channel has the highest priority to avoid overruns */
+    DMA_Init(sFLASH_SPI_DMA_CHANNEL_RX, pBuffer, sFLASH_SPI_DR_Address, BufferSize,
+             DMA_DIR_PeripheralToMemory, DMA_Mode_Normal, DMA_MemoryIncMode_Inc,
+             DMA_Priority_VeryHigh, DMA_MemoryDataSize_Byte);
+  }
+}
+#endif /* sFLASH_USE_DMA */
+
 /**
   * @brief  DeInitializes peripherals used by the I2C EEPROM driver.
   * @param  None
@@ -407,12 +492,6 @@ void sEE_LowLevel_DeInit(void)
 
   /*!< Configure sEE_I2C pins: SDA */
   GPIO_Init(sEE_I2C_SDA_GPIO_PORT, sEE_I2C_SDA_PIN, GPIO_Mode_In_PU_No_IT);
-
-  /* Disable and Deinitialize the DMA channels */
-  DMA_Cmd(sEE_I2C_DMA_CHANNEL_TX, DISABLE);
-  DMA_Cmd(sEE_I2C_DMA_CHANNEL_RX, DISABLE);
-  DMA_DeInit(sEE_I2C_DMA_CHANNEL_TX);
-  DMA_DeInit(sEE_I2C_DMA_CHANNEL_RX);
 }
 
 /**
@@ -424,63 +503,6 @@ void sEE_LowLevel_Init(void)
 {
   /*!< sEE_I2C Periph clock enable */
   CLK_PeripheralClockConfig(sEE_I2C_CLK, ENABLE);
-
-  /*!< Enable the DMA clock */
-  CLK_PeripheralClockConfig(CLK_Peripheral_DMA1, ENABLE);
-
-  /* I2C TX DMA Channel configuration */
-  DMA_DeInit(sEE_I2C_DMA_CHANNEL_TX);
-  DMA_Init(sEE_I2C_DMA_CHANNEL_TX,
-           0, /* This parameter will be configured durig communication */
-           sEE_I2C_DR_Address,
-           0xFF, /* This parameter will be configured durig communication */
-           DMA_DIR_PeripheralToMemory,/* This parameter will be configured durig communication */
-           DMA_Mode_Normal,
-           DMA_MemoryIncMode_Inc,
-           DMA_Priority_VeryHigh,
-           DMA_MemoryDataSize_Byte);
-
-  /* I2C RX DMA Channel configuration */
-  DMA_DeInit(sEE_I2C_DMA_CHANNEL_RX);
-  DMA_Init(sEE_I2C_DMA_CHANNEL_RX, 0, /* This parameter will be configured durig communication */
-           sEE_I2C_DR_Address,
-           0xFF, /* This parameter will be configured durig communication */
-           DMA_DIR_PeripheralToMemory,/* This parameter will be configured durig communication */
-           DMA_Mode_Normal,
-           DMA_MemoryIncMode_Inc,
-           DMA_Priority_VeryHigh,
-           DMA_MemoryDataSize_Byte);
-
-
-}
-
-
-/**
-  * @brief  Initializes DMA channel used by the I2C EEPROM driver.
-  * @param  None
-  * @retval None
-  */
-void sEE_LowLevel_DMAConfig(uint16_t pBuffer, uint8_t BufferSize, uint16_t Direction)
-{
-  /* Initialize the DMA with the new parameters */
-  if (Direction == sEE_DIRECTION_TX)
-  {
-    /* Configure the DMA Tx Channel with the buffer address and the buffer size */
-    DMA_Init(sEE_I2C_DMA_CHANNEL_TX, pBuffer, sEE_I2C_DR_Address, BufferSize,
-             DMA_DIR_MemoryToPeripheral, DMA_Mode_Normal, DMA_MemoryIncMode_Inc,
-             DMA_Priority_VeryHigh, DMA_MemoryDataSize_Byte);
-  }
-  else
-  {
-    /* Configure the DMA Rx Channel with the buffer address and the buffer size */
-    DMA_Init(sEE_I2C_DMA_CHANNEL_RX, pBuffer, sEE_I2C_DR_Address, BufferSize,
-             DMA_DIR_PeripheralToMemory, DMA_Mode_Normal, DMA_MemoryIncMode_Inc,
-             DMA_Priority_VeryHigh, DMA_MemoryDataSize_Byte);
-  }
-
-  /* Enable the DMA Channels Interrupts */
-  DMA_ITConfig(sEE_I2C_DMA_CHANNEL_TX, DMA_ITx_TC, ENABLE);
-  DMA_ITConfig(sEE_I2C_DMA_CHANNEL_RX, DMA_ITx_TC, ENABLE);
 }
 
 /**
@@ -168,6 +168,26 @@
 #define SD_DETECT_PIN                    GPIO_Pin_6                  /* PD.06 */
 #define SD_DETECT_GPIO_PORT              GPIOD                       /* GPIOD */
 
+/**
+  * @brief  SD SPI clock: the SD is identified with a clock of at most 400 kHz,
+  *         then the data is transferred with the fastest SPI clock
+  */
+#define SD_SPI_BAUDRATE_INIT             SPI_BaudRatePrescaler_64    /* 250 kHz at 16 MHz */
+#define SD_SPI_BAUDRATE_TRANSFER         SPI_BaudRatePrescaler_2     /* 8 MHz at 16 MHz */
+
+/* Uncomment the line below to transfer the blocks of the SD streams with the
+   DMA. The DMA driver must then be enabled in stm8l15x_conf.h */
+/* #define SD_USE_DMA */
+
+#define SD_SPI_DMA_CHANNEL_RX            DMA1_Channel1           /* SPI1_RX */
+#define SD_SPI_DMA_CHANNEL_TX            DMA1_Channel2           /* SPI1_TX */
+#define SD_SPI_DMA_FLAG_RX_TC            DMA1_FLAG_TC1
+#define SD_SPI_DMA_FLAG_TX_TC            DMA1_FLAG_TC2
+#define SD_SPI_DR_Address                ((uint16_t)0x005204)
+
+#define SD_DIRECTION_TX                  0
+#define SD_DIRECTION_RX                  1
+
 /**
   * @}
   */
@@ -191,6 +211,19 @@
 #define sFLASH_CS_PIN                    GPIO_Pin_4                  /* PE.04 */
 #define sFLASH_CS_GPIO_PORT              GPIOE                       /* GPIOE */
 
+/* Uncomment the line below to transfer the sFLASH data with the DMA. The DMA
+   driver must then be enabled in stm8l15x_conf.h */
+/* #define sFLASH_USE_DMA */
+
+#define sFLASH_SPI_DMA_CHANNEL_RX        DMA1_Channel1           /* SPI1_RX */
+#define sFLASH_SPI_DMA_CHANNEL_TX        DMA1_Channel2           /* SPI1_TX */
+#define sFLASH_SPI_DMA_FLAG_RX_TC        DMA1_FLAG_TC1
+#define sFLASH_SPI_DMA_FLAG_TX_TC        DMA1_FLAG_TC2
+#define sFLASH_SPI_DR_Address            ((uint16_t)0x005204)
+
+#define sFLASH_DIRECTION_TX              0
+#define sFLASH_DIRECTION_RX              1
+
 /**
   * @}
   */
@@ -209,17 +242,6 @@
 #define sEE_I2C_SDA_GPIO_PORT            GPIOC                       /* GPIOC */
 #define sEE_M24C64_32
 
-#define sEE_I2C_DMA                      DMA1
-#define sEE_I2C_DMA_CHANNEL_TX           DMA1_Channel3
-#define sEE_I2C_DMA_CHANNEL_RX           DMA1_Channel0
-#define sEE_I2C_DMA_FLAG_TX_TC           DMA1_FLAG_TC3
-#define sEE_I2C_DMA_FLAG_RX_TC           DMA1_FLAG_TC0
-#define sEE_I2C_DR_Address               ((uint16_t)0x005216)
-#define sEE_USE_DMA
-
-#define sEE_DIRECTION_TX                 0
-#define sEE_DIRECTION_RX                 1
-
 /**
   * @}
   */
@@ -239,6 +261,18 @@
 #define LM75_I2C_SMBUSALERT_PIN          GPIO_Pin_4                  /* PC.04 */
 #define LM75_I2C_SMBUSALERT_GPIO_PORT    GPIOC                       /* GPIOC */
 
+/**
+  * @}
+  */
+
+/** @addtogroup STM8L1526_EVAL_LOW_LEVEL_I2C
+  * @{
+  */
+/**
+  * @brief  I2C driven by the I2C master of stm8_eval_i2c.c (sEE and LM75)
+  */
+#define I2CM_I2C                         I2C1
+
 /**
   * @}
   */
@@ -267,11 +301,12 @@ void STM_EVAL_COMInit(COM_TypeDef COM,
                       USART_Mode_TypeDef USART_Mode);
 void SD_LowLevel_DeInit(void);
 void SD_LowLevel_Init(void);
+void SD_LowLevel_DMAConfig(uint16_t pBuffer, uint8_t BufferSize, uint8_t Direction);
 void sFLASH_LowLevel_DeInit(void);
 void sFLASH_LowLevel_Init(void);
+void sFLASH_LowLevel_DMAConfig(uint16_t pBuffer, uint8_t BufferSize, uint8_t Direction);
 void sEE_LowLevel_DeInit(void);
 void sEE_LowLevel_Init(void);
-void sEE_LowLevel_DMAConfig(uint16_t pBuffer, uint8_t BufferSize, uint16_t Direction);
 void LM75_LowLevel_DeInit(void);
 void LM75_LowLevel_Init(void);
 /**
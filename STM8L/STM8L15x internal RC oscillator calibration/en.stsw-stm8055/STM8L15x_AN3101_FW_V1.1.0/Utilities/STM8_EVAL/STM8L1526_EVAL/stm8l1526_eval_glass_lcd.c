@@ -102,35 +102,176 @@ The character A for example is:
   * @brief LETTERS AND NUMBERS MAPPING DEFINITION
   */
 
-__CONST uint16_t mask[4] =
+/* Glyph map of the printable ascii characters, from ' ' (0x20) to '~' (0x7E):
+   LCD digits of the character, two digits per byte, the first one in the high
+   nibble. Letters in upper case and numbers keep the coding of the former
+   letter and number maps. */
+__CONST uint8_t GlyphMap[95][2] =
   {
-    0xF000, 0x0F00, 0x00F0, 0x000F
+    /* ' '    '!'    '"'    '#' */
+    {0x00, 0x00}, {0x20, 0x00}, {0x21, 0x00}, {0x2C, 0x69},
+    /* '$'    '%'    '&'    '\'' */
+    {0x69, 0x69}, {0x0B, 0xE0}, {0xE8, 0x13}, {0x20, 0x00},
+    /* '('    ')'    '*'    '+' */
+    {0x02, 0x02}, {0x80, 0x80}, {0xAA, 0xAA}, {0x28, 0x28},
+    /* ','    '-'    '.'    '/' */
+    {0x00, 0x80}, {0x08, 0x20}, {0x00, 0x04}, {0x02, 0x80},
+    /* '0'    '1'    '2'    '3' */
+    {0x47, 0xD1}, {0x06, 0x40}, {0x4C, 0x31}, {0x4C, 0x61},
+    /* '4'    '5'    '6'    '7' */
+    {0x0D, 0x60}, {0x49, 0x61}, {0x49, 0x71}, {0x44, 0x40},
+    /* '8'    '9'    ':'    ';' */
+    {0x4D, 0x71}, {0x4D, 0x61}, {0x20, 0x08}, {0x20, 0x80},
+    /* '<'    '='    '>'    '?' */
+    {0x02, 0x02}, {0x08, 0x21}, {0x80, 0x80}, {0x44, 0x28},
+    /* '@'    'A'    'B'    'C' */
+    {0x65, 0x31}, {0x4D, 0x70}, {0x64, 0x69}, {0x41, 0x11},
+    /* 'D'    'E'    'F'    'G' */
+    {0x64, 0x49}, {0x49, 0x11}, {0x49, 0x10}, {0x41, 0x71},
+    /* 'H'    'I'    'J'    'K' */
+    {0x0D, 0x70}, {0x60, 0x09}, {0x04, 0x51}, {0x0B, 0x12},
+    /* 'L'    'M'    'N'    'O' */
+    {0x01, 0x11}, {0x87, 0x50}, {0x85, 0x52}, {0x45, 0x51},
+    /* 'P'    'Q'    'R'    'S' */
+    {0x4D, 0x30}, {0x45, 0x53}, {0x4D, 0x32}, {0x49, 0x61},
+    /* 'T'    'U'    'V'    'W' */
+    {0x60, 0x08}, {0x05, 0x51}, {0x03, 0x90}, {0x05, 0xD2},
+    /* 'X'    'Y'    'Z'    '[' */
+    {0x82, 0x82}, {0x82, 0x08}, {0x42, 0x81}, {0x41, 0x11},
+    /* '\\'   ']'    '^'    '_' */
+    {0x80, 0x02}, {0x44, 0x41}, {0x00, 0x82}, {0x00, 0x01},
+    /* '`'    'a'    'b'    'c' */
+    {0x80, 0x00}, {0x08, 0x19}, {0x09, 0x71}, {0x08, 0x31},
+    /* 'd'    'e'    'f'    'g' */
+    {0x0C, 0x71}, {0x08, 0x91}, {0x68, 0x28}, {0x4D, 0x61},
+    /* 'h'    'i'    'j'    'k' */
+    {0x09, 0x70}, {0x00, 0x08}, {0x00, 0x41}, {0x22, 0x0A},
+    /* 'l'    'm'    'n'    'o' */
+    {0x20, 0x08}, {0x08, 0x78}, {0x08, 0x70}, {0x08, 0x71},
+    /* 'p'    'q'    'r'    's' */
+    {0x4D, 0x30}, {0x4D, 0x60}, {0x08, 0x10}, {0x00, 0x23},
+    /* 't'    'u'    'v'    'w' */
+    {0x09, 0x11}, {0x00, 0x51}, {0x00, 0x90}, {0x00, 0xD2},
+    /* 'x'    'y'    'z'    '{' */
+    {0x82, 0x82}, {0x0D, 0x61}, {0x08, 0x81}, {0x68, 0x09},
+    /* '|'    '}'    '~' */
+    {0x20, 0x08}, {0x60, 0x29}, {0x0A, 0x00}
   };
-__CONST uint8_t shift[4] =
+
+/* LCD RAM location of the segments of each character, in the bit order of the
+   glyph map: low nibble of the first byte (digit 1), its high nibble (digit 0),
+   then digits 3 and 2 */
+__CONST GLASS_Segment_TypeDef CharSegmentMap[7][16] =
   {
-    12, 8, 4, 0
+    /* Position 0 */
+    {
+      /* Digit 1: COM1 */
+      {0x06, 0x10}, {0x06, 0x20}, {0x06, 0x40}, {0x06, 0x80},
+      /* Digit 0: COM0 */
+      {0x03, 0x01}, {0x03, 0x02}, {0x03, 0x04}, {0x03, 0x08},
+      /* Digit 3: COM3 */
+      {0x0D, 0x10}, {0x0D, 0x20}, {0x0D, 0x40}, {0x0D, 0x80},
+      /* Digit 2: COM2 */
+      {0x0A, 0x01}, {0x0A, 0x02}, {0x0A, 0x04}, {0x0A, 0x08}
+    },
+    /* Position 1 */
+    {
+      /* Digit 1: COM1 */
+      {0x06, 0x01}, {0x06, 0x02}, {0x06, 0x04}, {0x06, 0x08},
+      /* Digit 0: COM0 */
+      {0x02, 0x10}, {0x02, 0x20}, {0x02, 0x40}, {0x02, 0x80},
+      /* Digit 3: COM3 */
+      {0x0D, 0x01}, {0x0D, 0x02}, {0x0D, 0x04}, {0x0D, 0x08},
+      /* Digit 2: COM2 */
+      {0x09, 0x10}, {0x09, 0x20}, {0x09, 0x40}, {0x09, 0x80}
+    },
+    /* Position 2 */
+    {
+      /* Digit 1: COM1 */
+      {0x05, 0x10}, {0x05, 0x20}, {0x05, 0x40}, {0x05, 0x80},
+      /* Digit 0: COM0 */
+      {0x02, 0x01}, {0x02, 0x02}, {0x02, 0x04}, {0x02, 0x08},
+      /* Digit 3: COM3 */
+      {0x0C, 0x10}, {0x0C, 0x20}, {0x0C, 0x40}, {0x0C, 0x80},
+      /* Digit 2: COM2 */
+      {0x09, 0x01}, {0x09, 0x02}, {0x09, 0x04}, {0x09, 0x08}
+    },
+    /* Position 3 */
+    {
+      /* Digit 1: COM1 */
+      {0x05, 0x01}, {0x05, 0x02}, {0x05, 0x04}, {0x05, 0x08},
+      /* Digit 0: COM0 */
+      {0x01, 0x10}, {0x01, 0x20}, {0x01, 0x40}, {0x01, 0x80},
+      /* Digit 3: COM3 */
+      {0x0C, 0x01}, {0x0C, 0x02}, {0x0C, 0x04}, {0x0C, 0x08},
+      /* Digit 2: COM2 */
+      {0x08, 0x10}, {0x08, 0x20}, {0x08, 0x40}, {0x08, 0x80}
+    },
+    /* Position 4 */
+    {
+      /* Digit 1: COM1 */
+      {0x04, 0x10}, {0x04, 0x20}, {0x04, 0x40}, {0x04, 0x80},
+      /* Digit 0: COM0 */
+      {0x01, 0x01}, {0x01, 0x02}, {0x01, 0x04}, {0x01, 0x08},
+      /* Digit 3: COM3 */
+      {0x0B, 0x10}, {0x0B, 0x20}, {0x0B, 0x40}, {0x0B, 0x80},
+      /* Digit 2: COM2 */
+      {0x08, 0x01}, {0x08, 0x02}, {0x08, 0x04}, {0x08, 0x08}
+    },
+    /* Position 5 */
+    {
+      /* Digit 1: COM1 */
+      {0x04, 0x01}, {0x04, 0x02}, {0x04, 0x04}, {0x04, 0x08},
+      /* Digit 0: COM0 */
+      {0x00, 0x10}, {0x00, 0x20}, {0x00, 0x40}, {0x00, 0x80},
+      /* Digit 3: COM3 */
+      {0x0B, 0x01}, {0x0B, 0x02}, {0x0B, 0x04}, {0x0B, 0x08},
+      /* Digit 2: COM2 */
+      {0x07, 0x10}, {0x07, 0x20}, {0x07, 0x40}, {0x07, 0x80}
+    },
+    /* Position 6 */
+    {
+      /* Digit 1: COM1 */
+      {0x03, 0x10}, {0x03, 0x20}, {0x03, 0x40}, {0x03, 0x80},
+      /* Digit 0: COM0 */
+      {0x00, 0x01}, {0x00, 0x02}, {0x00, 0x04}, {0x00, 0x08},
+      /* Digit 3: COM3 */
+      {0x0A, 0x10}, {0x0A, 0x20}, {0x0A, 0x40}, {0x0A, 0x80},
+      /* Digit 2: COM2 */
+      {0x07, 0x01}, {0x07, 0x02}, {0x07, 0x04}, {0x07, 0x08}
+    }
   };
 
-uint8_t digit[4];     /* Digit frame buffer */
-
-/* Letters and number map of PD_878 LCD */
-__CONST uint16_t LetterMap[26] =
+/* Glass LCD drives, from the lowest to the highest drive. The liquid crystal
+   needs a higher VLCD when it gets colder and the step-up converter a longer
+   pulse on duration when VDD is low. Only the drive valid in the whole
+   operating range is given: the lower drives are to be inserted before it
+   once their VDD and temperature limits are measured on the board glass, until
+   then USE_LCD_GLASS_ADAPTIVE_DRIVE keeps this drive */
+__CONST GLASS_Drive_TypeDef GlassDriveMap[1] =
   {
-    /* A      B      C      D      E      F      G      H      I  */
-    0x4D70, 0x6469, 0x4111, 0x6449, 0x4911, 0x4910, 0x4171, 0x0D70, 0x6009,
-    /* J      K      L      M      N      O      P      Q      R  */
-    0x0451, 0x0B12, 0x0111, 0x8750, 0x8552, 0x4551, 0x4D30, 0x4553, 0x4D32,
-    /* S      T      U      V      W      X      Y      Z  */
-    0x4961, 0x6008, 0x0551, 0x0390, 0x05D2, 0x8282, 0x8208, 0x4281
+    /* VddMin, TemperatureMin, TemperatureMax, Contrast, PulseOnDuration,
+       DeadTime, HighDrive */
+    {1800, -40, 85, LCD_Contrast_3V3, LCD_PulseOnDuration_1, LCD_DeadTime_0, DISABLE}
   };
 
-__CONST uint16_t NumberMap[10] =
+/* Glass description for the glass LCD engine */
+__CONST GLASS_Board_TypeDef GlassBoard =
   {
-    /* 0      1      2      3      4      5      6      7      8      9  */
-    0x47D1, 0x0640, 0x4C31, 0x4C61, 0x0D60, 0x4961, 0x4971, 0x4440, 0x4D71, 0x4D61
+    LCD_GLASS_CHAR_NB,          /* CharNb */
+    2,                          /* GlyphSize */
+    &GlyphMap[0][0],            /* GlyphMap */
+    &CharSegmentMap[0][0],      /* CharMap */
+    10,                         /* PointSegment: DP, digit 3 */
+    4,                          /* ExtraSegment: apostrophe X, digit 0 */
+    0x0E,                       /* RegisterNb: COM0 to COM3 */
+    1,                          /* PageNb */
+    &GlassDriveMap[0],          /* DriveMap */
+    1                           /* DriveNb */
   };
 
 __IO uint8_t str[7] = "";
+
 /**
   * @}
   */
@@ -139,7 +280,6 @@ __IO uint8_t str[7] = "";
   * @{
   */
 
-static void Convert(uint8_t* c, Point_Typedef point, Apostrophe_Typedef apostrophe);
 static void delay(__IO uint32_t nCount);
 
 /**
@@ -183,9 +323,9 @@ void LCD_GLASS_Init(void)
   LCD_PortMaskConfig(LCD_PortMaskRegister_2, 0xFF);
   LCD_PortMaskConfig(LCD_PortMaskRegister_3, 0xFF);
 
-  LCD_ContrastConfig(LCD_Contrast_3V3);
-  LCD_DeadTimeConfig(LCD_DeadTime_0);
-  LCD_PulseOnDurationConfig(LCD_PulseOnDuration_1);
+  /* Blank LCD RAM, characters rendered from the glass description, and
+     drive selected from the glass drive table */
+  GLASS_Init(&GlassBoard);
 
   LCD_Cmd(ENABLE); /*!< Enable LCD peripheral */
 }
@@ -205,205 +345,22 @@ void LCD_GLASS_Init(void)
 void LCD_GLASS_WriteChar(uint8_t* ch, Point_Typedef point,
                          Apostrophe_Typedef apostrophe, uint8_t position)
 {
-  Convert(ch, point, apostrophe);
+  uint8_t flags = 0;
 
-  switch (position)
+  if (point == POINT_ON)
   {
-      /* Position 0 on LCD (Digit1)*/
-    case 0:
-      LCD->RAM[LCD_RAMRegister_3] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_3] |=  digit[0];
-      LCD->RAM[LCD_RAMRegister_6] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_6] |=  (uint8_t)(digit[1] << 4);
-      LCD->RAM[LCD_RAMRegister_10] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_10] |=  digit[2];
-      LCD->RAM[LCD_RAMRegister_13] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_13] |=  (uint8_t)((uint8_t)digit[3] << 4);
-      break;
-
-      /* Position 1 on LCD (Digit2)*/
-    case 1:
-      LCD->RAM[LCD_RAMRegister_2] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_2] |=  (uint8_t)(digit[0] << 4);
-      LCD->RAM[LCD_RAMRegister_6] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_6] |=  digit[1];
-      LCD->RAM[LCD_RAMRegister_9] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_9] |=   (uint8_t)(digit[2] << 4);
-      LCD->RAM[LCD_RAMRegister_13] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_13] |=  digit[3];
-      break;
-
-      /* Position 2 on LCD (Digit3)*/
-    case 2:
-      LCD->RAM[LCD_RAMRegister_2] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_2] |=  digit[0];
-      LCD->RAM[LCD_RAMRegister_5] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_5] |=  (uint8_t)(digit[1] << 4);
-      LCD->RAM[LCD_RAMRegister_9] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_9] |=   digit[2];
-      LCD->RAM[LCD_RAMRegister_12] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_12] |=  (uint8_t)(digit[3] << 4);
-      break;
-
-      /* Position 3 on LCD (Digit4)*/
-    case 3:
-      LCD->RAM[LCD_RAMRegister_1] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_1] |=  (uint8_t)(digit[0] << 4);
-      LCD->RAM[LCD_RAMRegister_5] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_5] |=  digit[1];
-      LCD->RAM[LCD_RAMRegister_8] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_8] |=   (uint8_t)(digit[2] << 4);
-      LCD->RAM[LCD_RAMRegister_12] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_12] |=  digit[3];
-      break;
-
-      /* Position 4 on LCD (Digit5)*/
-    case 4:
-      LCD->RAM[LCD_RAMRegister_1] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_1] |=  digit[0];
-      LCD->RAM[LCD_RAMRegister_4] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_4] |=  (uint8_t)(digit[1] << 4);
-      LCD->RAM[LCD_RAMRegister_8] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_8] |=   digit[2];
-      LCD->RAM[LCD_RAMRegister_11] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_11] |=  (uint8_t)(digit[3] << 4);
-      break;
-
-      /* Position 5 on LCD (Digit6)*/
-    case 5:
-      LCD->RAM[LCD_RAMRegister_0] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_0] |=  (uint8_t)(digit[0] << 4);
-      LCD->RAM[LCD_RAMRegister_4] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_4] |=  digit[1];
-      LCD->RAM[LCD_RAMRegister_7] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_7] |=   (uint8_t)(digit[2] << 4);
-      LCD->RAM[LCD_RAMRegister_11] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_11] |=  digit[3];
-      break;
-
-      /* Position 6 on LCD (Digit7)*/
-    case 6:
-      LCD->RAM[LCD_RAMRegister_0] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_0] |=  digit[0];
-      LCD->RAM[LCD_RAMRegister_3] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_3] |=  (uint8_t)(digit[1] << 4);
-      LCD->RAM[LCD_RAMRegister_7] &= LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_7] |=  digit[2];
-      LCD->RAM[LCD_RAMRegister_10] &= LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_10] |=  (uint8_t)(digit[3] << 4);
-      break;
-
-    default:
-      break;
+    flags |= GLASS_POINT;
   }
-}
-
-/**
-  * @brief  This function writes a char in the LCD RAM.
-  * @param  ptr: Pointer to string to display on the LCD Glass.
-  * @retval None
-  */
-void LCD_GLASS_DisplayString(uint8_t* ptr)
-{
-  uint8_t i = 0x00;
-
-  /* Send the string character by character on lCD */
-  while ((*ptr != 0) & (i < 8))
+  if (apostrophe == APOSTROPHE_ON)
   {
-    /* Display one character on LCD */
-    LCD_GLASS_WriteChar(ptr, POINT_OFF, APOSTROPHE_OFF, i);
-
-    /* Point on the next character */
-    ptr++;
-
-    /* Increment the character counter */
-    i++;
+    flags |= GLASS_EXTRA;
   }
-}
 
-/**
-  * @brief  This function Clear a char in the LCD frame buffer.
-  * @param  position: position in the LCD of the chacter to write [0:7]
-  * @retval None
-  */
-void LCD_GLASS_ClearChar(uint8_t position)
-{
-  switch (position)
-  {
-      /* Position 0 on LCD (Digit1)*/
-    case 0:
-      LCD->RAM[LCD_RAMRegister_3]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_6]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_10] &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_13] &=  LCD_CLEAR_MSB;
-      break;
-
-      /* Position 1 on LCD (Digit2)*/
-    case 1:
-      LCD->RAM[LCD_RAMRegister_2]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_6]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_9]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_13] &=  LCD_CLEAR_LSB;
-      break;
-
-      /* Position 2 on LCD (Digit3)*/
-    case 2:
-      LCD->RAM[LCD_RAMRegister_2]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_5]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_9]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_12] &=  LCD_CLEAR_MSB;
-      break;
-
-      /* Position 3 on LCD (Digit4)*/
-    case 3:
-      LCD->RAM[LCD_RAMRegister_1]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_5]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_8]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_12] &=  LCD_CLEAR_LSB;
-      break;
-
-      /* Position 4 on LCD (Digit5)*/
-    case 4:
-      LCD->RAM[LCD_RAMRegister_1]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_4]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_8]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_11] &=  LCD_CLEAR_MSB;
-      break;
-
-      /* Position 5 on LCD (Digit6)*/
-    case 5:
-      LCD->RAM[LCD_RAMRegister_0]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_4]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_7]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_11] &=  LCD_CLEAR_LSB;
-      break;
-
-      /* Position 6 on LCD (Digit7)*/
-    case 6:
-      LCD->RAM[LCD_RAMRegister_0]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_3]  &=  LCD_CLEAR_MSB;
-      LCD->RAM[LCD_RAMRegister_7]  &=  LCD_CLEAR_LSB;
-      LCD->RAM[LCD_RAMRegister_10] &=  LCD_CLEAR_MSB;
-      break;
-
-    default:
-      break;
-  }
+  GLASS_WriteChar(*ch, flags, position);
 }
 
-/**
-  * @brief  This function Clear the whole LCD RAM.
-  * @param  None
-  * @retval None
-  */
-void LCD_GLASS_Clear(void)
-{
-  uint8_t counter = 0;
-  for (counter = 0;counter < 0x0E; counter++)
-  {
-    LCD->RAM[counter] =  LCD_RAM_RESET_VALUE;
-  }
-}
+
+
 /**
   * @brief  Display a string in scrolling mode
   * @param  ptr: Pointer to string to display on the LCD Glass.
@@ -505,54 +462,12 @@ void LCD_GLASS_ScrollString(uint8_t* ptr, uint16_t nScroll, uint16_t ScrollSpeed
   }
 }
 
-/**
-  * @brief  Converts an ascii char to the a LCD digit (previous coding).
-  * @param  c: a char to display.
-  * @param  point: a point to add in front of char
-  *         This parameter can be: POINT_OFF or POINT_ON
-  * @param  apostrophe: flag indicating if a apostrophe has to be add in front
-  *         of displayed character.
-  *         This parameter can be: APOSTROPHE_OFF or APOSTROPHE_ON.
-  * @retval None
-  */
-static void Convert(uint8_t* c, Point_Typedef point, Apostrophe_Typedef apostrophe)
-{
-  uint16_t ch = 0 , tmp = 0;
-  uint8_t i;
 
-  /* The character c is a letter in upper case*/
-  if ((*c < 0x5B)&(*c > 0x40))
-  {
-    ch = LetterMap[*c-0x41];
-  }
-  /* The character c is a number*/
-  if ((*c < 0x3A)&(*c > 0x2F))
-  {
-    ch = NumberMap[*c-0x30];
-  }
-  /* The character c is a space character */
-  if (*c == 0x20)
-  {
-    ch = 0x00;
-  }
-  /* Set the DP seg in the character that can be displayed if the point is on */
-  if (point == POINT_ON)
-  {
-    ch |= 0x0004;
-  }
 
-  /* Set the X seg in the character that can be displayed if the apostrophe is on */
-  if (apostrophe == APOSTROPHE_ON)
-  {
-    ch |= 0x1000;
-  }
 
-  for (i = 0;i < 4; i++)
-  {
-    tmp = ch & mask[i];
-    digit[i] = (uint8_t)(tmp >> (uint8_t)shift[i]);
-  }
-}
+
+
+
 /**
   * @brief  Inserts a delay time.
   * @param  nCount: specifies the delay time length.
@@ -25,6 +25,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm8l15x.h"
+#include "stm8_eval_glass_lcd.h"
 
 /* Private define ------------------------------------------------------------*/
 typedef enum
@@ -46,14 +47,14 @@ typedef enum
 #define LCD_CLEAR_LSB  (uint8_t)0xF0
 
 /* Exported constants --------------------------------------------------------*/
+/* Number of characters of the LCD Glass */
+#define LCD_GLASS_CHAR_NB           ((uint8_t)7)
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 
 void LCD_GLASS_Init(void);
 void LCD_GLASS_WriteChar(uint8_t* ch, Point_Typedef point, Apostrophe_Typedef apostrophe, uint8_t position);
-void LCD_GLASS_DisplayString(uint8_t* ptr);
-void LCD_GLASS_ClearChar(uint8_t position);
-void LCD_GLASS_Clear(void);
 void LCD_GLASS_ScrollString(uint8_t* ptr, uint16_t nScroll, uint16_t ScrollSpeed);
 
 #endif /* __STM8L1526_EVAL_GLASS_LCD_H*/
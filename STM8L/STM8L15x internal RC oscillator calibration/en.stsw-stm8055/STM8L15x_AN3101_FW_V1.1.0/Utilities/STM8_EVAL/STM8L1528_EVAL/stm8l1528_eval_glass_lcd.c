@@ -51,6 +51,9 @@
 /** @defgroup STM8L1528_EVAL_GLASS_LCD_Private_Macros
   * @{
   */
+/* Register of the selected bank of the LCD RAM shadow, marked as modified */
+#define SHADOW_RAM(Register) \
+  (*GLASS_Register((uint8_t)((Register) | (uint8_t)(ShadowPage << 7))))
 /**
   * @}
   */
@@ -100,38 +103,282 @@ The character A for example is:
 /**
   * @brief LETTERS AND NUMBERS MAPPING DEFINITION
   */
-uint16_t i;
-const uint32_t mask [] =
+/* Glyph map of the printable ascii characters, from ' ' (0x20) to '~' (0x7E):
+   LCD digits of the character, two digits per byte, the first one in the high
+   nibble. Letters in upper case and numbers keep the coding of the former
+   letter and number maps. */
+__CONST uint8_t GlyphMap[95][3] =
   {
-    0xF00000, 0x0F0000, 0x00F000, 0x000F00, 0x0000F0, 0x00000F
+    /* ' '    '!'    '"'    '#' */
+    {0x00, 0x00, 0x00}, {0x00, 0x02, 0x00}, {0x00, 0x06, 0x00}, {0x22, 0x03, 0x32},
+    /* '$'    '%'    '&'    '\'' */
+    {0x22, 0x26, 0x32}, {0x04, 0x14, 0x32}, {0x20, 0x62, 0x25}, {0x00, 0x02, 0x00},
+    /* '('    ')'    '*'    '+' */
+    {0x00, 0x10, 0x01}, {0x04, 0x40, 0x00}, {0x06, 0x52, 0x23}, {0x02, 0x02, 0x22},
+    /* ','    '-'    '.'    '/' */
+    {0x04, 0x00, 0x00}, {0x00, 0x00, 0x22}, {0x40, 0x00, 0x00}, {0x04, 0x10, 0x00},
+    /* '0'    '1'    '2'    '3' */
+    {0x20, 0x25, 0x14}, {0x00, 0x01, 0x10}, {0x20, 0x21, 0x26}, {0x20, 0x21, 0x32},
+    /* '4'    '5'    '6'    '7' */
+    {0x00, 0x05, 0x32}, {0x20, 0x24, 0x32}, {0x20, 0x24, 0x36}, {0x00, 0x21, 0x10},
+    /* '8'    '9'    ':'    ';' */
+    {0x20, 0x25, 0x36}, {0x20, 0x25, 0x32}, {0x40, 0x00, 0x40}, {0x04, 0x02, 0x00},
+    /* '<'    '='    '>'    '?' */
+    {0x00, 0x10, 0x01}, {0x20, 0x00, 0x22}, {0x04, 0x40, 0x00}, {0x02, 0x21, 0x02},
+    /* '@'    'A'    'B'    'C' */
+    {0x20, 0x27, 0x06}, {0x00, 0x25, 0x36}, {0x20, 0x25, 0x36}, {0x20, 0x24, 0x04},
+    /* 'D'    'E'    'F'    'G' */
+    {0x22, 0x23, 0x10}, {0x20, 0x24, 0x26}, {0x00, 0x24, 0x26}, {0x20, 0x24, 0x16},
+    /* 'H'    'I'    'J'    'K' */
+    {0x00, 0x05, 0x36}, {0x22, 0x22, 0x00}, {0x20, 0x01, 0x14}, {0x00, 0x14, 0x25},
+    /* 'L'    'M'    'N'    'O' */
+    {0x20, 0x04, 0x04}, {0x00, 0x55, 0x14}, {0x00, 0x45, 0x15}, {0x20, 0x25, 0x14},
+    /* 'P'    'Q'    'R'    'S' */
+    {0x00, 0x25, 0x26}, {0x00, 0x25, 0x32}, {0x00, 0x25, 0x27}, {0x20, 0x24, 0x32},
+    /* 'T'    'U'    'V'    'W' */
+    {0x02, 0x22, 0x00}, {0x20, 0x05, 0x14}, {0x04, 0x14, 0x04}, {0x05, 0x05, 0x15},
+    /* 'X'    'Y'    'Z'    '[' */
+    {0x04, 0x50, 0x01}, {0x02, 0x50, 0x00}, {0x24, 0x30, 0x00}, {0x20, 0x24, 0x04},
+    /* '\\'   ']'    '^'    '_' */
+    {0x00, 0x40, 0x01}, {0x20, 0x21, 0x10}, {0x04, 0x00, 0x01}, {0x20, 0x00, 0x00},
+    /* '`'    'a'    'b'    'c' */
+    {0x00, 0x40, 0x00}, {0x22, 0x00, 0x24}, {0x20, 0x04, 0x36}, {0x20, 0x00, 0x26},
+    /* 'd'    'e'    'f'    'g' */
+    {0x20, 0x01, 0x36}, {0x24, 0x00, 0x24}, {0x02, 0x22, 0x22}, {0x20, 0x25, 0x32},
+    /* 'h'    'i'    'j'    'k' */
+    {0x00, 0x04, 0x36}, {0x02, 0x00, 0x00}, {0x20, 0x00, 0x10}, {0x02, 0x12, 0x01},
+    /* 'l'    'm'    'n'    'o' */
+    {0x02, 0x02, 0x00}, {0x02, 0x00, 0x36}, {0x00, 0x00, 0x36}, {0x20, 0x00, 0x36},
+    /* 'p'    'q'    'r'    's' */
+    {0x00, 0x25, 0x26}, {0x00, 0x25, 0x32}, {0x00, 0x00, 0x24}, {0x20, 0x00, 0x03},
+    /* 't'    'u'    'v'    'w' */
+    {0x20, 0x04, 0x24}, {0x20, 0x00, 0x14}, {0x04, 0x00, 0x04}, {0x04, 0x00, 0x15},
+    /* 'x'    'y'    'z'    '{' */
+    {0x04, 0x50, 0x01}, {0x20, 0x05, 0x32}, {0x24, 0x00, 0x20}, {0x22, 0x22, 0x20},
+    /* '|'    '}'    '~' */
+    {0x02, 0x02, 0x00}, {0x22, 0x22, 0x02}, {0x00, 0x10, 0x20}
   };
-const uint8_t shift[6] =
+
+/* LCD RAM location of the segments of each character, in the bit order of the
+   glyph map: low nibble of each byte (digits 1, 3 and 5), then its high nibble
+   (digits 0, 2 and 4). The SEG(n) cells of COM0 and COM1 and the fourth bit of
+   the digits are not segments */
+__CONST GLASS_Segment_TypeDef CharSegmentMap[7][24] =
   {
-    20, 16, 12, 8, 4, 0
+    /* Position 0 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x04, 0x40}, {0x04, 0x80}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x01, 0x04}, {0x01, 0x08}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x84, 0x20}, {0x84, 0x40}, {0x84, 0x80}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x81, 0x02}, {0x81, 0x04}, {0x81, 0x08}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8B, 0x20}, {0x8B, 0x40}, {0x8B, 0x80}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x88, 0x02}, {0x88, 0x04}, {0x88, 0x08}, {0x00, 0x00}
+    },
+    /* Position 1 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x05, 0x02}, {0x05, 0x04}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x01, 0x20}, {0x01, 0x40}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x85, 0x01}, {0x85, 0x02}, {0x85, 0x04}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x81, 0x10}, {0x81, 0x20}, {0x81, 0x40}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8C, 0x01}, {0x8C, 0x02}, {0x8C, 0x04}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x88, 0x10}, {0x88, 0x20}, {0x88, 0x40}, {0x00, 0x00}
+    },
+    /* Position 2 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x05, 0x10}, {0x05, 0x20}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x02, 0x01}, {0x02, 0x02}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x85, 0x08}, {0x85, 0x10}, {0x85, 0x20}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x81, 0x80}, {0x82, 0x01}, {0x82, 0x02}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8C, 0x08}, {0x8C, 0x10}, {0x8C, 0x20}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x88, 0x80}, {0x89, 0x01}, {0x89, 0x02}, {0x00, 0x00}
+    },
+    /* Position 3 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x05, 0x80}, {0x06, 0x01}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x02, 0x08}, {0x02, 0x10}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x85, 0x40}, {0x85, 0x80}, {0x86, 0x01}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x82, 0x04}, {0x82, 0x08}, {0x82, 0x10}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8C, 0x40}, {0x8C, 0x80}, {0x8D, 0x01}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x89, 0x04}, {0x89, 0x08}, {0x89, 0x10}, {0x00, 0x00}
+    },
+    /* Position 4 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x03, 0x20}, {0x03, 0x40}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x00, 0x02}, {0x00, 0x04}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x83, 0x10}, {0x83, 0x20}, {0x83, 0x40}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x80, 0x01}, {0x80, 0x02}, {0x80, 0x04}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8A, 0x10}, {0x8A, 0x20}, {0x8A, 0x40}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x87, 0x01}, {0x87, 0x02}, {0x87, 0x04}, {0x00, 0x00}
+    },
+    /* Position 5 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x04, 0x01}, {0x04, 0x02}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x00, 0x10}, {0x00, 0x20}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x83, 0x80}, {0x84, 0x01}, {0x84, 0x02}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x80, 0x08}, {0x80, 0x10}, {0x80, 0x20}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8A, 0x80}, {0x8B, 0x01}, {0x8B, 0x02}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x87, 0x08}, {0x87, 0x10}, {0x87, 0x20}, {0x00, 0x00}
+    },
+    /* Position 6 */
+    {
+      /* Digit 1: COM1 */
+      {0x00, 0x00}, {0x04, 0x08}, {0x04, 0x10}, {0x00, 0x00},
+      /* Digit 0: COM0 */
+      {0x00, 0x00}, {0x00, 0x80}, {0x01, 0x01}, {0x00, 0x00},
+      /* Digit 3: COM5 */
+      {0x84, 0x04}, {0x84, 0x08}, {0x84, 0x10}, {0x00, 0x00},
+      /* Digit 2: COM4 */
+      {0x80, 0x40}, {0x80, 0x80}, {0x81, 0x01}, {0x00, 0x00},
+      /* Digit 5: COM7 */
+      {0x8B, 0x04}, {0x8B, 0x08}, {0x8B, 0x10}, {0x00, 0x00},
+      /* Digit 4: COM6 */
+      {0x87, 0x40}, {0x87, 0x80}, {0x88, 0x01}, {0x00, 0x00}
+    }
   };
 
-uint8_t digit[6];     /* Digit frame buffer */
+/* Glass LCD drives, from the lowest to the highest drive. The liquid crystal
+   needs a higher VLCD when it gets colder and the step-up converter a longer
+   pulse on duration when VDD is low. Only the drive valid in the whole
+   operating range is given: the lower drives are to be inserted before it
+   once their VDD and temperature limits are measured on the board glass, until
+   then USE_LCD_GLASS_ADAPTIVE_DRIVE keeps this drive */
+__CONST GLASS_Drive_TypeDef GlassDriveMap[1] =
+  {
+    /* VddMin, TemperatureMin, TemperatureMax, Contrast, PulseOnDuration,
+       DeadTime, HighDrive */
+    {1800, -40, 85, LCD_Contrast_3V3, LCD_PulseOnDuration_7, LCD_DeadTime_0, DISABLE}
+  };
 
-/* Letters and number map of the custom LCD 8x40(Big-Falco Evaluation boad) */
-__CONST uint32_t LetterMap[26] =
+/* Glass description for the glass LCD engine */
+__CONST GLASS_Board_TypeDef GlassBoard =
   {
-    /* A         B         C         D        E          F         G          H         I  */
-    0x002536, 0x202536, 0x202404, 0x222310, 0x202426, 0x002426, 0x202416, 0x000536, 0x222200,
-    /*  J        K         L         M         N         O         P          Q         R  */
-    0x200114, 0x001425, 0x200404, 0x005514, 0x004515, 0x202514, 0x002526, 0x002532, 0x002527,
-    /*  S        T         U         V         W         X         Y          Z  */
-    0x202432, 0x022200, 0x200514, 0x041404, 0x050515, 0x045001, 0x025000, 0x243000
+    LCD_GLASS_CHAR_NB,          /* CharNb */
+    3,                          /* GlyphSize */
+    &GlyphMap[0][0],            /* GlyphMap */
+    &CharSegmentMap[0][0],      /* CharMap */
+    6,                          /* PointSegment: Q, digit 0 */
+    22,                         /* ExtraSegment: double point P, digit 4 */
+    GLASS_RAM_NB,               /* RegisterNb */
+    2,                          /* PageNb: COM0 to COM3, COM4 to COM7 */
+    &GlassDriveMap[0],          /* DriveMap */
+    1                           /* DriveNb */
   };
 
-__CONST uint32_t NumberMap[10] =
+/* Location of the pixels of the 10x19 matrix, indexed by [row - 1][column - 1] */
+__CONST GLASS_Segment_TypeDef MatrixPixelMap[10][19] =
   {
-    /*  0         1          2        3        4   */
-    0x202514, 0x000110, 0x202126, 0x202132, 0x000532,
-    /*  5         6          7        8        9   */
-    0x202432, 0x202436, 0x002110, 0x202536, 0x202532
+    /* Row 1: columns 1 to 19 */
+    {
+      {0x0B, 0x20}, {0x0C, 0x04}, {0x0C, 0x02}, {0x0C, 0x01}, {0x0C, 0x20},
+      {0x0C, 0x10}, {0x0C, 0x08}, {0x0D, 0x01}, {0x0C, 0x80}, {0x0C, 0x40},
+      {0x0A, 0x40}, {0x0A, 0x20}, {0x0A, 0x10}, {0x0B, 0x02}, {0x0B, 0x01},
+      {0x0A, 0x80}, {0x0B, 0x10}, {0x0B, 0x08}, {0x0B, 0x04}
+    },
+    /* Row 2: columns 1 to 19 */
+    {
+      {0x08, 0x02}, {0x08, 0x40}, {0x08, 0x20}, {0x08, 0x10}, {0x09, 0x02},
+      {0x09, 0x01}, {0x08, 0x80}, {0x09, 0x10}, {0x09, 0x08}, {0x09, 0x04},
+      {0x07, 0x04}, {0x07, 0x02}, {0x07, 0x01}, {0x07, 0x20}, {0x07, 0x10},
+      {0x07, 0x08}, {0x08, 0x01}, {0x07, 0x80}, {0x07, 0x40}
+    },
+    /* Row 3: columns 1 to 19 */
+    {
+      {0x09, 0x20}, {0x09, 0x40}, {0x09, 0x80}, {0x0A, 0x01}, {0x0A, 0x02},
+      {0x0A, 0x04}, {0x0A, 0x08}, {0x12, 0x01}, {0x12, 0x02}, {0x12, 0x04},
+      {0x12, 0x08}, {0x12, 0x10}, {0x12, 0x20}, {0x12, 0x40}, {0x12, 0x80},
+      {0x13, 0x01}, {0x13, 0x02}, {0x13, 0x04}, {0x13, 0x08}
+    },
+    /* Row 4: columns 1 to 19 */
+    {
+      {0x0D, 0x02}, {0x0D, 0x04}, {0x0D, 0x08}, {0x0D, 0x10}, {0x0D, 0x20},
+      {0x0D, 0x40}, {0x0D, 0x80}, {0x14, 0x01}, {0x14, 0x02}, {0x14, 0x04},
+      {0x14, 0x08}, {0x14, 0x10}, {0x14, 0x20}, {0x14, 0x40}, {0x14, 0x80},
+      {0x15, 0x01}, {0x15, 0x02}, {0x15, 0x04}, {0x15, 0x08}
+    },
+    /* Row 5: columns 1 to 19 */
+    {
+      {0x02, 0x20}, {0x02, 0x40}, {0x02, 0x80}, {0x03, 0x01}, {0x03, 0x02},
+      {0x03, 0x04}, {0x03, 0x08}, {0x0E, 0x01}, {0x0E, 0x02}, {0x0E, 0x04},
+      {0x0E, 0x08}, {0x0E, 0x10}, {0x0E, 0x20}, {0x0E, 0x40}, {0x0E, 0x80},
+      {0x0F, 0x01}, {0x0F, 0x02}, {0x0F, 0x04}, {0x0F, 0x08}
+    },
+    /* Row 6: columns 1 to 19 */
+    {
+      {0x06, 0x02}, {0x06, 0x04}, {0x06, 0x08}, {0x06, 0x10}, {0x06, 0x20},
+      {0x06, 0x40}, {0x06, 0x80}, {0x10, 0x01}, {0x10, 0x02}, {0x10, 0x04},
+      {0x10, 0x08}, {0x10, 0x10}, {0x10, 0x20}, {0x10, 0x40}, {0x10, 0x80},
+      {0x11, 0x01}, {0x11, 0x02}, {0x11, 0x04}, {0x11, 0x08}
+    },
+    /* Row 7: columns 1 to 19 */
+    {
+      {0x8D, 0x02}, {0x8D, 0x04}, {0x8D, 0x08}, {0x8D, 0x10}, {0x8D, 0x20},
+      {0x8D, 0x40}, {0x8D, 0x80}, {0x94, 0x01}, {0x94, 0x02}, {0x94, 0x04},
+      {0x94, 0x08}, {0x94, 0x10}, {0x94, 0x20}, {0x94, 0x40}, {0x94, 0x80},
+      {0x95, 0x01}, {0x95, 0x02}, {0x95, 0x04}, {0x95, 0x08}
+    },
+    /* Row 8: columns 1 to 19 */
+    {
+      {0x89, 0x20}, {0x89, 0x40}, {0x89, 0x80}, {0x8A, 0x01}, {0x8A, 0x02},
+      {0x8A, 0x04}, {0x8A, 0x08}, {0x92, 0x01}, {0x92, 0x02}, {0x92, 0x04},
+      {0x92, 0x08}, {0x92, 0x10}, {0x92, 0x20}, {0x92, 0x40}, {0x92, 0x80},
+      {0x93, 0x01}, {0x93, 0x02}, {0x93, 0x04}, {0x93, 0x08}
+    },
+    /* Row 9: columns 1 to 19 */
+    {
+      {0x86, 0x02}, {0x86, 0x04}, {0x86, 0x08}, {0x86, 0x10}, {0x86, 0x20},
+      {0x86, 0x40}, {0x86, 0x80}, {0x90, 0x01}, {0x90, 0x02}, {0x90, 0x04},
+      {0x90, 0x08}, {0x90, 0x10}, {0x90, 0x20}, {0x90, 0x40}, {0x90, 0x80},
+      {0x91, 0x01}, {0x91, 0x02}, {0x91, 0x04}, {0x91, 0x08}
+    },
+    /* Row 10: columns 1 to 19 */
+    {
+      {0x82, 0x20}, {0x82, 0x40}, {0x82, 0x80}, {0x83, 0x01}, {0x83, 0x02},
+      {0x83, 0x04}, {0x83, 0x08}, {0x8E, 0x01}, {0x8E, 0x02}, {0x8E, 0x04},
+      {0x8E, 0x08}, {0x8E, 0x10}, {0x8E, 0x20}, {0x8E, 0x40}, {0x8E, 0x80},
+      {0x8F, 0x01}, {0x8F, 0x02}, {0x8F, 0x04}, {0x8F, 0x08}
+    }
   };
 
 __IO uint8_t str[7] = "";
+
+/* LCD RAM shadow bank used by SHADOW_RAM(), 0: first, 1: second */
+static uint8_t ShadowPage = 0;
 /**
   * @}
   */
@@ -140,8 +387,12 @@ __IO uint8_t str[7] = "";
 /** @defgroup STM8L1528_EVAL_GLASS_LCD_Private_Function_Prototypes
   * @{
   */
-static void Convert(uint8_t* c, Point_Typedef Point, DoublePoint_Typedef DoublePoint);
 static void delay(__IO uint32_t nCount);
+static ErrorStatus MatrixPixelSelect(PixelRow_TypeDef PixelRow,
+                                     PixelColumn_TypeDef PixelColumn,
+                                     uint8_t* Register, uint8_t* Mask);
+static void MatrixPixelDraw(uint8_t Row, uint8_t Column, uint8_t Pixel,
+                            MatrixDraw_TypeDef Mode);
 
 /**
   * @}
@@ -186,9 +437,9 @@ void LCD_GLASS_Init(void)
   LCD_PortMaskConfig(LCD_PortMaskRegister_4, 0xFF);
   LCD_PortMaskConfig(LCD_PortMaskRegister_5, 0x0F);
 
-  LCD_ContrastConfig(LCD_Contrast_3V3);
-
-  LCD_PulseOnDurationConfig(LCD_PulseOnDuration_7);
+  /* Blank LCD RAM, characters rendered from the glass description, and
+     drive selected from the glass drive table */
+  GLASS_Init(&GlassBoard);
 
   LCD_Cmd(ENABLE); /*!< Enable LCD peripheral */
 }
@@ -207,417 +458,20 @@ void LCD_GLASS_Init(void)
 void LCD_GLASS_WriteChar(uint8_t* ch, Point_Typedef Point,
                          DoublePoint_Typedef DoublePoint, uint8_t Position)
 {
-  Convert(ch, Point, DoublePoint);
-  /* Enable the write access on the LCD RAM first banck */
-  LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-  switch (Position)
-  {
-      /* Position 0 on LCD (Digit1)*/
-    case 0:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFB;
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[0] << (uint8_t)0x01);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[1] << (uint8_t)0x05);
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xF1;
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[2] << (uint8_t)0x01);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x1F;
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[3] << (uint8_t)0x05);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xF9;
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)(digit[4] << (uint8_t)0x01);
-
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0x1F;
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)(digit[5] << (uint8_t)0x05);
-      break;
-
-      /* Position 1 on LCD */
-    case 1:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x9F;
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[0] << (uint8_t)0x04);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF9;
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[1]);
+  uint8_t flags = 0;
 
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[2] << (uint8_t)0x04);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[3]);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)(digit[4] << (uint8_t)0x04);
-
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)(digit[5]);
-      break;
-
-      /* Position 2 on LCD (Digit3)*/
-    case 2:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFF;
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[0] & (uint8_t)0x01) << (uint8_t)0x07);
-      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)((digit[0] & (uint8_t)0x06) >> (uint8_t)0x01);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xCF;
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[1] << (uint8_t)0x03);
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[2] & (uint8_t)0x1) << (uint8_t)0x07);
-      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)((digit[2] & (uint8_t)0x6) >> (uint8_t)0x01);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[3] << (uint8_t)0x03);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)((digit[4] & (uint8_t)0x1) << (uint8_t)0x07);
-      LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)((digit[4] & (uint8_t)0x6) >> (uint8_t)0x01);
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)(digit[5] << (uint8_t)0x03);
-      break;
-
-      /* Position 3 on LCD */
-    case 3:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE7;
-      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)(digit[0] << (uint8_t)0x02);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)((digit[1] & (uint8_t)0x03) << (uint8_t)0x06);
-      LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)((digit[1] & (uint8_t)0x04) >> (uint8_t)0x02);
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)(digit[2] << (uint8_t)0x02);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)((digit[3] & (uint8_t)0x3) << (uint8_t)0x06);
-      LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)((digit[3] & (uint8_t)0x4) >> (uint8_t)0x02);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)(digit[4] << (uint8_t)0x02);
-
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)((digit[5] & (uint8_t)0x3) << (uint8_t)0x06);
-      LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)((digit[5] & (uint8_t)0x4) >> (uint8_t)0x02);
-      break;
-
-      /* Position 4 on LCD (Digit5)*/
-    case 4:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF9;
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[0]);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x9F;
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)(digit[1] << (uint8_t)0x4);
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[2]);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)(digit[3] << (uint8_t)0x04);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)(digit[4]);
-
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)(digit[5] << (uint8_t)0x04);
-      break;
-
-      /* Position 5 on LCD (Digit6)*/
-    case 5:
-
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xCF;
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[0] << (uint8_t)0x03);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFF;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)((digit[1] & (uint8_t)0x01) << (uint8_t)0x07);
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)((digit[1] & (uint8_t)0x06) >> (uint8_t)0x01);
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[2] << (uint8_t)0x03);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)((digit[3] & (uint8_t)0x01) << (uint8_t)0x07);
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)((digit[3] & (uint8_t)0x06) >> (uint8_t)0x01);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)(digit[4] << (uint8_t)0x03);
-
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)((digit[5] & (uint8_t)0x01) << (uint8_t)0x07);
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)((digit[5] & (uint8_t)0x06) >> (uint8_t)0x01);
-      break;
-
-      /* Position 6 on LCD (Digit7)*/
-    case 6:
-
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      /*Write Digit 0 on COM0 */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)((digit[0] & (uint8_t)0x03) << (uint8_t)0x06);
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[0] & (uint8_t)0x04) >> (uint8_t)0x02);
-
-      /*Write Digit 1 on COM1 */
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE7;
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[1] << (uint8_t)0x02);
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-      /*Write Digit 2 on COM4 */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)((digit[2] & (uint8_t)0x03) << (uint8_t)0x06);
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[2] & (uint8_t)0x04) >> (uint8_t)0x02);
-
-      /*Write Digit 3 on COM5 */
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[3] << (uint8_t)0x02);
-
-      /*Write Digit 4 on COM6 */
-      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)((digit[4] & (uint8_t)0x03) << (uint8_t)0x06);
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)((digit[4] & (uint8_t)0x04) >> (uint8_t)0x02);
-
-      /*Write Digit 5 on COM7 */
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)(digit[5] << (uint8_t)0x02);
-      break;
-
-    default:
-      break;
+  if (Point == POINT_ON)
+  {
+    flags |= GLASS_POINT;
   }
-}
-
-/**
-  * @brief  This function Clear a character on the LCD Glass.
-  * @param  position: position in the LCD of the character to Clear [0:6]
-  * @retval None
-  */
-void LCD_GLASS_ClearChar(uint8_t Position)
-{
-  switch (Position)
+  if (DoublePoint == DOUBLEPOINT_ON)
   {
-      /* Position 0 on LCD Glass*/
-    case 0:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFB;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x3F;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xF1;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x1F;
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xF9;
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0x1F;
-      break;
-
-      /* Position 1 on LCD Glass*/
-    case 1:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x9F;
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF9;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xF8;
-
-      break;
-
-      /* Position 2 on LCD Glass*/
-    case 2:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFF;
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xCF;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xC7;
-
-      break;
-
-      /* Position 3 on LCD Glass*/
-    case 3:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE7;
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFE;
-
-      break;
-
-      /* Position 4 on LCD Glass*/
-    case 4:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF9;
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x9F;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x8F;
-      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xF8;
-      LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x8F;
-
-      break;
-
-      /* Position 5 on LCD Glass*/
-    case 5:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xCF;
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFF;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
-      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xC7;
-      LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFC;
-
-      break;
-
-      /* Position 6 on LCD Glass*/
-    case 6:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x7F;
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE7;
-
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
-
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE3;
-      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0x3F;
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFE;
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xE3;
-
-      break;
-
-    default:
-      break;
+    flags |= GLASS_EXTRA;
   }
+
+  GLASS_WriteChar(*ch, flags, Position);
 }
+
 /**
   * @brief  This function Clears the LCD Glass Text Zone.
   * @param  None
@@ -625,117 +479,18 @@ void LCD_GLASS_ClearChar(uint8_t Position)
   */
 void LCD_GLASS_ClearTextZone(void)
 {
-  /* Enable the write access on the LCD RAM First banck */
-  LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-
-  LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFB;
-  LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x3F;
-  LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x9F;
-  LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF9;
-  LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFF;
-  LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
-  LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xCF;
-  LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE7;
-  LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x7F;
-  LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
-  LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF9;
-  LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x9F;
-  LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xCF;
-  LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFF;
-  LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
-  LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x7F;
-  LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
-  LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE7;
-
-  /* Enable the write access on the LCD RAM second banck */
-  LCD->CR4 |= LCD_CR4_PAGECOM;
-
-  LCD->RAM[LCD_RAMRegister_1]  &= (uint8_t)0xF1;
-  LCD->RAM[LCD_RAMRegister_4]  &= (uint8_t)0x1F;
-  LCD->RAM[LCD_RAMRegister_8]  &= (uint8_t)0xF9;
-  LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0x1F;
-  LCD->RAM[LCD_RAMRegister_1]  &= (uint8_t)0x8F;
-  LCD->RAM[LCD_RAMRegister_5]  &= (uint8_t)0xF8;
-  LCD->RAM[LCD_RAMRegister_8]  &= (uint8_t)0x8F;
-  LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xF8;
-  LCD->RAM[LCD_RAMRegister_1]  &= (uint8_t)0x7F;
-  LCD->RAM[LCD_RAMRegister_2]  &= (uint8_t)0xFC;
-  LCD->RAM[LCD_RAMRegister_5]  &= (uint8_t)0xC7;
-  LCD->RAM[LCD_RAMRegister_8]  &= (uint8_t)0x7F;
-  LCD->RAM[LCD_RAMRegister_9]  &= (uint8_t)0xFC;
-  LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xC7;
-  LCD->RAM[LCD_RAMRegister_2]  &= (uint8_t)0xE3;
-  LCD->RAM[LCD_RAMRegister_5]  &= (uint8_t)0x3F;
-  LCD->RAM[LCD_RAMRegister_6]  &= (uint8_t)0xFE;
-  LCD->RAM[LCD_RAMRegister_9]  &= (uint8_t)0xE3;
-  LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0x3F;
-  LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFE;
-  LCD->RAM[LCD_RAMRegister_0]  &= (uint8_t)0xF8;
-  LCD->RAM[LCD_RAMRegister_3]  &= (uint8_t)0x8F;
-  LCD->RAM[LCD_RAMRegister_7]  &= (uint8_t)0xF8;
-  LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x8F;
-  LCD->RAM[LCD_RAMRegister_0]  &= (uint8_t)0xC7;
-  LCD->RAM[LCD_RAMRegister_3]  &= (uint8_t)0x7F;
-  LCD->RAM[LCD_RAMRegister_4]  &= (uint8_t)0xFC;
-  LCD->RAM[LCD_RAMRegister_7]  &= (uint8_t)0xC7;
-  LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x7F;
-  LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFC;
-  LCD->RAM[LCD_RAMRegister_0]  &= (uint8_t)0x3F;
-  LCD->RAM[LCD_RAMRegister_1]  &= (uint8_t)0xFE;
-  LCD->RAM[LCD_RAMRegister_4]  &= (uint8_t)0xE3;
-  LCD->RAM[LCD_RAMRegister_7]  &= (uint8_t)0x3F;
-  LCD->RAM[LCD_RAMRegister_8]  &= (uint8_t)0xFE;
-  LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xE3;
-
-}
-/**
-  * @brief  This function Clears the LCD display memory.
-  * @param  None
-  * @retval None
-  */
-void LCD_GLASS_Clear(void)
-{
-  uint8_t counter = 0x00;
+  uint8_t position = 0;
 
-  /* Enable the write access on the LCD RAM First banck */
-  LCD->CR4 &= (uint8_t)(~LCD_CR4_PAGECOM);
+  GLASS_Begin();
 
-  for (counter = 0x0; counter < 0x16; counter++)
+  for (position = 0; position < LCD_GLASS_CHAR_NB; position++)
   {
-    LCD->RAM[counter] =  LCD_RAM_RESET_VALUE;
+    LCD_GLASS_ClearChar(position);
   }
 
-  /* Enable the write access on the LCD RAM second banck */
-  LCD->CR4 |= LCD_CR4_PAGECOM;
-
-  for (counter = 0x0; counter < 0x16; counter++)
-  {
-    LCD->RAM[counter] =  LCD_RAM_RESET_VALUE;
-  }
+  GLASS_End();
 }
 
-/**
-  * @brief  Writes a String on the LCD Glass.
-  * @param  ptr: Pointer to the string to display on the LCD Glass.
-  * @retval None
-  */
-void LCD_GLASS_DisplayString(uint8_t* ptr)
-{
-  uint8_t i = 0x00;
-
-  /* Send the string character by character on lCD */
-  while ((*ptr != 0) & (i < 8))
-  {
-    /* Display one character on LCD */
-    LCD_GLASS_WriteChar(ptr, (Point_Typedef)0, (DoublePoint_Typedef)0, i);
-
-    /* Point to the next character */
-    ptr++;
-
-    /* Increment the character counter */
-    i++;
-  }
-}
 /**
   * @brief  Display a string in scrolling mode
   * @param  ptr: Pointer to the string to display on the LCD Glass.
@@ -865,21 +620,25 @@ void LCD_GLASS_ScrollString(uint8_t* ptr, uint32_t nScroll, uint32_t ScrollSpeed
   */
 void LCD_GLASS_DisplayLogo(FunctionalState NewState)
 {
+  GLASS_Begin();
+
   if (NewState != DISABLE)
   {
-    /* Enable the write access on the LCD RAM First banck */
-    LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+    /* Select the LCD RAM first bank */
+    ShadowPage = 0;
 
     /* Set logo on  */
-    LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)0x40;
+    SHADOW_RAM(LCD_RAMRegister_0) |= (uint8_t)0x40;
   }
   else
   {
-    /* Enable the write access on the LCD RAM First banck */
-    LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+    /* Select the LCD RAM first bank */
+    ShadowPage = 0;
     /* Set logo of  */
-    LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xBF;
+    SHADOW_RAM(LCD_RAMRegister_0) &= (uint8_t)0xBF;
   }
+
+  GLASS_End();
 }
 
 /**
@@ -889,71 +648,72 @@ void LCD_GLASS_DisplayLogo(FunctionalState NewState)
   */
 void LCD_GLASS_BatteryLevelConfig(BatteryLevel_TypeDef BatteryLevel)
 {
+  GLASS_Begin();
 
   switch (BatteryLevel)
   {
       /* BATTERYLEVEL 1/4 */
     case BATTERYLEVEL_1_4:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set BATTERYLEVEL_1_4  on  */
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)0x01;
+      SHADOW_RAM(LCD_RAMRegister_0) |= (uint8_t)0x01;
       break;
 
       /* BATTERYLEVEL 1/2 )*/
     case BATTERYLEVEL_1_2:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set BatteryLevel_1_4 on  */
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)0x01;
+      SHADOW_RAM(LCD_RAMRegister_0) |= (uint8_t)0x01;
       /* Set BatteryLevel_1_2 on  */
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x10;
+      SHADOW_RAM(LCD_RAMRegister_3) |= (uint8_t)0x10;
       break;
 
       /* Battery Level 3/4*/
     case BATTERYLEVEL_3_4:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set BATTERYLEVEL_1_4  on  */
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)0x01;
+      SHADOW_RAM(LCD_RAMRegister_0) |= (uint8_t)0x01;
       /* Set BATTERYLEVEL_1_2  on  */
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x10;
+      SHADOW_RAM(LCD_RAMRegister_3) |= (uint8_t)0x10;
       /* Set BATTERYLEVEL_3_4  on  */
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x80;
+      SHADOW_RAM(LCD_RAMRegister_3) |= (uint8_t)0x80;
       break;
 
       /* BATTERYLEVEL_FULL*/
     case BATTERYLEVEL_FULL:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set BATTERYLEVEL_1_4 on  */
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)0x01;
+      SHADOW_RAM(LCD_RAMRegister_0) |= (uint8_t)0x01;
       /* Set BATTERYLEVEL_1_2 on  */
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x10;
+      SHADOW_RAM(LCD_RAMRegister_3) |= (uint8_t)0x10;
       /* Set BATTERYLEVEL_3_4 on  */
-      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x80;
+      SHADOW_RAM(LCD_RAMRegister_3) |= (uint8_t)0x80;
       /* Set BATTERYLEVEL_FULL on  */
-      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)0x08;
+      SHADOW_RAM(LCD_RAMRegister_0) |= (uint8_t)0x08;
       break;
 
     case BATTERYLEVEL_OFF:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set BATTERYLEVEL_1_4 off  */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xFE;
+      SHADOW_RAM(LCD_RAMRegister_0) &= (uint8_t)0xFE;
       /* Set BATTERYLEVEL_1_2 off  */
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xEF;
+      SHADOW_RAM(LCD_RAMRegister_3) &= (uint8_t)0xEF;
       /* Set BATTERYLEVEL_3_4 off  */
-      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x7F;
+      SHADOW_RAM(LCD_RAMRegister_3) &= (uint8_t)0x7F;
       /* Set BATTERYLEVEL_FULL off  */
-      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF7;
+      SHADOW_RAM(LCD_RAMRegister_0) &= (uint8_t)0xF7;
       break;
 
     default:
       break;
   }
 
-
+  GLASS_End();
 }
 
 /**
@@ -963,59 +723,60 @@ void LCD_GLASS_BatteryLevelConfig(BatteryLevel_TypeDef BatteryLevel)
   */
 void LCD_GLASS_ArrowConfig(ArrowDirection_TypeDef ArrowDirection)
 {
+  GLASS_Begin();
 
   switch (ArrowDirection)
   {
       /* ARROWDIRECTION_UP*/
     case ARROWDIRECTION_UP:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set ARROWDIRECTION_UP on  */
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x10;
+      SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x10;
       break;
 
       /* ARROWDIRECTION_LEFT*/
     case ARROWDIRECTION_LEFT :
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set ARROWDIRECTION_LEFT on  */
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)0x01;
+      SHADOW_RAM(LCD_RAMRegister_5) |= (uint8_t)0x01;
       break;
 
       /* ARROWDIRECTION_DOWN*/
     case ARROWDIRECTION_DOWN:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set ARROWDIRECTION_DOWN on  */
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)0x08;
+      SHADOW_RAM(LCD_RAMRegister_5) |= (uint8_t)0x08;
       break;
 
       /* ARROWDIRECTION_RIGHT*/
     case ARROWDIRECTION_RIGHT:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set ARROWDIRECTION_RIGHT on  */
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x80;
+      SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x80;
       break;
 
     case ARROWDIRECTION_OFF:
-      /* Enable the write access on the LCD RAM second banck */
-      LCD->CR4 |= LCD_CR4_PAGECOM;
+      /* Select the LCD RAM second bank */
+      ShadowPage = 1;
       /* Set ARROWDIRECTION_UP of  */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xEF;
+      SHADOW_RAM(LCD_RAMRegister_1) &= (uint8_t)0xEF;
       /* Set ARROWDIRECTION_LEFT of  */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xFE;
+      SHADOW_RAM(LCD_RAMRegister_5) &= (uint8_t)0xFE;
       /* Set ARROWDIRECTION_DOWN of  */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF7;
+      SHADOW_RAM(LCD_RAMRegister_5) &= (uint8_t)0xF7;
       /* Set ARROWDIRECTION_RIGHT of  */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x7F;
+      SHADOW_RAM(LCD_RAMRegister_1) &= (uint8_t)0x7F;
       break;
 
     default:
       break;
   }
 
-
+  GLASS_End();
 }
 
 /**
@@ -1026,108 +787,110 @@ void LCD_GLASS_ArrowConfig(ArrowDirection_TypeDef ArrowDirection)
   */
 void LCD_GLASS_TemperatureConfig(TemperatureLevel_TypeDef Temperature)
 {
+  GLASS_Begin();
+
   switch (Temperature)
   {
       /* Temp_6*/
     case TEMPERATURELEVEL_6 :
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 on  */
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)0x20;
+      SHADOW_RAM(LCD_RAMRegister_4) |= (uint8_t)0x20;
       break;
 
       /* Temperature_5)*/
     case TEMPERATURELEVEL_5:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 on  */
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)0x20;
+      SHADOW_RAM(LCD_RAMRegister_4) |= (uint8_t)0x20;
       /* Set Temperature_5 on  */
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x02;
+      SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x02;
       break;
 
       /* Temperature_4*/
     case TEMPERATURELEVEL_4:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 on  */
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)0x20;
+      SHADOW_RAM(LCD_RAMRegister_4) |= (uint8_t)0x20;
       /* Set Temperature_5 on  */
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x02;
+      SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x02;
       /* Set Temperature_4 on  */
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x04;
+      SHADOW_RAM(LCD_RAMRegister_8) |= (uint8_t)0x04;
       break;
       /* Temperature_3*/
     case TEMPERATURELEVEL_3:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 on  */
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)0x20;
+      SHADOW_RAM(LCD_RAMRegister_4) |= (uint8_t)0x20;
       /* Set Temperature_5 on  */
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x02;
+      SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x02;
       /* Set Temperature_4 on  */
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x04;
+      SHADOW_RAM(LCD_RAMRegister_8) |= (uint8_t)0x04;
       /* Set Temperature_3 on  */
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x40;
+      SHADOW_RAM(LCD_RAMRegister_11) |= (uint8_t)0x40;
       break;
 
       /* Temperature_2*/
     case TEMPERATURELEVEL_2:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 on  */
-      LCD->RAM[LCD_RAMRegister_4]  |= (uint8_t)0x20;
+      SHADOW_RAM(LCD_RAMRegister_4)  |= (uint8_t)0x20;
       /* Set Temperature_5 on  */
-      LCD->RAM[LCD_RAMRegister_1]  |= (uint8_t)0x02;
+      SHADOW_RAM(LCD_RAMRegister_1)  |= (uint8_t)0x02;
       /* Set Temperature_4 on  */
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x40;
+      SHADOW_RAM(LCD_RAMRegister_11) |= (uint8_t)0x40;
       /* Set Temperature_3 on  */
-      LCD->RAM[LCD_RAMRegister_8]  |= (uint8_t)0x04;
+      SHADOW_RAM(LCD_RAMRegister_8)  |= (uint8_t)0x04;
       /* Set Temperature_1 on  */
-      LCD->RAM[LCD_RAMRegister_8]  |= (uint8_t)0x08;
+      SHADOW_RAM(LCD_RAMRegister_8)  |= (uint8_t)0x08;
       break;
 
       /* Temperature_1*/
     case  TEMPERATURELEVEL_1:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 on  */
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)0x20;
+      SHADOW_RAM(LCD_RAMRegister_4) |= (uint8_t)0x20;
       /* Set Temperature_5 on  */
-      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x02;
+      SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x02;
       /* Set Temperature_4 on  */
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x40;
+      SHADOW_RAM(LCD_RAMRegister_11) |= (uint8_t)0x40;
       /* Set Temperature_3 on  */
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x04;
+      SHADOW_RAM(LCD_RAMRegister_8) |= (uint8_t)0x04;
       /* Set Temperature_2 on  */
-      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x08;
+      SHADOW_RAM(LCD_RAMRegister_8) |= (uint8_t)0x08;
       /* Set Temperature_3 on  */
-      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x80;
+      SHADOW_RAM(LCD_RAMRegister_11) |= (uint8_t)0x80;
       break;
 
 
     case TEMPERATURELEVEL_OFF:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set Temperature_6 off  */
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xDF;
+      SHADOW_RAM(LCD_RAMRegister_4) &= (uint8_t)0xDF;
       /* Set Temperature_5 off  */
-      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFD;
+      SHADOW_RAM(LCD_RAMRegister_1) &= (uint8_t)0xFD;
       /* Set Temperature_4 off  */
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xBF;
+      SHADOW_RAM(LCD_RAMRegister_11) &= (uint8_t)0xBF;
       /* Set Temperature_3 off */
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFB;
+      SHADOW_RAM(LCD_RAMRegister_8) &= (uint8_t)0xFB;
       /* Set Temperature_2 off  */
-      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0x7F;
+      SHADOW_RAM(LCD_RAMRegister_11) &= (uint8_t)0x7F;
       /* Set Temperature_1 off  */
-      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xF7;
+      SHADOW_RAM(LCD_RAMRegister_8) &= (uint8_t)0xF7;
       break;
 
     default:
       break;
   }
 
-
+  GLASS_End();
 }
 
 /**
@@ -1138,49 +901,50 @@ void LCD_GLASS_TemperatureConfig(TemperatureLevel_TypeDef Temperature)
   */
 void LCD_GLASS_ValueUnitConfig(ValueUnit_TypeDef ValueUnit)
 {
+  GLASS_Begin();
 
   switch (ValueUnit)
   {
       /* VALUEUNIT MILLIAMPERE*/
     case VALUEUNIT_MILLIAMPERE:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set VALUEUNIT_MILLIAMPERE on  */
-      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)0x40;
+      SHADOW_RAM(LCD_RAMRegister_5) |= (uint8_t)0x40;
       break;
 
       /* VALUEUNIT MICROAMPERE)*/
     case VALUEUNIT_MICROAMPERE:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set VALUEUNIT_MICROAMPERE  */
-      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x04;
+      SHADOW_RAM(LCD_RAMRegister_2) |= (uint8_t)0x04;
       break;
 
       /* VALUEUNIT NANOAMPERE*/
     case  VALUEUNIT_NANOAMPERE:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set VALUEUNIT_NANOAMPERE on  */
-      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)0x04;
+      SHADOW_RAM(LCD_RAMRegister_4) |= (uint8_t)0x04;
       break;
 
     case  VALUEUNIT_OFF:
-      /* Enable the write access on the LCD RAM First banck */
-      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+      /* Select the LCD RAM first bank */
+      ShadowPage = 0;
       /* Set VALUEUNIT_MILLIAMPERE off  */
-      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xBF;
+      SHADOW_RAM(LCD_RAMRegister_5) &= (uint8_t)0xBF;
       /* Set VALUEUNIT_MICROAMPERE off  */
-      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFB;
+      SHADOW_RAM(LCD_RAMRegister_2) &= (uint8_t)0xFB;
       /* Set VALUEUNIT_NANOAMPERE off  */
-      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFB;
+      SHADOW_RAM(LCD_RAMRegister_4) &= (uint8_t)0xFB;
       break;
 
     default:
       break;
   }
 
-
+  GLASS_End();
 }
 
 /**
@@ -1191,24 +955,26 @@ void LCD_GLASS_ValueUnitConfig(ValueUnit_TypeDef ValueUnit)
   */
 void LCD_GLASS_SignCmd(Sign_TypeDef Sign, FunctionalState NewState)
 {
+  GLASS_Begin();
+
   if (NewState != DISABLE)
   {
     switch (Sign)
     {
         /* Signe positive */
       case SIGN_POSITIVE:
-        /* Enable the write access on the LCD RAM second banck */
-        LCD->CR4 |= LCD_CR4_PAGECOM;
+        /* Select the LCD RAM second bank */
+        ShadowPage = 1;
         /* Set SIGN_POSITIVE on  */
-        LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x08;
+        SHADOW_RAM(LCD_RAMRegister_8) |= (uint8_t)0x08;
         break;
 
         /* Signe negative*/
       case SIGN_NEGATIVE:
-        /* Enable the write access on the LCD RAM First banck */
-        LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+        /* Select the LCD RAM first bank */
+        ShadowPage = 0;
         /* Set SIGN_NEGATIVE on  */
-        LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)0x08;
+        SHADOW_RAM(LCD_RAMRegister_1) |= (uint8_t)0x08;
         break;
 
       default:
@@ -1217,15 +983,17 @@ void LCD_GLASS_SignCmd(Sign_TypeDef Sign, FunctionalState NewState)
   }
   else
   {
-    /* Enable the write access on the LCD RAM second banck */
-    LCD->CR4 |= LCD_CR4_PAGECOM;
+    /* Select the LCD RAM second bank */
+    ShadowPage = 1;
     /* Set SIGN_POSITIVE off  */
-    LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xF7;
-    /* Enable the write access on the LCD RAM second banck */
-    LCD->CR4 |= LCD_CR4_PAGECOM;
+    SHADOW_RAM(LCD_RAMRegister_8) &= (uint8_t)0xF7;
+    /* Select the LCD RAM second bank */
+    ShadowPage = 1;
     /* Set SICN_NEGATIVE off  */
-    LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xF7;
+    SHADOW_RAM(LCD_RAMRegister_1) &= (uint8_t)0xF7;
   }
+
+  GLASS_End();
 }
 /**
   * @brief Set Matrix Pixel on.
@@ -1235,2883 +1003,235 @@ void LCD_GLASS_SignCmd(Sign_TypeDef Sign, FunctionalState NewState)
   */
 void LCD_GLASS_WriteMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn)
 {
-  switch (PixelRow)
-  {
-    case PIXELROW_1:
+  GLASS_Begin();
 
-      switch (PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 9 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 10 */
-          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 11 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 12 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 13 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 14 */
-          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 15 */
-          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 16 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 17 */
-          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 18 */
-          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x04;
-          break;
-
-        default:
-          break;
+  MatrixPixelDraw((uint8_t)PixelRow, (uint8_t)PixelColumn, 1, MATRIXDRAW_SET);
 
-      }
-      break;
-    case PIXELROW_2:
+  GLASS_End();
+}
 
-      switch ( PixelColumn)
-      {
-        case  PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x02;
-          break;
-
-        case  PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x40;
-          break;
-
-        case  PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x20;
-          break;
-
-        case  PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row =  2 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x10;
-          break;
-
-        case  PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x02;
-          break;
-
-        case  PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x01;
-          break;
-
-        case  PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x80;
-          break;
-
-        case  PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x10;
-          break;
-
-        case  PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x08;
-          break;
-
-        case  PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x04;
-          break;
-
-        case  PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 11 */
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 12 */
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x02;
-          break;
-
-        case  PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x01;
-          break;
-
-        case  PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x20;
-          break;
-
-        case  PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 15 */
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x10;
-          break;
-
-        case  PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 16*/
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x08;
-          break;
-
-        case  PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 17*/
-          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x01;
-          break;
-
-        case  PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 18 */
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x80;
-          break;
-
-        case  PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x40;
-          break;
-
-        default:
-          break;
-      }
-      break;
+/**
+  * @brief Set Matrix Pixel off.
+  * @param PixelRow: Specify Matrix Row.
+  * @param PixelColumn: Specify Matrix Column.
+  * @retval None
+  */
+void LCD_GLASS_ClearMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn)
+{
+  GLASS_Begin();
 
-    case PIXELROW_3:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 11*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 12*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 15*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 16*/
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 17*/
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 18*/
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_4:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
+  MatrixPixelDraw((uint8_t)PixelRow, (uint8_t)PixelColumn, 1, MATRIXDRAW_CLEAR);
 
-      }
-      break;
-    case PIXELROW_5:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 11*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 12*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 15*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 16*/
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 17*/
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 18*/
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_6:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 6*/
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 11*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 12*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 15*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 16*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 17*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x02;
-          break;
-
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6 , Column = 18*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1 , Column = 19*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_7:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 11*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 12*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 15*/
-          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 16*/
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 17*/
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 18*/
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_8:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 11*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 12*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 15*/
-          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 16 */
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 17 */
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 18*/
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_9:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 2 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 3 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 4 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 5 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 6 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 7 */
-          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 8 */
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 9*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 10*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 11*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 12*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 13*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 14*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 15*/
-          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 16*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 17*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 18*/
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9 , Column = 19 */
-          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_10:
-      switch ( PixelColumn)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10 , Column = 1 */
-          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 9*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 10*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 11*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x08;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 12*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x10;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 13*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x20;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 14*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x40;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 15*/
-          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x80;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x01;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 17*/
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x02;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 18*/
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x04;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x08;
-          break;
-
-        default:
-          break;
-      }
-      break;
-  }
+  GLASS_End();
 }
 
 /**
-  * @brief Set Matrix Pixel off.
+  * @brief Toggle Matrix Pixel.
   * @param PixelRow: Specify Matrix Row.
   * @param PixelColumn: Specify Matrix Column.
   * @retval None
   */
-void LCD_GLASS_ClearMatrixPixel(PixelRow_TypeDef PIXELROW, PixelColumn_TypeDef PIXELCOLUMN)
+void LCD_GLASS_ToggleMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn)
 {
-  switch (PIXELROW)
-  {
-    case PIXELROW_1:
-      switch (PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 15*/
-          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 1, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFB;
-          break;
-
-        default:
-          break;
+  GLASS_Begin();
 
-      }
-      break;
-    case PIXELROW_2:
-      switch ( PIXELCOLUMN)
-      {
-        case  PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFD;
-          break;
-
-        case  PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xBF;
-          break;
-
-        case  PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xDF;
-          break;
-
-        case  PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xEF;
-          break;
-
-        case  PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFD;
-          break;
-
-        case  PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFE;
-          break;
-
-        case  PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x7F;
-          break;
-
-        case  PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xEF;
-          break;
-
-        case  PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xF7;
-          break;
-
-        case  PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFB;
-          break;
-
-        case  PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xFD;
-          break;
-
-        case  PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xFE;
-          break;
-
-        case  PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xDF;
-          break;
-
-        case  PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xEF;
-          break;
-
-        case  PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xF7;
-          break;
-
-        case  PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFE;
-          break;
-
-        case  PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0x7F;
-          break;
-
-        case  PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 2, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xBF;
-          break;
-
-        default:
-          break;
-      }
-      break;
+  MatrixPixelDraw((uint8_t)PixelRow, (uint8_t)PixelColumn, 1, MATRIXDRAW_TOGGLE);
 
-    case PIXELROW_3:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 3, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_4:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 4, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
+  GLASS_End();
+}
 
-      }
-      break;
-    case PIXELROW_5:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 5, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_6:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row =6, Column = 2*/
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFE;
-          break;
-
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFD;
-          break;
-
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM First banck */
-          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
-          /* Position : Row = 6, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_7:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 7, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_8:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 8, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_9:
-      switch ( PIXELCOLUMN)
-      {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 9, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
-      }
-      break;
-    case PIXELROW_10:
-      switch ( PIXELCOLUMN)
+/**
+  * @brief  Draws a 1-bit bitmap in the matrix, the pixels out of the matrix
+  *         are not drawn.
+  * @param  PixelRow: Matrix Row of the top left pixel of the bitmap.
+  * @param  PixelColumn: Matrix Column of the top left pixel of the bitmap.
+  * @param  Width: Bitmap width in pixels.
+  * @param  Height: Bitmap height in pixels.
+  * @param  Bitmap: Pointer to the bitmap, Height lines of (Width + 7) / 8
+  *         bytes, the most significant bit of a byte being its leftmost pixel.
+  * @param  Mode: How the bitmap is drawn on the matrix
+  *         This parameter can be one of the MatrixDraw_TypeDef values.
+  * @retval None
+  */
+void LCD_GLASS_DrawMatrixBitmap(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                                uint8_t Width, uint8_t Height, uint8_t* Bitmap,
+                                MatrixDraw_TypeDef Mode)
+{
+  uint8_t x = 0, y = 0, bits = 0;
+
+  GLASS_Begin();
+
+  for (y = 0; y < Height; y++)
+  {
+    for (x = 0; x < Width; x++)
+    {
+      if ((x & 0x07) == 0)
       {
-        case PIXELCOLUMN_1:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 1 */
-          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_2:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 2 */
-          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_3:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 3 */
-          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_4:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 4 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_5:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 5 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_6:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 6 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_7:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 7 */
-          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_8:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 8 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_9:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 9 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_10:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 10 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_11:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 11 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xF7;
-          break;
-
-        case PIXELCOLUMN_12:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 12 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xEF;
-          break;
-
-        case PIXELCOLUMN_13:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 13 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xDF;
-          break;
-
-        case PIXELCOLUMN_14:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 14 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xBF;
-          break;
-
-        case PIXELCOLUMN_15:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 15 */
-          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0x7F;
-          break;
-
-        case PIXELCOLUMN_16:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 16 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFE;
-          break;
-
-        case PIXELCOLUMN_17:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 17 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFD;
-          break;
-
-        case PIXELCOLUMN_18:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 18 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFB;
-          break;
-
-        case PIXELCOLUMN_19:
-          /* Enable the write access on the LCD RAM second banck */
-          LCD->CR4 |= LCD_CR4_PAGECOM;
-          /* Position : Row = 10, Column = 19 */
-          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xF7;
-          break;
-
-        default:
-          break;
+        bits = *Bitmap++;
       }
-      break;
+      MatrixPixelDraw((uint8_t)(PixelRow + y), (uint8_t)(PixelColumn + x),
+                      (uint8_t)(bits & 0x80), Mode);
+      bits <<= 1;
+    }
   }
 
+  GLASS_End();
 }
+
 /**
-  * @brief  Converts an ascii char to the a LCD digit (previous coding).
-  * @param  c: a char to display.
-  * @param  Point: a point to add in front of a char
-  *         This parameter can be: POINT_OFF or POINT_ON
-  * @param  DoublePoint: flag indicating if Double Point has to be added in front
-  *         of the displayed character.
-  *         This parameter can be: DOUBLEPOINT_ON or DOUBLEPOINT_OFF.
+  * @brief  Draws a horizontal line in the matrix.
+  * @param  PixelRow: Matrix Row of the line.
+  * @param  PixelColumn: Matrix Column of the leftmost pixel of the line.
+  * @param  Length: Line length in pixels.
+  * @param  Mode: MATRIXDRAW_SET, MATRIXDRAW_CLEAR or MATRIXDRAW_TOGGLE
   * @retval None
   */
-static void Convert(uint8_t* c, Point_Typedef Point, DoublePoint_Typedef DoublePoint)
+void LCD_GLASS_DrawMatrixHLine(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                               uint8_t Length, MatrixDraw_TypeDef Mode)
 {
-  uint32_t ch = 0 , tmp = 0;
-  uint16_t i;
+  LCD_GLASS_FillMatrixRect(PixelRow, PixelColumn, Length, 1, Mode);
+}
 
-  /* The character c is a letter in upper case*/
-  if ((*c < (uint8_t)0x5B)&(*c > (uint8_t)0x40))
-  {
-    ch = LetterMap[*c-(uint8_t)0x41];
-  }
-  /* The character c is a number*/
-  if ((*c < (uint8_t)0x3A)&(*c > (uint8_t)0x2F))
-  {
-    ch = NumberMap[*c-(uint8_t)0x30];
-  }
-  /* The character c is a space character */
-  if (*c == (uint8_t)0x20)
+/**
+  * @brief  Draws a vertical line in the matrix.
+  * @param  PixelRow: Matrix Row of the top pixel of the line.
+  * @param  PixelColumn: Matrix Column of the line.
+  * @param  Length: Line length in pixels.
+  * @param  Mode: MATRIXDRAW_SET, MATRIXDRAW_CLEAR or MATRIXDRAW_TOGGLE
+  * @retval None
+  */
+void LCD_GLASS_DrawMatrixVLine(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                               uint8_t Length, MatrixDraw_TypeDef Mode)
+{
+  LCD_GLASS_FillMatrixRect(PixelRow, PixelColumn, 1, Length, Mode);
+}
+
+/**
+  * @brief  Draws the outline of a rectangle in the matrix.
+  * @param  PixelRow: Matrix Row of the top left corner.
+  * @param  PixelColumn: Matrix Column of the top left corner.
+  * @param  Width: Rectangle width in pixels.
+  * @param  Height: Rectangle height in pixels.
+  * @param  Mode: MATRIXDRAW_SET, MATRIXDRAW_CLEAR or MATRIXDRAW_TOGGLE
+  * @retval None
+  */
+void LCD_GLASS_DrawMatrixRect(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                              uint8_t Width, uint8_t Height, MatrixDraw_TypeDef Mode)
+{
+  uint8_t x = 0, y = 0;
+
+  GLASS_Begin();
+
+  for (y = 0; y < Height; y++)
   {
-    ch = (uint8_t)0x00;
+    for (x = 0; x < Width; x++)
+    {
+      /* Only the border pixels, each of them once */
+      if ((y == 0) || (y == (uint8_t)(Height - 1)) ||
+          (x == 0) || (x == (uint8_t)(Width - 1)))
+      {
+        MatrixPixelDraw((uint8_t)(PixelRow + y), (uint8_t)(PixelColumn + x), 1, Mode);
+      }
+    }
   }
-  /* Set the Q pixel in the character that can be displayed if the point is on */
-  if (Point == POINT_ON)
+
+  GLASS_End();
+}
+
+/**
+  * @brief  Draws a filled rectangle in the matrix.
+  * @param  PixelRow: Matrix Row of the top left corner.
+  * @param  PixelColumn: Matrix Column of the top left corner.
+  * @param  Width: Rectangle width in pixels.
+  * @param  Height: Rectangle height in pixels.
+  * @param  Mode: MATRIXDRAW_SET, MATRIXDRAW_CLEAR or MATRIXDRAW_TOGGLE
+  * @retval None
+  */
+void LCD_GLASS_FillMatrixRect(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                              uint8_t Width, uint8_t Height, MatrixDraw_TypeDef Mode)
+{
+  uint8_t x = 0, y = 0;
+
+  GLASS_Begin();
+
+  for (y = 0; y < Height; y++)
   {
-    ch |= (uint8_t)0x400000;
+    for (x = 0; x < Width; x++)
+    {
+      MatrixPixelDraw((uint8_t)(PixelRow + y), (uint8_t)(PixelColumn + x), 1, Mode);
+    }
   }
 
-  /* Set the P pixel in the character that can be displayed if the double point is on */
-  if (DoublePoint == DOUBLEPOINT_ON)
+  GLASS_End();
+}
+
+/**
+  * @brief  Sets all the pixels of the matrix off.
+  * @param  None
+  * @retval None
+  */
+void LCD_GLASS_ClearMatrix(void)
+{
+  LCD_GLASS_FillMatrixRect(PIXELROW_1, PIXELCOLUMN_1, 19, 10, MATRIXDRAW_CLEAR);
+}
+
+/**
+  * @brief  Looks up the LCD RAM location of a matrix pixel.
+  * @param  PixelRow: Specify Matrix Row.
+  * @param  PixelColumn: Specify Matrix Column.
+  * @param  Register: Returns the LCD RAM register of the pixel, GLASS_PAGE2
+  *         set when it is in the second bank.
+  * @param  Mask: Returns the bit of the pixel in the LCD RAM register.
+  * @retval ERROR if the row or the column is out of the matrix, SUCCESS otherwise
+  */
+static ErrorStatus MatrixPixelSelect(PixelRow_TypeDef PixelRow,
+                                     PixelColumn_TypeDef PixelColumn,
+                                     uint8_t* Register, uint8_t* Mask)
+{
+  if ((PixelRow < PIXELROW_1) || (PixelRow > PIXELROW_10) ||
+      (PixelColumn < PIXELCOLUMN_1) || (PixelColumn > PIXELCOLUMN_19))
   {
-    ch |= (uint8_t)0x000040;
+    return ERROR;
   }
 
-  for (i = 0;i < 6; i++)
+  *Register = MatrixPixelMap[PixelRow - 1][PixelColumn - 1].Register;
+  *Mask = MatrixPixelMap[PixelRow - 1][PixelColumn - 1].Mask;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Draws a matrix pixel in the LCD RAM shadow.
+  * @param  Row: Matrix Row, the pixel is ignored if out of the matrix.
+  * @param  Column: Matrix Column, the pixel is ignored if out of the matrix.
+  * @param  Pixel: 0 for a background pixel, drawn in MATRIXDRAW_COPY mode only
+  * @param  Mode: How the pixel is drawn
+  * @retval None
+  */
+static void MatrixPixelDraw(uint8_t Row, uint8_t Column, uint8_t Pixel,
+                            MatrixDraw_TypeDef Mode)
+{
+  uint8_t reg = 0, mask = 0;
+
+  if ((MatrixPixelSelect((PixelRow_TypeDef)Row, (PixelColumn_TypeDef)Column,
+                         &reg, &mask) != ERROR) &&
+      ((Pixel != 0) || (Mode == MATRIXDRAW_COPY)))
   {
-    tmp = ch & mask[i];
-    digit[i] = (uint8_t)(tmp >> (uint8_t)shift[i]);
+    if ((Pixel == 0) || (Mode == MATRIXDRAW_CLEAR))
+    {
+      *GLASS_Register(reg) &= (uint8_t)(~mask);
+    }
+    else if (Mode == MATRIXDRAW_TOGGLE)
+    {
+      *GLASS_Register(reg) ^= mask;
+    }
+    else
+    {
+      *GLASS_Register(reg) |= mask;
+    }
   }
 }
+
 /**
   * @brief  Inserts a delay time.
   * @param  nCount: specifies the delay time length.
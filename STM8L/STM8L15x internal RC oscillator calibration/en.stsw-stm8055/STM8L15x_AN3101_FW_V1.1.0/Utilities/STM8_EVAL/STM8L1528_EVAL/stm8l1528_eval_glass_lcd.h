@@ -25,6 +25,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm8l15x.h"
+#include "stm8_eval_glass_lcd.h"
 
 /* Private define ------------------------------------------------------------*/
 
@@ -160,17 +161,29 @@ typedef enum
   PIXELCOLUMN_19 = 19
 }PixelColumn_TypeDef;
 
+/**
+  * @brief LCD Glass Matrix drawing mode
+  */
+typedef enum
+{
+  MATRIXDRAW_SET    = 0, /*!< Pixels set on, background pixels unchanged */
+  MATRIXDRAW_CLEAR  = 1, /*!< Pixels set off, background pixels unchanged */
+  MATRIXDRAW_TOGGLE = 2, /*!< Pixels toggled, background pixels unchanged */
+  MATRIXDRAW_COPY   = 3  /*!< Bitmap only: pixels set on, background pixels
+                              set off */
+}MatrixDraw_TypeDef;
+
 /* Exported constants --------------------------------------------------------*/
+/* Number of characters of the LCD Glass */
+#define LCD_GLASS_CHAR_NB           ((uint8_t)7)
+
 /* Exported macro ------------------------------------------------------------*/
 /* Exported functions ------------------------------------------------------- */
 
 void LCD_GLASS_Init(void);
 void LCD_GLASS_WriteChar(uint8_t* ch, Point_Typedef Point,
                          DoublePoint_Typedef DoublePoint, uint8_t Position);
-void LCD_GLASS_ClearChar(uint8_t Position);
-void LCD_GLASS_Clear(void);
 void LCD_GLASS_ClearTextZone(void);
-void LCD_GLASS_DisplayString(uint8_t* ptr);
 void LCD_GLASS_ScrollString(uint8_t* ptr, uint32_t nScroll, uint32_t ScrollSpeed);
 
 void LCD_GLASS_DisplayLogo(FunctionalState NewState);
@@ -182,6 +195,19 @@ void LCD_GLASS_SignCmd(Sign_TypeDef Sign, FunctionalState NewState);
 
 void LCD_GLASS_ClearMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn);
 void LCD_GLASS_WriteMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn);
+void LCD_GLASS_ToggleMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn);
+void LCD_GLASS_DrawMatrixBitmap(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                                uint8_t Width, uint8_t Height, uint8_t* Bitmap,
+                                MatrixDraw_TypeDef Mode);
+void LCD_GLASS_DrawMatrixHLine(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                               uint8_t Length, MatrixDraw_TypeDef Mode);
+void LCD_GLASS_DrawMatrixVLine(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                               uint8_t Length, MatrixDraw_TypeDef Mode);
+void LCD_GLASS_DrawMatrixRect(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                              uint8_t Width, uint8_t Height, MatrixDraw_TypeDef Mode);
+void LCD_GLASS_FillMatrixRect(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn,
+                              uint8_t Width, uint8_t Height, MatrixDraw_TypeDef Mode);
+void LCD_GLASS_ClearMatrix(void);
 
 #endif /* __STM8L1528_EVAL_GLASS_LCD_H*/
 
@@ -0,0 +1,264 @@
+/**
+  ******************************************************************************
+  * @file    host.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header of the host models used by the host build of the STM8-EVAL
+  *          drivers.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_H
+#define __HOST_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8l15x.h"
+#include "host_sys.h"
+
+/* Exported types ------------------------------------------------------------*/
+/**
+  * @brief  Simulated time, in ns
+  */
+typedef unsigned long long HOST_Time_TypeDef;
+
+/**
+  * @brief  Device on a SPI bus, selected by a GPIO pin driven low
+  */
+typedef struct
+{
+  void (*Select)(void);             /*!< Chip select falling edge */
+  void (*Deselect)(void);           /*!< Chip select rising edge */
+  uint8_t (*Exchange)(uint8_t Data); /*!< Byte exchange while selected: gets
+                                         the MOSI byte, returns the MISO one */
+}HOST_SPIDevice_TypeDef;
+
+/**
+  * @brief  Device on the I2C bus, addressed by its slave address
+  */
+typedef struct
+{
+  FlagStatus (*Start)(I2C_Direction_TypeDef Direction); /*!< Slave address
+                                      received: returns SET to acknowledge */
+  FlagStatus (*Write)(uint8_t Data); /*!< Byte received from the master:
+                                      returns SET to acknowledge it */
+  uint8_t (*Read)(void);             /*!< Byte sent to the master */
+  void (*Stop)(void);                /*!< STOP condition, or repeated START
+                                      addressing another device */
+}HOST_I2CDevice_TypeDef;
+
+/**
+  * @brief  I2C bus use, counted since the start
+  */
+typedef struct
+{
+  uint32_t StartNb;       /*!< START and repeated START conditions */
+  uint32_t NackNb;        /*!< Slave addresses not acknowledged */
+  uint32_t ByteNb;        /*!< Data bytes sent or received */
+  uint32_t ErrorNb;       /*!< Master errors: DR written out of the address or
+                               transmitter phases, STOP or START sent after
+                               a byte read with ACK */
+}HOST_I2CStatistics_TypeDef;
+
+/**
+  * @brief  M25P SPI FLASH timings, in ns
+  */
+typedef struct
+{
+  HOST_Time_TypeDef PageProgramTime; /*!< Page WRITE cycle, tPP */
+  HOST_Time_TypeDef SectorEraseTime; /*!< Sector erase cycle, tSE */
+  HOST_Time_TypeDef BulkEraseTime;   /*!< Bulk erase cycle, tBE */
+}HOST_M25PTiming_TypeDef;
+
+/**
+  * @brief  M25P SPI FLASH instructions, counted since HOST_M25PInit()
+  */
+typedef struct
+{
+  uint32_t ReadNb;        /*!< READ and FAST_READ instructions */
+  uint32_t ReadByteNb;    /*!< Bytes read */
+  uint32_t ProgramNb;     /*!< Page WRITE cycles */
+  uint32_t ProgramByteNb; /*!< Bytes programmed */
+  uint32_t EraseNb;       /*!< Sector and bulk erase cycles */
+  uint32_t StatusNb;      /*!< Status register bytes read */
+  uint32_t ErrorNb;       /*!< Instructions ignored: sent while a write cycle
+                               is in progress, without write enable, or with
+                               a wrong length */
+}HOST_M25PStatistics_TypeDef;
+
+/**
+  * @brief  M24C I2C EEPROM operations, counted since HOST_M24CInit()
+  */
+typedef struct
+{
+  uint32_t ReadByteNb;    /*!< Bytes read */
+  uint32_t WriteNb;       /*!< Write cycles */
+  uint32_t WriteByteNb;   /*!< Bytes written */
+  uint32_t BusyNb;        /*!< Slave addresses not acknowledged during a
+                               write cycle */
+  uint32_t ErrorNb;       /*!< Writes ended with an incomplete address */
+}HOST_M24CStatistics_TypeDef;
+
+/**
+  * @brief  SD card type, capacity and timings, in ns
+  */
+typedef struct
+{
+  uint8_t Type;                           /*!< HOST_SD_TYPE_xxx */
+  uint8_t ResponseDelay;                  /*!< Bytes before the responses,
+                                               NCR: 0 to 8 */
+  uint32_t BlockNb;                       /*!< Capacity, in 512-byte blocks */
+  HOST_Time_TypeDef InitTime;             /*!< Initialization process, from
+                                               the first ACMD41 or CMD1 */
+  HOST_Time_TypeDef ReadAccessTime;       /*!< Read command to data token */
+  HOST_Time_TypeDef MultiBlockReadTime;   /*!< Block to next data token of a
+                                               multiple block read */
+  HOST_Time_TypeDef BlockWriteTime;       /*!< Busy after a block written by
+                                               CMD24 */
+  HOST_Time_TypeDef MultiBlockWriteTime;  /*!< Busy after a block written by
+                                               CMD25 */
+  HOST_Time_TypeDef StopWriteTime;        /*!< Busy after the stop token of a
+                                               multiple block write */
+}HOST_SDConfig_TypeDef;
+
+/**
+  * @brief  SD card commands and blocks, counted since HOST_SDInit()
+  */
+typedef struct
+{
+  uint32_t CommandNb;     /*!< Commands received, CMD55 and ACMDs included */
+  uint32_t ReadBlockNb;   /*!< Blocks sent, the CSD and CID included */
+  uint32_t WriteBlockNb;  /*!< Blocks programmed */
+  uint32_t IllegalNb;     /*!< Commands rejected as illegal, as CMD8 by the
+                               version 1.x cards during SD_Init() */
+  uint32_t ErrorNb;       /*!< Commands rejected for a CRC, parameter or
+                               address error, or ignored: sent while the card
+                               is busy or in a block read; blocks read past
+                               the memory or written with a CRC error */
+}HOST_SDStatistics_TypeDef;
+
+/* Exported constants --------------------------------------------------------*/
+#define HOST_LCD_PAGE_NB    ((uint8_t)2)  /*!< LCD RAM banks */
+#define HOST_LCD_RAM_NB     ((uint8_t)22) /*!< LCD RAM registers per bank */
+
+/* System clock of the models: HSI, not divided */
+#define HOST_SYSCLK         ((uint32_t)16000000)
+
+/* Largest number of devices on the SPI buses */
+#define HOST_SPI_DEVICE_NB  ((uint8_t)4)
+
+/* Largest number of devices on the I2C bus */
+#define HOST_I2C_DEVICE_NB  ((uint8_t)4)
+
+/* M25P64: 64 Mbit, 128 sectors of 64 Kbytes, typical timings */
+#define HOST_M25P_SIZE          ((uint32_t)0x800000)
+#define HOST_M25P_SECTOR_SIZE   ((uint32_t)0x10000)
+#define HOST_M25P_PAGE_SIZE     ((uint32_t)0x100)
+#define HOST_M25P_ID            ((uint32_t)0x202017)
+#define HOST_M25P_TPP           ((HOST_Time_TypeDef)1400000)
+#define HOST_M25P_TSE           ((HOST_Time_TypeDef)1000000000)
+#define HOST_M25P_TBE           ((HOST_Time_TypeDef)68000000000ULL)
+
+/* M24C64: 64 Kbit, 32-byte pages, maximum write cycle time */
+#define HOST_M24C_SIZE          ((uint32_t)0x2000)
+#define HOST_M24C_PAGE_SIZE     ((uint32_t)0x20)
+#define HOST_M24C_TW            ((HOST_Time_TypeDef)5000000)
+
+/* LM75 registers, and their power-up values */
+#define HOST_LM75_REG_TEMP      ((uint8_t)0x00)
+#define HOST_LM75_REG_CONF      ((uint8_t)0x01)
+#define HOST_LM75_REG_THYS      ((uint8_t)0x02)
+#define HOST_LM75_REG_TOS       ((uint8_t)0x03)
+#define HOST_LM75_THYS          ((uint16_t)0x4B00)  /*!< 75 C */
+#define HOST_LM75_TOS           ((uint16_t)0x5000)  /*!< 80 C */
+
+/* SD card types */
+#define HOST_SD_TYPE_MMC        ((uint8_t)0x01) /*!< MultiMediaCard */
+#define HOST_SD_TYPE_V1         ((uint8_t)0x02) /*!< SD card version 1.x */
+#define HOST_SD_TYPE_V2         ((uint8_t)0x03) /*!< SD card version 2.0, standard capacity */
+#define HOST_SD_TYPE_HC         ((uint8_t)0x04) /*!< SDHC card */
+
+/* SD card default configuration: 64 Mbytes SDHC card, timings of a class 4
+   card */
+#define HOST_SD_BLOCK_NB            ((uint32_t)131072)
+#define HOST_SD_BLOCK_NB_MAX        ((uint32_t)0x7FFFFF)
+#define HOST_SD_NCR                 ((uint8_t)1)
+#define HOST_SD_INIT_TIME           ((HOST_Time_TypeDef)100000000)
+#define HOST_SD_READ_ACCESS_TIME    ((HOST_Time_TypeDef)250000)
+#define HOST_SD_MULTI_READ_TIME     ((HOST_Time_TypeDef)20000)
+#define HOST_SD_WRITE_TIME          ((HOST_Time_TypeDef)1000000)
+#define HOST_SD_MULTI_WRITE_TIME    ((HOST_Time_TypeDef)200000)
+#define HOST_SD_STOP_WRITE_TIME     ((HOST_Time_TypeDef)1000000)
+
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+/* LCD model */
+void HOST_LCDReset(void);
+void HOST_LCDFill(uint8_t Value);
+uint8_t HOST_LCDRead(uint8_t Page, uint8_t Register);
+
+/* Simulated time */
+HOST_Time_TypeDef HOST_GetTime(void);
+void HOST_Wait(HOST_Time_TypeDef Time);
+
+/* SPI buses */
+void HOST_SPIAttach(SPI_TypeDef* SPIx, GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin,
+                    const HOST_SPIDevice_TypeDef* Device);
+void HOST_SPIPinChange(GPIO_TypeDef* GPIOx);
+HOST_Time_TypeDef HOST_SPIByteTime(SPI_TypeDef* SPIx);
+
+/* GPIO input levels */
+void HOST_GPIOSetInput(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin, BitStatus Level);
+
+/* M25P SPI FLASH, backed by an image file */
+ErrorStatus HOST_M25PInit(const char* FileName, const HOST_M25PTiming_TypeDef* Timing);
+void HOST_M25PDeInit(void);
+void HOST_M25PGetStatistics(HOST_M25PStatistics_TypeDef* Statistics);
+uint8_t* HOST_M25PMemory(void);
+extern const HOST_SPIDevice_TypeDef HOST_M25P;
+
+/* SD card, backed by an image file */
+ErrorStatus HOST_SDInit(const char* FileName, const HOST_SDConfig_TypeDef* Config);
+void HOST_SDDeInit(void);
+void HOST_SDGetStatistics(HOST_SDStatistics_TypeDef* Statistics);
+uint8_t* HOST_SDMemory(void);
+extern const HOST_SPIDevice_TypeDef HOST_SD;
+
+/* I2C bus */
+void HOST_I2CAttach(I2C_TypeDef* I2Cx, uint8_t Address,
+                    const HOST_I2CDevice_TypeDef* Device);
+void HOST_I2CAttachIRQ(I2C_TypeDef* I2Cx, void (*Handler)(void));
+void HOST_I2CGetStatistics(HOST_I2CStatistics_TypeDef* Statistics);
+HOST_Time_TypeDef HOST_I2CBitTime(I2C_TypeDef* I2Cx);
+
+/* M24C I2C EEPROM, backed by an image file */
+ErrorStatus HOST_M24CInit(const char* FileName, HOST_Time_TypeDef WriteTime);
+void HOST_M24CDeInit(void);
+void HOST_M24CGetStatistics(HOST_M24CStatistics_TypeDef* Statistics);
+uint8_t* HOST_M24CMemory(void);
+extern const HOST_I2CDevice_TypeDef HOST_M24C;
+
+/* LM75 temperature sensor */
+void HOST_LM75Init(void);
+void HOST_LM75SetTemperature(uint16_t Temperature);
+uint16_t HOST_LM75Register(uint8_t Pointer);
+extern const HOST_I2CDevice_TypeDef HOST_LM75;
+
+/* DMA, serving the SPI requests */
+void HOST_DMAAttachIRQ(DMA_Channel_TypeDef* DMA_Channelx, void (*Handler)(void));
+void HOST_DMARequest(void);
+
+#endif /* __HOST_H */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
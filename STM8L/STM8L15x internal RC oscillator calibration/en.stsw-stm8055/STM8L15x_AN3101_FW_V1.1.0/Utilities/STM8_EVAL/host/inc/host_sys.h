@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file    host_sys.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Header of the host system services used by the models: it does not
+  *          include the STM8 headers, whose integer types differ from the host
+  *          ones.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __HOST_SYS_H
+#define __HOST_SYS_H
+
+/* Includes ------------------------------------------------------------------*/
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Exported macro ------------------------------------------------------------*/
+/* Exported functions ------------------------------------------------------- */
+unsigned char* HOST_FileMap(const char* FileName, unsigned long Size,
+                            unsigned char Fill);
+void HOST_FileUnmap(unsigned char* Memory, unsigned long Size);
+unsigned char* HOST_RAMAddress(unsigned short Address);
+void HOST_TimerStart(void (*Handler)(void), unsigned long Period);
+void HOST_TimerStop(void);
+void HOST_Fatal(const char* Format, ...);
+
+#endif /* __HOST_SYS_H */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    stm8l15x_conf.h
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Library configuration file of the host build of the STM8-EVAL
+  *          drivers: the peripheral registers are mapped into the host memory.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __STM8L15x_CONF_H
+#define __STM8L15x_CONF_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stm8l15x_adc.h"
+#include "stm8l15x_beep.h"
+#include "stm8l15x_clk.h"
+#include "stm8l15x_comp.h"
+#include "stm8l15x_dac.h"
+#include "stm8l15x_dma.h"
+#include "stm8l15x_exti.h"
+#include "stm8l15x_flash.h"
+#include "stm8l15x_gpio.h"
+#include "stm8l15x_i2c.h"
+#include "stm8l15x_irtim.h"
+#include "stm8l15x_itc.h"
+#include "stm8l15x_iwdg.h"
+#include "stm8l15x_lcd.h"
+#include "stm8l15x_pwr.h"
+#include "stm8l15x_rst.h"
+#include "stm8l15x_rtc.h"
+#include "stm8l15x_spi.h"
+#include "stm8l15x_syscfg.h"
+#include "stm8l15x_tim1.h"
+#include "stm8l15x_tim2.h"
+#include "stm8l15x_tim3.h"
+#include "stm8l15x_tim4.h"
+#include "stm8l15x_usart.h"
+#include "stm8l15x_wfe.h"
+#include "stm8l15x_wwdg.h"
+
+/* Exported types ------------------------------------------------------------*/
+/* Exported constants --------------------------------------------------------*/
+/* Size of the host image of the STM8 I/O and CPU register areas */
+#define HOST_IO_SIZE    ((uint16_t)0x8000)
+
+/* Exported macro ------------------------------------------------------------*/
+/* The peripheral registers are read and written in HostIO[], at their STM8
+   address. The LCD RAM has a second bank, selected by LCD_CR4_PAGECOM as on
+   the STM8L15x High-Density devices: the LCD registers are given by HOST_LCD() */
+#define HOST_IO(Base)   ((void*)&HostIO[(Base)])
+
+#undef SYSCFG
+#define SYSCFG          ((SYSCFG_TypeDef *) HOST_IO(SYSCFG_BASE))
+#undef GPIOA
+#define GPIOA           ((GPIO_TypeDef *) HOST_IO(GPIOA_BASE))
+#undef GPIOB
+#define GPIOB           ((GPIO_TypeDef *) HOST_IO(GPIOB_BASE))
+#undef GPIOC
+#define GPIOC           ((GPIO_TypeDef *) HOST_IO(GPIOC_BASE))
+#undef GPIOD
+#define GPIOD           ((GPIO_TypeDef *) HOST_IO(GPIOD_BASE))
+#undef GPIOE
+#define GPIOE           ((GPIO_TypeDef *) HOST_IO(GPIOE_BASE))
+#undef GPIOF
+#define GPIOF           ((GPIO_TypeDef *) HOST_IO(GPIOF_BASE))
+#undef GPIOG
+#define GPIOG           ((GPIO_TypeDef *) HOST_IO(GPIOG_BASE))
+#undef GPIOH
+#define GPIOH           ((GPIO_TypeDef *) HOST_IO(GPIOH_BASE))
+#undef GPIOI
+#define GPIOI           ((GPIO_TypeDef *) HOST_IO(GPIOI_BASE))
+#undef RTC
+#define RTC             ((RTC_TypeDef *) HOST_IO(RTC_BASE))
+#undef FLASH
+#define FLASH           ((FLASH_TypeDef *) HOST_IO(FLASH_BASE))
+#undef EXTI
+#define EXTI            ((EXTI_TypeDef *) HOST_IO(EXTI_BASE))
+#undef RST
+#define RST             ((RST_TypeDef *) HOST_IO(RST_BASE))
+#undef PWR
+#define PWR             ((PWR_TypeDef *) HOST_IO(PWR_BASE))
+#undef CLK
+#define CLK             ((CLK_TypeDef *) HOST_IO(CLK_BASE))
+#undef CSSLSE
+#define CSSLSE          ((CSSLSE_TypeDef *) HOST_IO(CSSLSE_BASE))
+#undef WWDG
+#define WWDG            ((WWDG_TypeDef *) HOST_IO(WWDG_BASE))
+#undef IWDG
+#define IWDG            ((IWDG_TypeDef *) HOST_IO(IWDG_BASE))
+#undef WFE
+#define WFE             ((WFE_TypeDef *) HOST_IO(WFE_BASE))
+#undef BEEP
+#define BEEP            ((BEEP_TypeDef *) HOST_IO(BEEP_BASE))
+#undef SPI1
+#define SPI1            ((SPI_TypeDef *) HOST_IO(SPI1_BASE))
+#undef SPI2
+#define SPI2            ((SPI_TypeDef *) HOST_IO(SPI2_BASE))
+#undef I2C1
+#define I2C1            ((I2C_TypeDef *) HOST_IO(I2C1_BASE))
+#undef USART1
+#define USART1          ((USART_TypeDef *) HOST_IO(USART1_BASE))
+#undef USART2
+#define USART2          ((USART_TypeDef *) HOST_IO(USART2_BASE))
+#undef USART3
+#define USART3          ((USART_TypeDef *) HOST_IO(USART3_BASE))
+#undef LCD
+#define LCD             (HOST_LCD())
+#undef TIM1
+#define TIM1            ((TIM1_TypeDef *) HOST_IO(TIM1_BASE))
+#undef TIM2
+#define TIM2            ((TIM_TypeDef *) HOST_IO(TIM2_BASE))
+#undef TIM3
+#define TIM3            ((TIM_TypeDef *) HOST_IO(TIM3_BASE))
+#undef TIM4
+#define TIM4            ((TIM4_TypeDef *) HOST_IO(TIM4_BASE))
+#undef TIM5
+#define TIM5            ((TIM_TypeDef *) HOST_IO(TIM5_BASE))
+#undef IRTIM
+#define IRTIM           ((IRTIM_TypeDef *) HOST_IO(IRTIM_BASE))
+#undef ITC
+#define ITC             ((ITC_TypeDef *) HOST_IO(ITC_BASE))
+#undef DAC
+#define DAC             ((DAC_TypeDef *) HOST_IO(DAC_BASE))
+#undef DMA1
+#define DMA1            ((DMA_TypeDef *) HOST_IO(DMA1_BASE))
+#undef DMA1_Channel0
+#define DMA1_Channel0   ((DMA_Channel_TypeDef *) HOST_IO(DMA1_Channel0_BASE))
+#undef DMA1_Channel1
+#define DMA1_Channel1   ((DMA_Channel_TypeDef *) HOST_IO(DMA1_Channel1_BASE))
+#undef DMA1_Channel2
+#define DMA1_Channel2   ((DMA_Channel_TypeDef *) HOST_IO(DMA1_Channel2_BASE))
+#undef DMA1_Channel3
+#define DMA1_Channel3   ((DMA_Channel_TypeDef *) HOST_IO(DMA1_Channel3_BASE))
+#undef DM
+#define DM              ((DM_TypeDef *) HOST_IO(DM_BASE))
+#undef RI
+#define RI              ((RI_TypeDef *) HOST_IO(RI_BASE))
+#undef COMP
+#define COMP            ((COMP_TypeDef *) HOST_IO(COMP_BASE))
+#undef AES
+#define AES             ((AES_TypeDef *) HOST_IO(AES_BASE))
+#undef ADC1
+#define ADC1            ((ADC_TypeDef *) HOST_IO(ADC1_BASE))
+#undef CFG
+#define CFG             ((CFG_TypeDef *) HOST_IO(CFG_BASE))
+#undef OPT
+#define OPT             ((OPT_TypeDef *) HOST_IO(OPT_BASE))
+
+#define assert_param(expr) ((void)0)
+
+/* Exported functions ------------------------------------------------------- */
+extern uint8_t HostIO[HOST_IO_SIZE];
+LCD_TypeDef* HOST_LCD(void);
+
+#endif /* __STM8L15x_CONF_H */
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
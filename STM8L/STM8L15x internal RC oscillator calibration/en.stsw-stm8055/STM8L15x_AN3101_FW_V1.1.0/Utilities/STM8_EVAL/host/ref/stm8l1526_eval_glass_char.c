@@ -0,0 +1,216 @@
+/**
+  ******************************************************************************
+  * @file    stm8l1526_eval_glass_char.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Reference of the character functions of the 1526 glass LCD driver:
+  *          LCD_GLASS_WriteChar() and Convert() as released with the V2.1.0
+  *          driver, computing the LCD digits from LetterMap[] and NumberMap[].
+  *
+  *          @note This file is not a driver source. It is included by
+  *                glass_char_test.c, which compares it with the driver built
+  *                on GlyphMap[], and it is the input of tools/glyph_map.py,
+  *                which generates GlyphMap[].
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+static void Convert(uint8_t* c, Point_Typedef point, Apostrophe_Typedef apostrophe);
+
+__CONST uint16_t mask[4] =
+  {
+    0xF000, 0x0F00, 0x00F0, 0x000F
+  };
+__CONST uint8_t shift[4] =
+  {
+    12, 8, 4, 0
+  };
+
+uint8_t digit[4];     /* Digit frame buffer */
+
+/* Letters and number map of PD_878 LCD */
+__CONST uint16_t LetterMap[26] =
+  {
+    /* A      B      C      D      E      F      G      H      I  */
+    0x4D70, 0x6469, 0x4111, 0x6449, 0x4911, 0x4910, 0x4171, 0x0D70, 0x6009,
+    /* J      K      L      M      N      O      P      Q      R  */
+    0x0451, 0x0B12, 0x0111, 0x8750, 0x8552, 0x4551, 0x4D30, 0x4553, 0x4D32,
+    /* S      T      U      V      W      X      Y      Z  */
+    0x4961, 0x6008, 0x0551, 0x0390, 0x05D2, 0x8282, 0x8208, 0x4281
+  };
+
+__CONST uint16_t NumberMap[10] =
+  {
+    /* 0      1      2      3      4      5      6      7      8      9  */
+    0x47D1, 0x0640, 0x4C31, 0x4C61, 0x0D60, 0x4961, 0x4971, 0x4440, 0x4D71, 0x4D61
+  };
+
+/**
+  * @brief  This function writes a char in the LCD frame buffer.
+  * @param  ch: the character to dispaly.
+  * @param  point: a point to add in front of char
+  *         This parameter can be: POINT_OFF or POINT_ON
+  * @param  apostrophe: flag indicating if a apostrophe has to be add in front
+  *         of displayed character.
+  *         This parameter can be: APOSTROPHE_OFF or APOSTROPHE_ON.
+  * @param  position: position in the LCD of the caracter to write [0:7]
+  * @retval None
+  * @par    Required preconditions: The LCD should be cleared before to start the
+  *         write operation.
+  */
+void LCD_GLASS_WriteChar(uint8_t* ch, Point_Typedef point,
+                         Apostrophe_Typedef apostrophe, uint8_t position)
+{
+  Convert(ch, point, apostrophe);
+
+  switch (position)
+  {
+      /* Position 0 on LCD (Digit1)*/
+    case 0:
+      LCD->RAM[LCD_RAMRegister_3] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_3] |=  digit[0];
+      LCD->RAM[LCD_RAMRegister_6] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_6] |=  (uint8_t)(digit[1] << 4);
+      LCD->RAM[LCD_RAMRegister_10] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_10] |=  digit[2];
+      LCD->RAM[LCD_RAMRegister_13] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_13] |=  (uint8_t)((uint8_t)digit[3] << 4);
+      break;
+
+      /* Position 1 on LCD (Digit2)*/
+    case 1:
+      LCD->RAM[LCD_RAMRegister_2] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_2] |=  (uint8_t)(digit[0] << 4);
+      LCD->RAM[LCD_RAMRegister_6] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_6] |=  digit[1];
+      LCD->RAM[LCD_RAMRegister_9] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_9] |=   (uint8_t)(digit[2] << 4);
+      LCD->RAM[LCD_RAMRegister_13] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_13] |=  digit[3];
+      break;
+
+      /* Position 2 on LCD (Digit3)*/
+    case 2:
+      LCD->RAM[LCD_RAMRegister_2] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_2] |=  digit[0];
+      LCD->RAM[LCD_RAMRegister_5] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_5] |=  (uint8_t)(digit[1] << 4);
+      LCD->RAM[LCD_RAMRegister_9] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_9] |=   digit[2];
+      LCD->RAM[LCD_RAMRegister_12] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_12] |=  (uint8_t)(digit[3] << 4);
+      break;
+
+      /* Position 3 on LCD (Digit4)*/
+    case 3:
+      LCD->RAM[LCD_RAMRegister_1] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_1] |=  (uint8_t)(digit[0] << 4);
+      LCD->RAM[LCD_RAMRegister_5] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_5] |=  digit[1];
+      LCD->RAM[LCD_RAMRegister_8] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_8] |=   (uint8_t)(digit[2] << 4);
+      LCD->RAM[LCD_RAMRegister_12] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_12] |=  digit[3];
+      break;
+
+      /* Position 4 on LCD (Digit5)*/
+    case 4:
+      LCD->RAM[LCD_RAMRegister_1] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_1] |=  digit[0];
+      LCD->RAM[LCD_RAMRegister_4] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_4] |=  (uint8_t)(digit[1] << 4);
+      LCD->RAM[LCD_RAMRegister_8] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_8] |=   digit[2];
+      LCD->RAM[LCD_RAMRegister_11] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_11] |=  (uint8_t)(digit[3] << 4);
+      break;
+
+      /* Position 5 on LCD (Digit6)*/
+    case 5:
+      LCD->RAM[LCD_RAMRegister_0] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_0] |=  (uint8_t)(digit[0] << 4);
+      LCD->RAM[LCD_RAMRegister_4] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_4] |=  digit[1];
+      LCD->RAM[LCD_RAMRegister_7] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_7] |=   (uint8_t)(digit[2] << 4);
+      LCD->RAM[LCD_RAMRegister_11] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_11] |=  digit[3];
+      break;
+
+      /* Position 6 on LCD (Digit7)*/
+    case 6:
+      LCD->RAM[LCD_RAMRegister_0] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_0] |=  digit[0];
+      LCD->RAM[LCD_RAMRegister_3] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_3] |=  (uint8_t)(digit[1] << 4);
+      LCD->RAM[LCD_RAMRegister_7] &= LCD_CLEAR_LSB;
+      LCD->RAM[LCD_RAMRegister_7] |=  digit[2];
+      LCD->RAM[LCD_RAMRegister_10] &= LCD_CLEAR_MSB;
+      LCD->RAM[LCD_RAMRegister_10] |=  (uint8_t)(digit[3] << 4);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  * @brief  Converts an ascii char to the a LCD digit (previous coding).
+  * @param  c: a char to display.
+  * @param  point: a point to add in front of char
+  *         This parameter can be: POINT_OFF or POINT_ON
+  * @param  apostrophe: flag indicating if a apostrophe has to be add in front
+  *         of displayed character.
+  *         This parameter can be: APOSTROPHE_OFF or APOSTROPHE_ON.
+  * @retval None
+  */
+static void Convert(uint8_t* c, Point_Typedef point, Apostrophe_Typedef apostrophe)
+{
+  uint16_t ch = 0 , tmp = 0;
+  uint8_t i;
+
+  /* The character c is a letter in upper case*/
+  if ((*c < 0x5B)&(*c > 0x40))
+  {
+    ch = LetterMap[*c-0x41];
+  }
+  /* The character c is a number*/
+  if ((*c < 0x3A)&(*c > 0x2F))
+  {
+    ch = NumberMap[*c-0x30];
+  }
+  /* The character c is a space character */
+  if (*c == 0x20)
+  {
+    ch = 0x00;
+  }
+  /* Set the DP seg in the character that can be displayed if the point is on */
+  if (point == POINT_ON)
+  {
+    ch |= 0x0004;
+  }
+
+  /* Set the X seg in the character that can be displayed if the apostrophe is on */
+  if (apostrophe == APOSTROPHE_ON)
+  {
+    ch |= 0x1000;
+  }
+
+  for (i = 0;i < 4; i++)
+  {
+    tmp = ch & mask[i];
+    digit[i] = (uint8_t)(tmp >> (uint8_t)shift[i]);
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,388 @@
+/**
+  ******************************************************************************
+  * @file    stm8l1528_eval_glass_char.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Reference of the character functions of the 1528 glass LCD driver:
+  *          LCD_GLASS_WriteChar() and Convert() as released with the V2.1.0
+  *          driver, computing the LCD digits from LetterMap[] and NumberMap[].
+  *
+  *          @note The point is ORed as (uint32_t)0x400000: the V2.1.0 driver
+  *                cast it to uint8_t, which gives 0, and never displayed the
+  *                point. This is the only change from the V2.1.0 code.
+  *
+  *          @note This file is not a driver source. It is included by
+  *                glass_char_test.c, which compares it with the driver built
+  *                on GlyphMap[], and it is the input of tools/glyph_map.py,
+  *                which generates GlyphMap[].
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+static void Convert(uint8_t* c, Point_Typedef Point, DoublePoint_Typedef DoublePoint);
+
+const uint32_t mask [] =
+  {
+    0xF00000, 0x0F0000, 0x00F000, 0x000F00, 0x0000F0, 0x00000F
+  };
+const uint8_t shift[6] =
+  {
+    20, 16, 12, 8, 4, 0
+  };
+
+uint8_t digit[6];     /* Digit frame buffer */
+
+/* Letters and number map of the custom LCD 8x40(Big-Falco Evaluation boad) */
+__CONST uint32_t LetterMap[26] =
+  {
+    /* A         B         C         D        E          F         G          H         I  */
+    0x002536, 0x202536, 0x202404, 0x222310, 0x202426, 0x002426, 0x202416, 0x000536, 0x222200,
+    /*  J        K         L         M         N         O         P          Q         R  */
+    0x200114, 0x001425, 0x200404, 0x005514, 0x004515, 0x202514, 0x002526, 0x002532, 0x002527,
+    /*  S        T         U         V         W         X         Y          Z  */
+    0x202432, 0x022200, 0x200514, 0x041404, 0x050515, 0x045001, 0x025000, 0x243000
+  };
+
+__CONST uint32_t NumberMap[10] =
+  {
+    /*  0         1          2        3        4   */
+    0x202514, 0x000110, 0x202126, 0x202132, 0x000532,
+    /*  5         6          7        8        9   */
+    0x202432, 0x202436, 0x002110, 0x202536, 0x202532
+  };
+
+/**
+  * @brief  This function writes a char on the LCD Glass.
+  * @param  ch: the character to dispaly.
+  * @param  point: a point to add in front of char
+  *         This parameter can be: POINT_OFF or POINT_ON
+  * @param  DoublePoint: flag indicating if a double point has to be added in front
+  *         of the displayed character.
+  *         This parameter can be: DOUBLEPOINT_OFF or DOUBLEPOINT_ON.
+  * @param  position: position in the LCD of the character to write [0:6]
+  * @retval None
+  */
+void LCD_GLASS_WriteChar(uint8_t* ch, Point_Typedef Point,
+                         DoublePoint_Typedef DoublePoint, uint8_t Position)
+{
+  Convert(ch, Point, DoublePoint);
+  /* Enable the write access on the LCD RAM first banck */
+  LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+  switch (Position)
+  {
+      /* Position 0 on LCD (Digit1)*/
+    case 0:
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFB;
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[0] << (uint8_t)0x01);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x3F;
+      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[1] << (uint8_t)0x05);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xF1;
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[2] << (uint8_t)0x01);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0x1F;
+      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[3] << (uint8_t)0x05);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xF9;
+      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)(digit[4] << (uint8_t)0x01);
+
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0x1F;
+      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)(digit[5] << (uint8_t)0x05);
+      break;
+
+      /* Position 1 on LCD */
+    case 1:
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x9F;
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[0] << (uint8_t)0x04);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF9;
+      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[1]);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x8F;
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)(digit[2] << (uint8_t)0x04);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xF8;
+      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[3]);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x8F;
+      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)(digit[4] << (uint8_t)0x04);
+
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xF8;
+      LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)(digit[5]);
+      break;
+
+      /* Position 2 on LCD (Digit3)*/
+    case 2:
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFF;
+      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[0] & (uint8_t)0x01) << (uint8_t)0x07);
+      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)((digit[0] & (uint8_t)0x06) >> (uint8_t)0x01);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xCF;
+      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[1] << (uint8_t)0x03);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0x7F;
+      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xFC;
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[2] & (uint8_t)0x1) << (uint8_t)0x07);
+      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)((digit[2] & (uint8_t)0x6) >> (uint8_t)0x01);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0xC7;
+      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)(digit[3] << (uint8_t)0x03);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x7F;
+      LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFC;
+      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)((digit[4] & (uint8_t)0x1) << (uint8_t)0x07);
+      LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)((digit[4] & (uint8_t)0x6) >> (uint8_t)0x01);
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xC7;
+      LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)(digit[5] << (uint8_t)0x03);
+      break;
+
+      /* Position 3 on LCD */
+    case 3:
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE7;
+      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)(digit[0] << (uint8_t)0x02);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x7F;
+      LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
+      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)((digit[1] & (uint8_t)0x03) << (uint8_t)0x06);
+      LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)((digit[1] & (uint8_t)0x04) >> (uint8_t)0x02);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xE3;
+      LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)(digit[2] << (uint8_t)0x02);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_5] &= (uint8_t)0x3F;
+      LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFE;
+      LCD->RAM[LCD_RAMRegister_5] |= (uint8_t)((digit[3] & (uint8_t)0x3) << (uint8_t)0x06);
+      LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)((digit[3] & (uint8_t)0x4) >> (uint8_t)0x02);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xE3;
+      LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)(digit[4] << (uint8_t)0x02);
+
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0x3F;
+      LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFE;
+      LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)((digit[5] & (uint8_t)0x3) << (uint8_t)0x06);
+      LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)((digit[5] & (uint8_t)0x4) >> (uint8_t)0x02);
+      break;
+
+      /* Position 4 on LCD (Digit5)*/
+    case 4:
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF9;
+      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[0]);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x9F;
+      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)(digit[1] << (uint8_t)0x4);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xF8;
+      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[2]);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x8F;
+      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)(digit[3] << (uint8_t)0x04);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xF8;
+      LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)(digit[4]);
+
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x8F;
+      LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)(digit[5] << (uint8_t)0x04);
+      break;
+
+      /* Position 5 on LCD (Digit6)*/
+    case 5:
+
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xCF;
+      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[0] << (uint8_t)0x03);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFF;
+      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
+      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)((digit[1] & (uint8_t)0x01) << (uint8_t)0x07);
+      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)((digit[1] & (uint8_t)0x06) >> (uint8_t)0x01);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0xC7;
+      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)(digit[2] << (uint8_t)0x03);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0x7F;
+      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xFC;
+      LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)((digit[3] & (uint8_t)0x01) << (uint8_t)0x07);
+      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)((digit[3] & (uint8_t)0x06) >> (uint8_t)0x01);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xC7;
+      LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)(digit[4] << (uint8_t)0x03);
+
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x7F;
+      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFC;
+      LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)((digit[5] & (uint8_t)0x01) << (uint8_t)0x07);
+      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)((digit[5] & (uint8_t)0x06) >> (uint8_t)0x01);
+      break;
+
+      /* Position 6 on LCD (Digit7)*/
+    case 6:
+
+      /* Enable the write access on the LCD RAM First banck */
+      LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+
+      /*Write Digit 0 on COM0 */
+      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x7F;
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
+      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)((digit[0] & (uint8_t)0x03) << (uint8_t)0x06);
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[0] & (uint8_t)0x04) >> (uint8_t)0x02);
+
+      /*Write Digit 1 on COM1 */
+      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE7;
+      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[1] << (uint8_t)0x02);
+
+      /* Enable the write access on the LCD RAM second banck */
+      LCD->CR4 |= LCD_CR4_PAGECOM;
+      /*Write Digit 2 on COM4 */
+      LCD->RAM[LCD_RAMRegister_0] &= (uint8_t)0x3F;
+      LCD->RAM[LCD_RAMRegister_1] &= (uint8_t)0xFE;
+      LCD->RAM[LCD_RAMRegister_0] |= (uint8_t)((digit[2] & (uint8_t)0x03) << (uint8_t)0x06);
+      LCD->RAM[LCD_RAMRegister_1] |= (uint8_t)((digit[2] & (uint8_t)0x04) >> (uint8_t)0x02);
+
+      /*Write Digit 3 on COM5 */
+      LCD->RAM[LCD_RAMRegister_4] &= (uint8_t)0xE3;
+      LCD->RAM[LCD_RAMRegister_4] |= (uint8_t)(digit[3] << (uint8_t)0x02);
+
+      /*Write Digit 4 on COM6 */
+      LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0x3F;
+      LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFE;
+      LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)((digit[4] & (uint8_t)0x03) << (uint8_t)0x06);
+      LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)((digit[4] & (uint8_t)0x04) >> (uint8_t)0x02);
+
+      /*Write Digit 5 on COM7 */
+      LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xE3;
+      LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)(digit[5] << (uint8_t)0x02);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  * @brief  Converts an ascii char to the a LCD digit (previous coding).
+  * @param  c: a char to display.
+  * @param  Point: a point to add in front of a char
+  *         This parameter can be: POINT_OFF or POINT_ON
+  * @param  DoublePoint: flag indicating if Double Point has to be added in front
+  *         of the displayed character.
+  *         This parameter can be: DOUBLEPOINT_ON or DOUBLEPOINT_OFF.
+  * @retval None
+  */
+static void Convert(uint8_t* c, Point_Typedef Point, DoublePoint_Typedef DoublePoint)
+{
+  uint32_t ch = 0 , tmp = 0;
+  uint16_t i;
+
+  /* The character c is a letter in upper case*/
+  if ((*c < (uint8_t)0x5B)&(*c > (uint8_t)0x40))
+  {
+    ch = LetterMap[*c-(uint8_t)0x41];
+  }
+  /* The character c is a number*/
+  if ((*c < (uint8_t)0x3A)&(*c > (uint8_t)0x2F))
+  {
+    ch = NumberMap[*c-(uint8_t)0x30];
+  }
+  /* The character c is a space character */
+  if (*c == (uint8_t)0x20)
+  {
+    ch = (uint8_t)0x00;
+  }
+  /* Set the Q pixel in the character that can be displayed if the point is on */
+  if (Point == POINT_ON)
+  {
+    ch |= (uint32_t)0x400000;
+  }
+
+  /* Set the P pixel in the character that can be displayed if the double point is on */
+  if (DoublePoint == DOUBLEPOINT_ON)
+  {
+    ch |= (uint8_t)0x000040;
+  }
+
+  for (i = 0;i < 6; i++)
+  {
+    tmp = ch & mask[i];
+    digit[i] = (uint8_t)(tmp >> (uint8_t)shift[i]);
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
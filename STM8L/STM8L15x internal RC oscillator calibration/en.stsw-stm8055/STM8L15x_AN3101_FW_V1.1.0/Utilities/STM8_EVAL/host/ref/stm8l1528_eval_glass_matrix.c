@@ -0,0 +1,2867 @@
+/**
+  ******************************************************************************
+  * @file    stm8l1528_eval_glass_matrix.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Reference of the matrix pixel functions of the 1528 glass LCD
+  *          driver: LCD_GLASS_WriteMatrixPixel() and
+  *          LCD_GLASS_ClearMatrixPixel() as released with the V2.1.0 driver,
+  *          one switch case per pixel.
+  *
+  *          @note This file is not a driver source. It is included by
+  *                glass_matrix_test.c, which compares it with the driver
+  *                built on MatrixPixelMap[], and it is the input of
+  *                tools/matrix_pixel_map.py, which generates MatrixPixelMap[].
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/**
+  * @brief Set Matrix Pixel on.
+  * @param PixelRow: Specify Matrix Row.
+  * @param PixelColumn: Specify Matrix Column.
+  * @retval None
+  */
+void LCD_GLASS_WriteMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn)
+{
+  switch (PixelRow)
+  {
+    case PIXELROW_1:
+
+      switch (PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 9 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 10 */
+          LCD->RAM[LCD_RAMRegister_12] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 11 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 12 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 13 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 14 */
+          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 15 */
+          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 16 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 17 */
+          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 18 */
+          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_11] |= (uint8_t)0x04;
+          break;
+
+        default:
+          break;
+
+      }
+      break;
+    case PIXELROW_2:
+
+      switch ( PixelColumn)
+      {
+        case  PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x02;
+          break;
+
+        case  PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x40;
+          break;
+
+        case  PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x20;
+          break;
+
+        case  PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row =  2 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x10;
+          break;
+
+        case  PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x02;
+          break;
+
+        case  PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x01;
+          break;
+
+        case  PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x80;
+          break;
+
+        case  PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x10;
+          break;
+
+        case  PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x08;
+          break;
+
+        case  PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x04;
+          break;
+
+        case  PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 11 */
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 12 */
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x02;
+          break;
+
+        case  PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x01;
+          break;
+
+        case  PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x20;
+          break;
+
+        case  PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 15 */
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x10;
+          break;
+
+        case  PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 16*/
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x08;
+          break;
+
+        case  PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 17*/
+          LCD->RAM[LCD_RAMRegister_8] |= (uint8_t)0x01;
+          break;
+
+        case  PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 18 */
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x80;
+          break;
+
+        case  PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_7] |= (uint8_t)0x40;
+          break;
+
+        default:
+          break;
+      }
+      break;
+
+    case PIXELROW_3:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 11*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 12*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 15*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 16*/
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 17*/
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 18*/
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_4:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+
+      }
+      break;
+    case PIXELROW_5:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 11*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 12*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 15*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 16*/
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 17*/
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 18*/
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_6:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 6*/
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 11*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 12*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 15*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 16*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 17*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x02;
+          break;
+
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6 , Column = 18*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1 , Column = 19*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_7:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_13] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 11*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 12*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 15*/
+          LCD->RAM[LCD_RAMRegister_20] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 16*/
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 17*/
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 18*/
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_21] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_8:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_9] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_10] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 11*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 12*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 15*/
+          LCD->RAM[LCD_RAMRegister_18] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 16 */
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 17 */
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 18*/
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_19] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_9:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 2 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 3 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 4 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 5 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 6 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 7 */
+          LCD->RAM[LCD_RAMRegister_6] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 8 */
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 9*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 10*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 11*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 12*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 13*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 14*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 15*/
+          LCD->RAM[LCD_RAMRegister_16] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 16*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 17*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 18*/
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9 , Column = 19 */
+          LCD->RAM[LCD_RAMRegister_17] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_10:
+      switch ( PixelColumn)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10 , Column = 1 */
+          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_2] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_3] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 9*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 10*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 11*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x08;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 12*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x10;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 13*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x20;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 14*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x40;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 15*/
+          LCD->RAM[LCD_RAMRegister_14] |= (uint8_t)0x80;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x01;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 17*/
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x02;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 18*/
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x04;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_15] |= (uint8_t)0x08;
+          break;
+
+        default:
+          break;
+      }
+      break;
+  }
+}
+
+/**
+  * @brief Set Matrix Pixel off.
+  * @param PixelRow: Specify Matrix Row.
+  * @param PixelColumn: Specify Matrix Column.
+  * @retval None
+  */
+void LCD_GLASS_ClearMatrixPixel(PixelRow_TypeDef PIXELROW, PixelColumn_TypeDef PIXELCOLUMN)
+{
+  switch (PIXELROW)
+  {
+    case PIXELROW_1:
+      switch (PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_12] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 15*/
+          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 1, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_11] &= (uint8_t)0xFB;
+          break;
+
+        default:
+          break;
+
+      }
+      break;
+    case PIXELROW_2:
+      switch ( PIXELCOLUMN)
+      {
+        case  PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFD;
+          break;
+
+        case  PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xBF;
+          break;
+
+        case  PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xDF;
+          break;
+
+        case  PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xEF;
+          break;
+
+        case  PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFD;
+          break;
+
+        case  PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFE;
+          break;
+
+        case  PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0x7F;
+          break;
+
+        case  PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xEF;
+          break;
+
+        case  PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xF7;
+          break;
+
+        case  PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xFB;
+          break;
+
+        case  PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xFD;
+          break;
+
+        case  PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xFE;
+          break;
+
+        case  PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xDF;
+          break;
+
+        case  PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xEF;
+          break;
+
+        case  PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xF7;
+          break;
+
+        case  PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_8] &= (uint8_t)0xFE;
+          break;
+
+        case  PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0x7F;
+          break;
+
+        case  PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 2, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_7] &= (uint8_t)0xBF;
+          break;
+
+        default:
+          break;
+      }
+      break;
+
+    case PIXELROW_3:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 3, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_4:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 4, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+
+      }
+      break;
+    case PIXELROW_5:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 5, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_6:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row =6, Column = 2*/
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFE;
+          break;
+
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFD;
+          break;
+
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM First banck */
+          LCD->CR4 &= (uint8_t)~LCD_CR4_PAGECOM;
+          /* Position : Row = 6, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_7:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_13] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_20] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 7, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_21] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_8:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_9] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_10] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_18] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 8, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_19] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_9:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_6] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_16] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 9, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_17] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+    case PIXELROW_10:
+      switch ( PIXELCOLUMN)
+      {
+        case PIXELCOLUMN_1:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 1 */
+          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_2:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 2 */
+          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_3:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 3 */
+          LCD->RAM[LCD_RAMRegister_2] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_4:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 4 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_5:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 5 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_6:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 6 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_7:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 7 */
+          LCD->RAM[LCD_RAMRegister_3] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_8:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 8 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_9:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 9 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_10:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 10 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_11:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 11 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xF7;
+          break;
+
+        case PIXELCOLUMN_12:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 12 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xEF;
+          break;
+
+        case PIXELCOLUMN_13:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 13 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xDF;
+          break;
+
+        case PIXELCOLUMN_14:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 14 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0xBF;
+          break;
+
+        case PIXELCOLUMN_15:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 15 */
+          LCD->RAM[LCD_RAMRegister_14] &= (uint8_t)0x7F;
+          break;
+
+        case PIXELCOLUMN_16:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 16 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFE;
+          break;
+
+        case PIXELCOLUMN_17:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 17 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFD;
+          break;
+
+        case PIXELCOLUMN_18:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 18 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xFB;
+          break;
+
+        case PIXELCOLUMN_19:
+          /* Enable the write access on the LCD RAM second banck */
+          LCD->CR4 |= LCD_CR4_PAGECOM;
+          /* Position : Row = 10, Column = 19 */
+          LCD->RAM[LCD_RAMRegister_15] &= (uint8_t)0xF7;
+          break;
+
+        default:
+          break;
+      }
+      break;
+  }
+
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
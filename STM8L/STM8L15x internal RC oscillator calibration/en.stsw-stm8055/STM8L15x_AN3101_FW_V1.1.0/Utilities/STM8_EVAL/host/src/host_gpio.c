@@ -0,0 +1,249 @@
+/**
+  ******************************************************************************
+  * @file    host_gpio.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of the GPIO ports, built instead of stm8l15x_gpio.c.
+  *
+  *          @note The registers are the ones of HostIO[], written as the
+  *                library does. The output changes are passed to the SPI
+  *                buses, which select their devices by GPIO output pins
+  *                driven low. The input pins read the levels set by
+  *                HOST_GPIOSetInput(), kept in the IDR register.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Deinitializes the GPIOx peripheral registers to their default reset values.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @retval None
+  */
+void GPIO_DeInit(GPIO_TypeDef* GPIOx)
+{
+  GPIOx->CR2 = GPIO_CR2_RESET_VALUE;
+  GPIOx->ODR = GPIO_ODR_RESET_VALUE;
+  GPIOx->DDR = GPIO_DDR_RESET_VALUE;
+  GPIOx->CR1 = GPIO_CR1_RESET_VALUE;
+
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Initializes the GPIOx according to the specified parameters.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: This parameter contains the pin number.
+  * @param  GPIO_Mode: This parameter can be a value of the GPIO_Mode_TypeDef.
+  * @retval None
+  */
+void GPIO_Init(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin, GPIO_Mode_TypeDef GPIO_Mode)
+{
+  GPIOx->CR2 &= (uint8_t)(~(GPIO_Pin));
+
+  if ((((uint8_t)(GPIO_Mode)) & (uint8_t)0x80) != (uint8_t)0x00) /* Output mode */
+  {
+    if ((((uint8_t)(GPIO_Mode)) & (uint8_t)0x10) != (uint8_t)0x00) /* High level */
+    {
+      GPIOx->ODR |= GPIO_Pin;
+    }
+    else /* Low level */
+    {
+      GPIOx->ODR &= (uint8_t)(~(GPIO_Pin));
+    }
+    GPIOx->DDR |= GPIO_Pin;
+  }
+  else /* Input mode */
+  {
+    GPIOx->DDR &= (uint8_t)(~(GPIO_Pin));
+  }
+
+  if ((((uint8_t)(GPIO_Mode)) & (uint8_t)0x40) != (uint8_t)0x00) /* Pull-Up or Push-Pull */
+  {
+    GPIOx->CR1 |= GPIO_Pin;
+  }
+  else /* Float or Open-Drain */
+  {
+    GPIOx->CR1 &= (uint8_t)(~(GPIO_Pin));
+  }
+
+  if ((((uint8_t)(GPIO_Mode)) & (uint8_t)0x20) != (uint8_t)0x00) /* Interrupt or Slow slope */
+  {
+    GPIOx->CR2 |= GPIO_Pin;
+  }
+  else /* No external interrupt or No slope control */
+  {
+    GPIOx->CR2 &= (uint8_t)(~(GPIO_Pin));
+  }
+
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Writes data to the specified GPIO data port.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_PortVal: Specifies the value to be written to the port output.
+  * @retval None
+  */
+void GPIO_Write(GPIO_TypeDef* GPIOx, uint8_t GPIO_PortVal)
+{
+  GPIOx->ODR = GPIO_PortVal;
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Sets or clears the selected data port bit.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the port bit to be written.
+  * @param  GPIO_BitVal: specifies the value to be written to the selected bit.
+  * @retval None
+  */
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, GPIO_Pin_TypeDef GPIO_Pin, BitAction GPIO_BitVal)
+{
+  if (GPIO_BitVal != RESET)
+  {
+    GPIO_SetBits(GPIOx, (uint8_t)GPIO_Pin);
+  }
+  else
+  {
+    GPIO_ResetBits(GPIOx, (uint8_t)GPIO_Pin);
+  }
+}
+
+/**
+  * @brief  Writes high level to the specified GPIO pins.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the pins to be turned high.
+  * @retval None
+  */
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin)
+{
+  GPIOx->ODR |= GPIO_Pin;
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Writes low level to the specified GPIO pins.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the pins to be turned low.
+  * @retval None
+  */
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin)
+{
+  GPIOx->ODR &= (uint8_t)(~GPIO_Pin);
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Toggles the specified GPIO pins.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the pins to be toggled.
+  * @retval None
+  */
+void GPIO_ToggleBits(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin)
+{
+  GPIOx->ODR ^= GPIO_Pin;
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Reads the specified GPIO input data port: the output pins read
+  *         their output level.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @retval GPIO input data port value.
+  */
+uint8_t GPIO_ReadInputData(GPIO_TypeDef* GPIOx)
+{
+  return (uint8_t)((GPIOx->ODR & GPIOx->DDR) | (GPIOx->IDR & (uint8_t)(~GPIOx->DDR)));
+}
+
+/**
+  * @brief  Reads the specified GPIO output data port.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @retval GPIO output data port value.
+  */
+uint8_t GPIO_ReadOutputData(GPIO_TypeDef* GPIOx)
+{
+  return ((uint8_t)GPIOx->ODR);
+}
+
+/**
+  * @brief  Reads the specified GPIO input data pin.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: This parameter contains the pin number.
+  * @retval GPIO input pin status.
+  */
+BitStatus GPIO_ReadInputDataBit(GPIO_TypeDef* GPIOx, GPIO_Pin_TypeDef GPIO_Pin)
+{
+  return ((BitStatus)(GPIO_ReadInputData(GPIOx) & (uint8_t)GPIO_Pin));
+}
+
+/**
+  * @brief  Reads the specified GPIO Output data pin.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the pin number
+  * @retval BitStatus : GPIO output pin status.
+  */
+BitStatus GPIO_ReadOutputDataBit(GPIO_TypeDef* GPIOx, GPIO_Pin_TypeDef GPIO_Pin)
+{
+  return ((BitStatus)(GPIOx->ODR & (uint8_t)GPIO_Pin));
+}
+
+/**
+  * @brief  Configures the external pull-up on GPIOx pins.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the pin number
+  * @param  NewState: The new state of the pull up pin.
+  * @retval None
+  */
+void GPIO_ExternalPullUpConfig(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin, FunctionalState NewState)
+{
+  if (NewState != DISABLE) /* External Pull-Up Set*/
+  {
+    GPIOx->CR1 |= GPIO_Pin;
+  }
+  else /* External Pull-Up Reset*/
+  {
+    GPIOx->CR1 &= (uint8_t)(~(GPIO_Pin));
+  }
+}
+
+/**
+  * @brief  Sets the level of GPIO input pins.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @param  GPIO_Pin: Specifies the pins.
+  * @param  Level: SET for high, RESET for low.
+  * @retval None
+  */
+void HOST_GPIOSetInput(GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin, BitStatus Level)
+{
+  if (Level != RESET)
+  {
+    GPIOx->IDR |= GPIO_Pin;
+  }
+  else
+  {
+    GPIOx->IDR &= (uint8_t)(~GPIO_Pin);
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,991 @@
+/**
+  ******************************************************************************
+  * @file    host_i2c.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of the I2C bus, built instead of stm8l15x_i2c.c.
+  *
+  *          @note The registers are the ones of HostIO[], written as the
+  *                library does. The model runs the I2C1 master as the
+  *                reference manual describes it, with the devices attached
+  *                by HOST_I2CAttach():
+  *                - START and STOP conditions are sent when requested in
+  *                  CR2, after the byte in progress; the START sets SB, and
+  *                  the slave address written in DR is sent to the devices.
+  *                - ADDR is set when a device acknowledges the address, AF
+  *                  otherwise; ADDR is cleared by the read of SR3.
+  *                - In transmitter mode, DR is moved to the shift register
+  *                  (TXE set) and sent to the device; BTF is set when a byte
+  *                  is sent and DR is empty.
+  *                - In receiver mode, the bytes are received in DR (RXNE),
+  *                  then in the shift register (BTF), where the bus waits.
+  *                  Each byte is acknowledged as set by ACK (the first one
+  *                  always when POS is set).
+  *                Each bit advances the simulated time by the SCL period set
+  *                by I2C_Init() (CCR), START and STOP conditions counting as
+  *                one bit.
+  *
+  *          @note The bus runs at once after each library call, unless it
+  *                waits for the CPU: the interrupt routine attached by
+  *                HOST_I2CAttachIRQ() is then called while an enabled event
+  *                (ITEVTEN, ITBUFEN) or error (ITERREN) is pending. The SR2
+  *                error flags are cleared by writing 0 (rc_w0): the ones
+  *                written to 1 keep their value.
+  *
+  *          @note A STOP sent after a byte received with ACK, or a DR write
+  *                out of the address or transmitter phases, are counted as
+  *                errors of the master.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Device attached to the I2C bus
+  */
+typedef struct
+{
+  uint8_t Address;                      /*!< Slave address, 8-bit form */
+  const HOST_I2CDevice_TypeDef* Device; /*!< Device model */
+}I2C_Slave_TypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define OAR1_ADD0_Set           ((uint8_t)0x01)
+#define OAR1_ADD0_Reset         ((uint8_t)0xFE)
+
+/* Phases of the bus */
+#define I2C_PHASE_IDLE          ((uint8_t)0x00)  /*!< Bus free */
+#define I2C_PHASE_ADDRESS       ((uint8_t)0x01)  /*!< START sent, slave address awaited */
+#define I2C_PHASE_WRITE         ((uint8_t)0x02)  /*!< Master transmitter */
+#define I2C_PHASE_READ          ((uint8_t)0x03)  /*!< Master receiver */
+#define I2C_PHASE_HOLD          ((uint8_t)0x04)  /*!< Not acknowledged: STOP or START awaited */
+
+/* Flags of SR1 and SR2 raising the interrupts */
+#define I2C_SR1_EVENTS          ((uint8_t)(I2C_SR1_SB | I2C_SR1_ADDR | I2C_SR1_BTF | \
+                                           I2C_SR1_ADD10 | I2C_SR1_STOPF))
+#define I2C_SR1_BUFFER          ((uint8_t)(I2C_SR1_TXE | I2C_SR1_RXNE))
+#define I2C_SR2_ERRORS          ((uint8_t)(I2C_SR2_SMBALERT | I2C_SR2_TIMEOUT | \
+                                           I2C_SR2_PECERR | I2C_SR2_OVR | I2C_SR2_AF | \
+                                           I2C_SR2_ARLO | I2C_SR2_BERR))
+
+/* Bits of a byte and its acknowledge */
+#define I2C_BYTE_BITS           ((uint8_t)9)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static I2C_Slave_TypeDef I2CSlave[HOST_I2C_DEVICE_NB];
+static uint8_t I2CSlaveNb = 0;
+static void (*I2CHandler)(void) = 0;
+static HOST_I2CStatistics_TypeDef I2CStatistics;
+
+/* Bus state */
+static uint8_t I2CPhase = I2C_PHASE_IDLE;
+static const HOST_I2CDevice_TypeDef* I2CDevice = 0;  /* Device addressed */
+static FlagStatus I2CAddressWritten = RESET;         /* Slave address in DR */
+static FlagStatus I2CShiftFull = RESET;              /* Byte in the shift register */
+static uint8_t I2CShift = 0;
+static uint32_t I2CReadNb = 0;                       /* Bytes received since the address */
+static FlagStatus I2CLastAck = SET;                  /* Acknowledge of the last byte received */
+static uint8_t I2CSR2 = 0;                           /* Error flags set by the model */
+static FlagStatus I2CRunning = RESET;                /* I2C_Run() in progress */
+
+/* Private function prototypes -----------------------------------------------*/
+static void I2C_Check(I2C_TypeDef* I2Cx);
+static void I2C_Reset(void);
+static void I2C_Sync(void);
+static void I2C_Run(void);
+static FlagStatus I2C_Pending(void);
+static FlagStatus I2C_Step(void);
+static FlagStatus I2C_StepAddress(void);
+static FlagStatus I2C_StepWrite(void);
+static FlagStatus I2C_StepRead(void);
+static FlagStatus I2C_End(void);
+static void I2C_SendBits(uint8_t BitNb);
+static void I2C_Error(uint8_t Flag);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Deinitializes the I2C peripheral registers to their default reset values.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @retval None
+  */
+void I2C_DeInit(I2C_TypeDef* I2Cx)
+{
+  I2C_Check(I2Cx);
+
+  I2Cx->CR1 = I2C_CR1_RESET_VALUE;
+  I2Cx->CR2 = I2C_CR2_RESET_VALUE;
+  I2Cx->FREQR = I2C_FREQR_RESET_VALUE;
+  I2Cx->OARL = I2C_OARL_RESET_VALUE;
+  I2Cx->OARH = I2C_OARH_RESET_VALUE;
+  I2Cx->OAR2 = I2C_OAR2_RESET_VALUE;
+  I2Cx->ITR = I2C_ITR_RESET_VALUE;
+  I2Cx->CCRL = I2C_CCRL_RESET_VALUE;
+  I2Cx->CCRH = I2C_CCRH_RESET_VALUE;
+  I2Cx->TRISER = I2C_TRISER_RESET_VALUE;
+
+  I2C_Reset();
+}
+
+/**
+  * @brief  Initializes the I2C according to the specified parameters in standard
+  *         or fast mode.
+  * @note   The input clock is the system clock of the models, HOST_SYSCLK.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  OutputClockFrequency : Specifies the output clock frequency in Hz.
+  * @param  OwnAddress : Specifies the own address.
+  * @param  I2C_Mode : Specifies the addressing mode to apply.
+  * @param  I2C_DutyCycle : Specifies the duty cycle to apply in fast mode.
+  * @param  I2C_Ack : Specifies the acknowledge mode to apply.
+  * @param  I2C_AcknowledgedAddress : Specifies the acknowledge address to apply.
+  * @retval None
+  */
+void I2C_Init(I2C_TypeDef* I2Cx, uint32_t OutputClockFrequency, uint16_t OwnAddress,
+              I2C_Mode_TypeDef I2C_Mode, I2C_DutyCycle_TypeDef I2C_DutyCycle,
+              I2C_Ack_TypeDef I2C_Ack, I2C_AcknowledgedAddress_TypeDef I2C_AcknowledgedAddress)
+{
+  uint32_t result = 0x0004;
+  uint16_t tmpval = 0;
+  uint8_t tmpccrh = 0;
+  uint8_t input_clock = 0;
+
+  I2C_Check(I2Cx);
+
+  /* Get system clock frequency */
+  input_clock = (uint8_t) (HOST_SYSCLK / 1000000);
+
+  /*------------------------- I2C FREQ Configuration ------------------------*/
+  /* Clear frequency bits */
+  I2Cx->FREQR &= (uint8_t)(~I2C_FREQR_FREQ);
+  /* Write new value */
+  I2Cx->FREQR |= input_clock;
+
+  /*--------------------------- I2C CCR Configuration ------------------------*/
+  /* Disable I2C to configure TRISER */
+  I2Cx->CR1 &= (uint8_t)(~I2C_CR1_PE);
+
+  /* Clear CCRH & CCRL */
+  I2Cx->CCRH &= (uint8_t)(~(I2C_CCRH_FS | I2C_CCRH_DUTY | I2C_CCRH_CCR));
+  I2Cx->CCRL &= (uint8_t)(~I2C_CCRL_CCR);
+
+  /* Detect Fast or Standard mode depending on the Output clock frequency selected */
+  if (OutputClockFrequency > I2C_MAX_STANDARD_FREQ) /* FAST MODE */
+  {
+    /* Set F/S bit for fast mode */
+    tmpccrh = I2C_CCRH_FS;
+
+    if (I2C_DutyCycle == I2C_DutyCycle_2)
+    {
+      /* Fast mode speed calculate: Tlow/Thigh = 2 */
+      result = (uint32_t) ((input_clock * 1000000) / (OutputClockFrequency * 3));
+    }
+    else /* I2C_DUTYCYCLE_16_9 */
+    {
+      /* Fast mode speed calculate: Tlow/Thigh = 16/9 */
+      result = (uint32_t) ((input_clock * 1000000) / (OutputClockFrequency * 25));
+      /* Set DUTY bit */
+      tmpccrh |= I2C_CCRH_DUTY;
+    }
+
+    /* Verify and correct CCR value if below minimum value */
+    if (result < (uint16_t)0x01)
+    {
+      /* Set the minimum allowed value */
+      result = (uint16_t)0x0001;
+    }
+
+    /* Set Maximum Rise Time: 300ns max in Fast Mode */
+    tmpval = ((input_clock * 3) / 10) + 1;
+    I2Cx->TRISER = (uint8_t)tmpval;
+  }
+  else /* STANDARD MODE */
+  {
+    /* Calculate standard mode speed */
+    result = (uint16_t)((input_clock * 1000000) / (OutputClockFrequency << (uint8_t)1));
+
+    /* Verify and correct CCR value if below minimum value */
+    if (result < (uint16_t)0x0004)
+    {
+      /* Set the minimum allowed value */
+      result = (uint16_t)0x0004;
+    }
+
+    /* Set Maximum Rise Time: 1000ns max in Standard Mode */
+    I2Cx->TRISER = (uint8_t)((uint8_t)input_clock + (uint8_t)1);
+  }
+
+  /* Write CCR with new calculated value */
+  I2Cx->CCRL = (uint8_t)result;
+  I2Cx->CCRH = (uint8_t)((uint8_t)((uint8_t)(result >> 8) & I2C_CCRH_CCR) | tmpccrh);
+
+  /* Enable I2C and  Cofigure its mode*/
+  I2Cx->CR1 |= (uint8_t)(I2C_CR1_PE | I2C_Mode);
+
+  /* Configure I2C acknowledgement */
+  I2Cx->CR2 |= (uint8_t)I2C_Ack;
+
+  /*--------------------------- I2C OAR Configuration ------------------------*/
+  I2Cx->OARL = (uint8_t)(OwnAddress);
+  I2Cx->OARH = (uint8_t)((uint8_t)(I2C_AcknowledgedAddress | I2C_OARH_ADDCONF ) | \
+                         (uint8_t)((uint16_t)( (uint16_t)OwnAddress &  (uint16_t)0x0300) >> 7));
+}
+
+/**
+  * @brief  Enables or disables the I2C peripheral.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  NewState : Indicate the new I2C peripheral state.
+  * @retval None
+  */
+void I2C_Cmd(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  I2C_Check(I2Cx);
+
+  if (NewState != DISABLE)
+  {
+    /* Enable I2C peripheral */
+    I2Cx->CR1 |= I2C_CR1_PE;
+  }
+  else /* NewState == DISABLE */
+  {
+    /* Disable I2C peripheral: the bus is released */
+    I2Cx->CR1 &= (uint8_t)(~I2C_CR1_PE);
+    I2C_Reset();
+  }
+}
+
+/**
+  * @brief  Enables or disables the specified I2C interrupt.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  I2C_IT : Name of the interrupt to enable or disable.
+  * @param  NewState : State of the interrupt.
+  * @retval None
+  */
+void I2C_ITConfig(I2C_TypeDef* I2Cx, I2C_IT_TypeDef I2C_IT, FunctionalState NewState)
+{
+  I2C_Check(I2Cx);
+
+  if (NewState != DISABLE)
+  {
+    /* Enable the selected I2C interrupts */
+    I2Cx->ITR |= (uint8_t)I2C_IT;
+  }
+  else /* NewState == DISABLE */
+  {
+    /* Disable the selected I2C interrupts */
+    I2Cx->ITR &= (uint8_t)(~(uint8_t)I2C_IT);
+  }
+
+  I2C_Run();
+}
+
+/**
+  * @brief  Generates I2C communication START condition.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  NewState : Enable or disable the start condition.
+  * @retval None
+  */
+void I2C_GenerateSTART(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  I2C_Check(I2Cx);
+
+  if (NewState != DISABLE)
+  {
+    /* Generate a START condition */
+    I2Cx->CR2 |= I2C_CR2_START;
+  }
+  else /* NewState == DISABLE */
+  {
+    /* Disable the START condition generation */
+    I2Cx->CR2 &= (uint8_t)(~I2C_CR2_START);
+  }
+
+  I2C_Run();
+}
+
+/**
+  * @brief  Generates I2C communication STOP condition.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  NewState : Enable or disable the stop condition.
+  * @retval None
+  */
+void I2C_GenerateSTOP(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  I2C_Check(I2Cx);
+
+  if (NewState != DISABLE)
+  {
+    /* Generate a STOP condition */
+    I2Cx->CR2 |= I2C_CR2_STOP;
+  }
+  else /* NewState == DISABLE */
+  {
+    /* Disable the STOP condition generation */
+    I2Cx->CR2 &= (uint8_t)(~I2C_CR2_STOP);
+  }
+
+  I2C_Run();
+}
+
+/**
+  * @brief  Enables or disables the specified I2C acknowledge feature.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  NewState : Indicate the new I2C Acknowledge state.
+  * @retval None
+  */
+void I2C_AcknowledgeConfig(I2C_TypeDef* I2Cx, FunctionalState NewState)
+{
+  I2C_Check(I2Cx);
+
+  if (NewState != DISABLE)
+  {
+    /* Enable the acknowledgement */
+    I2Cx->CR2 |= I2C_CR2_ACK;
+  }
+  else
+  {
+    /* Disable the acknowledgement */
+    I2Cx->CR2 &= (uint8_t)(~I2C_CR2_ACK);
+  }
+
+  I2C_Run();
+}
+
+/**
+  * @brief  Selects the specified I2C Ack position.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  I2C_AckPosition: specifies the Ack position.
+  * @retval None
+  */
+void I2C_AckPositionConfig(I2C_TypeDef* I2Cx, I2C_AckPosition_TypeDef I2C_AckPosition)
+{
+  I2C_Check(I2Cx);
+
+  /* Clear the I2C Ack position */
+  I2Cx->CR2 &= (uint8_t)(~I2C_CR2_POS);
+  /* Configure the specified I2C Ack position*/
+  I2Cx->CR2 |= (uint8_t)I2C_AckPosition;
+
+  I2C_Run();
+}
+
+/**
+  * @brief  Returns the most recent received data.
+  * @note   The byte waiting in the shift register, if any, is moved to DR.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @retval The value of the received byte data.
+  */
+uint8_t I2C_ReceiveData(I2C_TypeDef* I2Cx)
+{
+  uint8_t data = 0;
+
+  I2C_Check(I2Cx);
+
+  data = I2Cx->DR;
+
+  I2Cx->SR1 &= (uint8_t)(~I2C_SR1_BTF);
+  if (I2CShiftFull != RESET)
+  {
+    I2Cx->DR = I2CShift;
+    I2CShiftFull = RESET;
+  }
+  else
+  {
+    I2Cx->SR1 &= (uint8_t)(~I2C_SR1_RXNE);
+  }
+
+  I2C_Run();
+
+  return data;
+}
+
+/**
+  * @brief  Transmits the 7-bit address (to select the) slave device.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  Address : Specifies the slave address which will be transmitted.
+  * @param  I2C_Direction : Specifies whether the I2C device will be a Transmitter
+  *         or a Receiver.
+  * @retval None
+  */
+void I2C_Send7bitAddress(I2C_TypeDef* I2Cx, uint8_t Address, I2C_Direction_TypeDef I2C_Direction)
+{
+  /* Test on the direction to set/reset the read/write bit */
+  if (I2C_Direction != I2C_Direction_Transmitter)
+  {
+    /* Set the address bit0 for read */
+    Address |= OAR1_ADD0_Set;
+  }
+  else
+  {
+    /* Reset the address bit0 for write */
+    Address &= OAR1_ADD0_Reset;
+  }
+  /* Send the address */
+  I2C_SendData(I2Cx, Address);
+}
+
+/**
+  * @brief  Send a byte by writing in the DR register.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  Data : Byte to be sent.
+  * @retval None
+  */
+void I2C_SendData(I2C_TypeDef* I2Cx, uint8_t Data)
+{
+  I2C_Check(I2Cx);
+
+  /* Write in the DR register the data to be sent */
+  I2Cx->DR = Data;
+
+  if ((I2CPhase == I2C_PHASE_ADDRESS) && ((I2Cx->SR1 & I2C_SR1_SB) != 0))
+  {
+    /* Slave address, SB being cleared */
+    I2Cx->SR1 &= (uint8_t)(~I2C_SR1_SB);
+    I2CAddressWritten = SET;
+  }
+  else if ((I2CPhase == I2C_PHASE_WRITE) && ((I2Cx->SR1 & I2C_SR1_ADDR) == 0))
+  {
+    I2Cx->SR1 &= (uint8_t)(~(I2C_SR1_TXE | I2C_SR1_BTF));
+  }
+  else
+  {
+    I2CStatistics.ErrorNb++;
+  }
+
+  I2C_Run();
+}
+
+/**
+  * @brief  Reads the specified I2C register and returns its value.
+  * @note   The read of SR3 clears ADDR.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  I2C_Register: specifies the register to read.
+  * @retval The value of the read register.
+  */
+uint8_t I2C_ReadRegister(I2C_TypeDef* I2Cx, I2C_Register_TypeDef I2C_Register)
+{
+  uint8_t value = 0;
+
+  I2C_Check(I2Cx);
+  I2C_Sync();
+
+  /* Return the selected register value */
+  value = *((__IO uint8_t*)I2Cx + I2C_Register);
+
+  if ((I2C_Register == I2C_Register_SR3) && ((I2Cx->SR1 & I2C_SR1_ADDR) != 0))
+  {
+    I2Cx->SR1 &= (uint8_t)(~I2C_SR1_ADDR);
+    if (I2CPhase == I2C_PHASE_WRITE)
+    {
+      /* EV8_1: data register empty */
+      I2Cx->SR1 |= I2C_SR1_TXE;
+    }
+  }
+
+  I2C_Run();
+
+  return value;
+}
+
+/**
+  * @brief  Attaches a device to the I2C bus.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  Address: Slave address of the device, 8-bit form (bit 0 ignored).
+  * @param  Device: Device model.
+  * @retval None
+  */
+void HOST_I2CAttach(I2C_TypeDef* I2Cx, uint8_t Address, const HOST_I2CDevice_TypeDef* Device)
+{
+  I2C_Check(I2Cx);
+
+  if (I2CSlaveNb >= HOST_I2C_DEVICE_NB)
+  {
+    HOST_Fatal("I2C: more than %u devices", (unsigned)HOST_I2C_DEVICE_NB);
+  }
+
+  I2CSlave[I2CSlaveNb].Address = (uint8_t)(Address & OAR1_ADD0_Reset);
+  I2CSlave[I2CSlaveNb].Device = Device;
+  I2CSlaveNb++;
+}
+
+/**
+  * @brief  Attaches the interrupt routine of the I2C, called while an
+  *         enabled event or error is pending.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @param  Handler: Interrupt routine.
+  * @retval None
+  */
+void HOST_I2CAttachIRQ(I2C_TypeDef* I2Cx, void (*Handler)(void))
+{
+  I2C_Check(I2Cx);
+
+  I2CHandler = Handler;
+}
+
+/**
+  * @brief  Gives the bus use counted since the start.
+  * @param  Statistics: pointer to the counters.
+  * @retval None
+  */
+void HOST_I2CGetStatistics(HOST_I2CStatistics_TypeDef* Statistics)
+{
+  *Statistics = I2CStatistics;
+}
+
+/**
+  * @brief  Gives the SCL period set by I2C_Init().
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @retval Bit time, in ns
+  */
+HOST_Time_TypeDef HOST_I2CBitTime(I2C_TypeDef* I2Cx)
+{
+  uint32_t ccr = 0, periods = 0;
+  uint8_t frequency = 0;
+
+  I2C_Check(I2Cx);
+
+  ccr = (uint32_t)(((I2Cx->CCRH & I2C_CCRH_CCR) << 8) | I2Cx->CCRL);
+  frequency = (uint8_t)(I2Cx->FREQR & I2C_FREQR_FREQ);
+
+  if (frequency == 0)
+  {
+    HOST_Fatal("I2C: used before I2C_Init()");
+  }
+
+  if ((I2Cx->CCRH & I2C_CCRH_FS) == 0)
+  {
+    /* Standard mode: Thigh = Tlow = CCR */
+    periods = 2 * ccr;
+  }
+  else if ((I2Cx->CCRH & I2C_CCRH_DUTY) == 0)
+  {
+    /* Fast mode, Tlow/Thigh = 2 */
+    periods = 3 * ccr;
+  }
+  else
+  {
+    /* Fast mode, Tlow/Thigh = 16/9 */
+    periods = 25 * ccr;
+  }
+
+  return (HOST_Time_TypeDef)periods * 1000 / frequency;
+}
+
+/**
+  * @brief  Checks that the peripheral is the modelled one.
+  * @param  I2Cx : where x can be 1 to select the specified I2C peripheral.
+  * @retval None
+  */
+static void I2C_Check(I2C_TypeDef* I2Cx)
+{
+  if (I2Cx != I2C1)
+  {
+    HOST_Fatal("I2C: 0x%04X is not I2C1", (unsigned)((uint8_t*)I2Cx - HostIO));
+  }
+}
+
+/**
+  * @brief  Releases the bus and clears the status registers.
+  * @param  None
+  * @retval None
+  */
+static void I2C_Reset(void)
+{
+  I2C1->SR1 = I2C_SR1_RESET_VALUE;
+  I2C1->SR2 = I2C_SR2_RESET_VALUE;
+  I2C1->SR3 = I2C_SR3_RESET_VALUE;
+  I2CSR2 = 0;
+
+  I2CPhase = I2C_PHASE_IDLE;
+  I2CDevice = 0;
+  I2CAddressWritten = RESET;
+  I2CShiftFull = RESET;
+}
+
+/**
+  * @brief  Keeps the SR2 error flags written to 1 by software at their value:
+  *         only the flags written to 0 are cleared.
+  * @param  None
+  * @retval None
+  */
+static void I2C_Sync(void)
+{
+  I2CSR2 &= I2C1->SR2;
+  I2C1->SR2 = I2CSR2;
+}
+
+/**
+  * @brief  Runs the bus up to the next wait for the CPU, calling the
+  *         interrupt routine while an interrupt is pending.
+  * @note   The library calls of the interrupt routine only update the
+  *         registers: the bus goes on when the routine returns.
+  * @param  None
+  * @retval None
+  */
+static void I2C_Run(void)
+{
+  I2C_Sync();
+
+  if (I2CRunning != RESET)
+  {
+    return;
+  }
+  I2CRunning = SET;
+
+  for (;;)
+  {
+    if (I2C_Step() != RESET)
+    {
+      continue;
+    }
+
+    I2C_Sync();
+    if (I2C_Pending() == RESET)
+    {
+      break;
+    }
+
+    if (I2CHandler == 0)
+    {
+      HOST_Fatal("I2C: interrupt without routine");
+    }
+    I2CHandler();
+  }
+
+  I2CRunning = RESET;
+}
+
+/**
+  * @brief  Checks whether an enabled interrupt is pending.
+  * @param  None
+  * @retval SET if the interrupt routine must be called
+  */
+static FlagStatus I2C_Pending(void)
+{
+  uint8_t itr = I2C1->ITR, sr1 = I2C1->SR1;
+
+  if (((itr & I2C_ITR_ITERREN) != 0) && ((I2C1->SR2 & I2C_SR2_ERRORS) != 0))
+  {
+    return SET;
+  }
+
+  if ((itr & I2C_ITR_ITEVTEN) != 0)
+  {
+    if ((sr1 & I2C_SR1_EVENTS) != 0)
+    {
+      return SET;
+    }
+    if (((itr & I2C_ITR_ITBUFEN) != 0) && ((sr1 & I2C_SR1_BUFFER) != 0))
+    {
+      return SET;
+    }
+  }
+
+  return RESET;
+}
+
+/**
+  * @brief  Advances the bus by one condition or byte.
+  * @param  None
+  * @retval SET if the bus progressed, RESET if it waits for the CPU
+  */
+static FlagStatus I2C_Step(void)
+{
+  if ((I2C1->CR1 & I2C_CR1_PE) == 0)
+  {
+    return RESET;
+  }
+
+  switch (I2CPhase)
+  {
+    case I2C_PHASE_IDLE:
+      if ((I2C1->CR2 & I2C_CR2_STOP) != 0)
+      {
+        /* No transfer to end */
+        I2C1->CR2 &= (uint8_t)(~I2C_CR2_STOP);
+        return SET;
+      }
+      if ((I2C1->CR2 & I2C_CR2_START) != 0)
+      {
+        return I2C_End();
+      }
+      return RESET;
+
+    case I2C_PHASE_ADDRESS:
+      return I2C_StepAddress();
+
+    case I2C_PHASE_WRITE:
+      return I2C_StepWrite();
+
+    case I2C_PHASE_READ:
+      return I2C_StepRead();
+
+    default:
+      /* SCL held after a NACK */
+      if ((I2C1->CR2 & (I2C_CR2_START | I2C_CR2_STOP)) != 0)
+      {
+        return I2C_End();
+      }
+      return RESET;
+  }
+}
+
+/**
+  * @brief  Sends the slave address written in DR after the START.
+  * @param  None
+  * @retval SET if the bus progressed
+  */
+static FlagStatus I2C_StepAddress(void)
+{
+  const HOST_I2CDevice_TypeDef* device = 0;
+  I2C_Direction_TypeDef direction = I2C_Direction_Transmitter;
+  uint8_t address = I2C1->DR, index = 0;
+
+  if (I2CAddressWritten == RESET)
+  {
+    return RESET;
+  }
+  I2CAddressWritten = RESET;
+
+  I2C_SendBits(I2C_BYTE_BITS);
+
+  for (index = 0; index < I2CSlaveNb; index++)
+  {
+    if (I2CSlave[index].Address == (uint8_t)(address & OAR1_ADD0_Reset))
+    {
+      device = I2CSlave[index].Device;
+    }
+  }
+
+  /* The device addressed before a repeated START is released */
+  if ((I2CDevice != 0) && (I2CDevice != device))
+  {
+    I2CDevice->Stop();
+  }
+  I2CDevice = device;
+
+  if ((address & OAR1_ADD0_Set) != 0)
+  {
+    direction = I2C_Direction_Receiver;
+  }
+
+  if ((device == 0) || (device->Start(direction) == RESET))
+  {
+    I2CStatistics.NackNb++;
+    I2CPhase = I2C_PHASE_HOLD;
+    I2C_Error(I2C_SR2_AF);
+    return SET;
+  }
+
+  I2C1->SR1 |= I2C_SR1_ADDR;
+  if (direction == I2C_Direction_Receiver)
+  {
+    I2C1->SR3 &= (uint8_t)(~I2C_SR3_TRA);
+    I2CPhase = I2C_PHASE_READ;
+    I2CReadNb = 0;
+    I2CLastAck = SET;
+  }
+  else
+  {
+    I2C1->SR3 |= I2C_SR3_TRA;
+    I2CPhase = I2C_PHASE_WRITE;
+  }
+
+  return SET;
+}
+
+/**
+  * @brief  Sends the bytes written in DR, then the STOP or START condition.
+  * @param  None
+  * @retval SET if the bus progressed
+  */
+static FlagStatus I2C_StepWrite(void)
+{
+  if ((I2C1->SR1 & I2C_SR1_ADDR) != 0)
+  {
+    /* SCL stretched until ADDR is cleared */
+    return RESET;
+  }
+
+  if (I2CShiftFull != RESET)
+  {
+    I2CShiftFull = RESET;
+    I2C_SendBits(I2C_BYTE_BITS);
+    I2CStatistics.ByteNb++;
+
+    if (I2CDevice->Write(I2CShift) == RESET)
+    {
+      I2CPhase = I2C_PHASE_HOLD;
+      I2C_Error(I2C_SR2_AF);
+    }
+    else if ((I2C1->SR1 & I2C_SR1_TXE) != 0)
+    {
+      I2C1->SR1 |= I2C_SR1_BTF;
+    }
+    return SET;
+  }
+
+  if ((I2C1->CR2 & (I2C_CR2_START | I2C_CR2_STOP)) != 0)
+  {
+    return I2C_End();
+  }
+
+  if ((I2C1->SR1 & I2C_SR1_TXE) == 0)
+  {
+    /* DR moved to the shift register */
+    I2CShift = I2C1->DR;
+    I2CShiftFull = SET;
+    I2C1->SR1 |= I2C_SR1_TXE;
+    return SET;
+  }
+
+  return RESET;
+}
+
+/**
+  * @brief  Receives a byte, then sends the STOP or START condition if
+  *         requested before.
+  * @param  None
+  * @retval SET if the bus progressed
+  */
+static FlagStatus I2C_StepRead(void)
+{
+  uint8_t end = (uint8_t)(I2C1->CR2 & (I2C_CR2_START | I2C_CR2_STOP));
+  uint8_t data = 0;
+
+  if ((I2C1->SR1 & I2C_SR1_ADDR) != 0)
+  {
+    /* SCL stretched until ADDR is cleared */
+    return RESET;
+  }
+
+  if ((end != 0) && (((I2C1->SR1 & I2C_SR1_BTF) != 0) || (I2CLastAck == RESET)))
+  {
+    /* Bus waiting, or last byte not acknowledged: no byte in progress */
+    return I2C_End();
+  }
+
+  if ((I2C1->SR1 & I2C_SR1_BTF) != 0)
+  {
+    /* DR and shift register full: SCL stretched */
+    return RESET;
+  }
+
+  if (I2CLastAck == RESET)
+  {
+    /* The master must end the transfer after a NACK */
+    return RESET;
+  }
+
+  data = I2CDevice->Read();
+  I2C_SendBits(I2C_BYTE_BITS);
+  I2CStatistics.ByteNb++;
+
+  if (((I2C1->CR2 & I2C_CR2_POS) != 0) && (I2CReadNb == 0))
+  {
+    /* POS: ACK applies to the byte after the first one */
+    I2CLastAck = SET;
+  }
+  else
+  {
+    I2CLastAck = ((I2C1->CR2 & I2C_CR2_ACK) != 0) ? SET : RESET;
+  }
+  I2CReadNb++;
+
+  if ((I2C1->SR1 & I2C_SR1_RXNE) == 0)
+  {
+    I2C1->DR = data;
+    I2C1->SR1 |= I2C_SR1_RXNE;
+  }
+  else
+  {
+    I2CShift = data;
+    I2CShiftFull = SET;
+    I2C1->SR1 |= I2C_SR1_BTF;
+  }
+
+  if (end != 0)
+  {
+    I2C_End();
+  }
+
+  return SET;
+}
+
+/**
+  * @brief  Sends the STOP condition, or the (repeated) START one.
+  * @param  None
+  * @retval SET
+  */
+static FlagStatus I2C_End(void)
+{
+  if ((I2CPhase == I2C_PHASE_READ) && (I2CLastAck != RESET))
+  {
+    /* The last byte read must not be acknowledged */
+    I2CStatistics.ErrorNb++;
+  }
+
+  I2C_SendBits(1);
+  I2C1->SR1 &= (uint8_t)(~(I2C_SR1_TXE | I2C_SR1_BTF));
+
+  if ((I2C1->CR2 & I2C_CR2_STOP) != 0)
+  {
+    I2C1->CR2 &= (uint8_t)(~(I2C_CR2_START | I2C_CR2_STOP));
+    I2C1->SR3 &= (uint8_t)(~(I2C_SR3_MSL | I2C_SR3_BUSY | I2C_SR3_TRA));
+
+    if (I2CDevice != 0)
+    {
+      I2CDevice->Stop();
+      I2CDevice = 0;
+    }
+    I2CPhase = I2C_PHASE_IDLE;
+  }
+  else
+  {
+    I2C1->CR2 &= (uint8_t)(~I2C_CR2_START);
+    I2C1->SR3 |= (uint8_t)(I2C_SR3_MSL | I2C_SR3_BUSY);
+    I2C1->SR1 |= I2C_SR1_SB;
+
+    I2CStatistics.StartNb++;
+    I2CPhase = I2C_PHASE_ADDRESS;
+  }
+
+  return SET;
+}
+
+/**
+  * @brief  Advances the simulated time by bits on the bus.
+  * @param  BitNb: Number of bits.
+  * @retval None
+  */
+static void I2C_SendBits(uint8_t BitNb)
+{
+  HOST_Wait(HOST_I2CBitTime(I2C1) * BitNb);
+}
+
+/**
+  * @brief  Sets an error flag of SR2.
+  * @param  Flag: I2C_SR2_xxx flag.
+  * @retval None
+  */
+static void I2C_Error(uint8_t Flag)
+{
+  I2CSR2 |= Flag;
+  I2C1->SR2 = I2CSR2;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
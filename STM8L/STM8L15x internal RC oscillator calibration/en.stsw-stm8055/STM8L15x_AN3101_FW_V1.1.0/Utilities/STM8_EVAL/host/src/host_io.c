@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    host_io.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host image of the STM8 peripheral registers, with the two banks
+  *          of the LCD RAM, and simulated time of the peripheral models.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+uint8_t HostIO[HOST_IO_SIZE];
+
+/* One copy of the LCD registers per LCD RAM bank: the registers other than
+   the LCD RAM are carried over when the bank changes */
+static LCD_TypeDef HostLCD[HOST_LCD_PAGE_NB];
+static uint8_t HostLCDPage = 0;
+
+/* Simulated time: advanced by the peripheral models for the bus transfers,
+   and by the application for the time it spends elsewhere */
+static HOST_Time_TypeDef HostTime = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Gives the LCD registers, the LCD RAM being the bank selected by
+  *         LCD_CR4_PAGECOM.
+  * @param  None
+  * @retval Pointer to the LCD registers
+  */
+LCD_TypeDef* HOST_LCD(void)
+{
+  uint8_t ram[HOST_LCD_RAM_NB];
+  uint8_t page = 0;
+
+  page = (uint8_t)(((HostLCD[HostLCDPage].CR4 & LCD_CR4_PAGECOM) != 0) ? 1 : 0);
+  if (page != HostLCDPage)
+  {
+    memcpy(ram, (void*)HostLCD[page].RAM, HOST_LCD_RAM_NB);
+    memcpy(&HostLCD[page], &HostLCD[HostLCDPage], sizeof(LCD_TypeDef));
+    memcpy((void*)HostLCD[page].RAM, ram, HOST_LCD_RAM_NB);
+    HostLCDPage = page;
+  }
+
+  return &HostLCD[page];
+}
+
+/**
+  * @brief  Resets the LCD registers and both LCD RAM banks.
+  * @param  None
+  * @retval None
+  */
+void HOST_LCDReset(void)
+{
+  memset(HostLCD, 0, sizeof(HostLCD));
+  HostLCDPage = 0;
+}
+
+/**
+  * @brief  Fills both LCD RAM banks.
+  * @param  Value: Value written in every LCD RAM register.
+  * @retval None
+  */
+void HOST_LCDFill(uint8_t Value)
+{
+  uint8_t page = 0;
+
+  for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+  {
+    memset((void*)HostLCD[page].RAM, Value, HOST_LCD_RAM_NB);
+  }
+}
+
+/**
+  * @brief  Reads a register of the LCD RAM.
+  * @param  Page: LCD RAM bank, 0 or 1.
+  * @param  Register: LCD RAM register.
+  * @retval Value of the register
+  */
+uint8_t HOST_LCDRead(uint8_t Page, uint8_t Register)
+{
+  return HostLCD[Page].RAM[Register];
+}
+
+/**
+  * @brief  Gives the simulated time.
+  * @param  None
+  * @retval Time elapsed since the start, in ns
+  */
+HOST_Time_TypeDef HOST_GetTime(void)
+{
+  return HostTime;
+}
+
+/**
+  * @brief  Advances the simulated time.
+  * @param  Time: Time to wait, in ns.
+  * @retval None
+  */
+void HOST_Wait(HOST_Time_TypeDef Time)
+{
+  HostTime += Time;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,178 @@
+/**
+  ******************************************************************************
+  * @file    host_lm75.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of the LM75 temperature sensor.
+  *
+  *          @note The model runs the register accesses as the LM75 datasheet
+  *                describes them:
+  *                - The first byte written after the slave address sets the
+  *                  pointer register; the next ones write the register
+  *                  pointed, MSB first. The temperature register is read
+  *                  only.
+  *                - The reads give the register pointed, MSB first (the
+  *                  configuration register has one byte), over and over.
+  *                - The temperature, hysteresis and overtemperature
+  *                  registers keep their 9 upper bits.
+  *                The temperature is set by HOST_LM75SetTemperature().
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define LM75_REG_NB         ((uint8_t)4)
+#define LM75_POINTER_MASK   ((uint8_t)0x03)
+#define LM75_TEMP_MASK      ((uint16_t)0xFF80)  /*!< 9-bit temperatures */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint16_t LM75Register[LM75_REG_NB];
+static uint8_t LM75Pointer = HOST_LM75_REG_TEMP;
+
+/* Bytes transferred since the slave address */
+static uint8_t LM75ByteNb = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static FlagStatus LM75_Start(I2C_Direction_TypeDef Direction);
+static FlagStatus LM75_Write(uint8_t Data);
+static uint8_t LM75_Read(void);
+static void LM75_Stop(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  LM75 device of the I2C bus model
+  */
+const HOST_I2CDevice_TypeDef HOST_LM75 =
+  {
+    LM75_Start, LM75_Write, LM75_Read, LM75_Stop
+  };
+
+/**
+  * @brief  Sets the registers to their power-up values.
+  * @param  None
+  * @retval None
+  */
+void HOST_LM75Init(void)
+{
+  LM75Register[HOST_LM75_REG_TEMP] = 0;
+  LM75Register[HOST_LM75_REG_CONF] = 0;
+  LM75Register[HOST_LM75_REG_THYS] = HOST_LM75_THYS;
+  LM75Register[HOST_LM75_REG_TOS] = HOST_LM75_TOS;
+  LM75Pointer = HOST_LM75_REG_TEMP;
+}
+
+/**
+  * @brief  Sets the temperature measured.
+  * @param  Temperature: Temperature register value, in 1/256 C.
+  * @retval None
+  */
+void HOST_LM75SetTemperature(uint16_t Temperature)
+{
+  LM75Register[HOST_LM75_REG_TEMP] = (uint16_t)(Temperature & LM75_TEMP_MASK);
+}
+
+/**
+  * @brief  Gives a register value, to check the writes.
+  * @param  Pointer: HOST_LM75_REG_xxx register.
+  * @retval Register value (the configuration in the LSB)
+  */
+uint16_t HOST_LM75Register(uint8_t Pointer)
+{
+  return LM75Register[Pointer & LM75_POINTER_MASK];
+}
+
+/**
+  * @brief  Slave address received: always acknowledged.
+  * @param  Direction: I2C_Direction_Transmitter for a write.
+  * @retval SET
+  */
+static FlagStatus LM75_Start(I2C_Direction_TypeDef Direction)
+{
+  LM75ByteNb = 0;
+
+  return SET;
+}
+
+/**
+  * @brief  Byte received: pointer, then register bytes.
+  * @param  Data: byte written by the master.
+  * @retval SET (acknowledged)
+  */
+static FlagStatus LM75_Write(uint8_t Data)
+{
+  uint16_t* reg = &LM75Register[LM75Pointer];
+
+  if (LM75ByteNb == 0)
+  {
+    LM75Pointer = (uint8_t)(Data & LM75_POINTER_MASK);
+  }
+  else if (LM75Pointer == HOST_LM75_REG_CONF)
+  {
+    *reg = Data;
+  }
+  else if (LM75Pointer != HOST_LM75_REG_TEMP)
+  {
+    if (LM75ByteNb == 1)
+    {
+      *reg = (uint16_t)((*reg & 0x00FF) | ((uint16_t)Data << 8));
+    }
+    else
+    {
+      *reg = (uint16_t)(((*reg & 0xFF00) | Data) & LM75_TEMP_MASK);
+    }
+  }
+  LM75ByteNb++;
+
+  return SET;
+}
+
+/**
+  * @brief  Byte read by the master from the register pointed.
+  * @param  None
+  * @retval Register byte
+  */
+static uint8_t LM75_Read(void)
+{
+  uint16_t value = LM75Register[LM75Pointer];
+  uint8_t data = 0;
+
+  if (LM75Pointer == HOST_LM75_REG_CONF)
+  {
+    data = (uint8_t)value;
+  }
+  else
+  {
+    data = (uint8_t)(((LM75ByteNb & 1) == 0) ? (value >> 8) : value);
+  }
+  LM75ByteNb++;
+
+  return data;
+}
+
+/**
+  * @brief  End of the transfer: the pointer is kept.
+  * @param  None
+  * @retval None
+  */
+static void LM75_Stop(void)
+{
+  LM75ByteNb = 0;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
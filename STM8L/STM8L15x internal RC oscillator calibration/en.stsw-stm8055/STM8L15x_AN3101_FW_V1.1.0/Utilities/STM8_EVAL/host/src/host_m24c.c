@@ -0,0 +1,263 @@
+/**
+  ******************************************************************************
+  * @file    host_m24c.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of the M24C64 I2C EEPROM, its memory being an image
+  *          file mapped by mmap().
+  *
+  *          @note The model runs the byte write, page write, current address
+  *                read, random address read and sequential read as the
+  *                M24C64 datasheet describes them:
+  *                - The two bytes following the slave address for write are
+  *                  the memory address, MSB first, the 3 upper bits being
+  *                  ignored.
+  *                - The data bytes are latched in the page of the address,
+  *                  wrapping to its start; the write cycle starts at the
+  *                  STOP condition, after at least one data byte.
+  *                - During the write cycle, tW of simulated time, the slave
+  *                  address is not acknowledged.
+  *                - The reads go on from the address, wrapping at the end of
+  *                  the memory.
+  *                The memory is updated at the start of the write cycle. A
+  *                write ended before the second address byte is counted as
+  *                an error.
+  *
+  *          @note A new image file, or one of another size, is resized to the
+  *                EEPROM size and erased (0xFF). The content is kept in the
+  *                file when the program ends.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Bytes of the memory address */
+#define M24C_ADDRESS_NB     ((uint32_t)2)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t* M24CMemory = 0;
+static HOST_Time_TypeDef M24CWriteTime = 0;
+static HOST_M24CStatistics_TypeDef M24CStatistics;
+
+/* Address counter, and write in progress: bytes received since the slave
+   address */
+static uint32_t M24CAddress = 0;
+static FlagStatus M24CWriting = RESET;
+static uint32_t M24CByteNb = 0;
+
+/* End of the write cycle in progress */
+static HOST_Time_TypeDef M24CBusyEnd = 0;
+
+/* Page write data, programmed at the STOP condition */
+static uint8_t M24CPage[HOST_M24C_PAGE_SIZE];
+static uint8_t M24CPageWritten[HOST_M24C_PAGE_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+static FlagStatus M24C_Start(I2C_Direction_TypeDef Direction);
+static FlagStatus M24C_Write(uint8_t Data);
+static uint8_t M24C_Read(void);
+static void M24C_Stop(void);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  M24C device of the I2C bus model
+  */
+const HOST_I2CDevice_TypeDef HOST_M24C =
+  {
+    M24C_Start, M24C_Write, M24C_Read, M24C_Stop
+  };
+
+/**
+  * @brief  Maps the EEPROM memory to an image file.
+  * @param  FileName: Image file, created or resized if needed.
+  * @param  WriteTime: Write cycle time, tW, 0 for the M24C64 maximum one.
+  * @retval SUCCESS, or ERROR if the file can not be mapped
+  */
+ErrorStatus HOST_M24CInit(const char* FileName, HOST_Time_TypeDef WriteTime)
+{
+  HOST_M24CDeInit();
+
+  /* A new image is erased */
+  M24CMemory = HOST_FileMap(FileName, HOST_M24C_SIZE, 0xFF);
+  if (M24CMemory == 0)
+  {
+    return ERROR;
+  }
+
+  M24CWriteTime = (WriteTime != 0) ? WriteTime : HOST_M24C_TW;
+
+  memset(&M24CStatistics, 0, sizeof(M24CStatistics));
+  M24CAddress = 0;
+  M24CWriting = RESET;
+  M24CBusyEnd = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Unmaps the image file, its content being kept.
+  * @param  None
+  * @retval None
+  */
+void HOST_M24CDeInit(void)
+{
+  if (M24CMemory != 0)
+  {
+    HOST_FileUnmap(M24CMemory, HOST_M24C_SIZE);
+    M24CMemory = 0;
+  }
+}
+
+/**
+  * @brief  Gives the operations counted since HOST_M24CInit().
+  * @param  Statistics: pointer to the counters.
+  * @retval None
+  */
+void HOST_M24CGetStatistics(HOST_M24CStatistics_TypeDef* Statistics)
+{
+  *Statistics = M24CStatistics;
+}
+
+/**
+  * @brief  Gives the EEPROM memory, to check its content.
+  * @param  None
+  * @retval Pointer to the HOST_M24C_SIZE bytes of the memory
+  */
+uint8_t* HOST_M24CMemory(void)
+{
+  return M24CMemory;
+}
+
+/**
+  * @brief  Slave address received: acknowledged unless a write cycle is in
+  *         progress.
+  * @param  Direction: I2C_Direction_Transmitter for a write.
+  * @retval SET if acknowledged
+  */
+static FlagStatus M24C_Start(I2C_Direction_TypeDef Direction)
+{
+  if (M24CMemory == 0)
+  {
+    HOST_Fatal("M24C addressed before HOST_M24CInit()");
+  }
+
+  if (HOST_GetTime() < M24CBusyEnd)
+  {
+    M24CStatistics.BusyNb++;
+    return RESET;
+  }
+
+  if (Direction == I2C_Direction_Transmitter)
+  {
+    M24CWriting = SET;
+    M24CByteNb = 0;
+    memset(M24CPageWritten, 0, sizeof(M24CPageWritten));
+  }
+  else
+  {
+    /* Random address read: the address set by the write is kept */
+    M24CWriting = RESET;
+  }
+
+  return SET;
+}
+
+/**
+  * @brief  Byte received: memory address, then data latched in the page.
+  * @param  Data: byte written by the master.
+  * @retval SET (acknowledged)
+  */
+static FlagStatus M24C_Write(uint8_t Data)
+{
+  uint32_t offset = 0;
+
+  if (M24CByteNb < M24C_ADDRESS_NB)
+  {
+    M24CAddress = ((M24CAddress << 8) | Data) & (HOST_M24C_SIZE - 1);
+  }
+  else
+  {
+    /* The address counter wraps within the page */
+    offset = M24CAddress % HOST_M24C_PAGE_SIZE;
+    M24CPage[offset] = Data;
+    M24CPageWritten[offset] = 1;
+    M24CAddress = (M24CAddress & ~(HOST_M24C_PAGE_SIZE - 1))
+                  | ((offset + 1) % HOST_M24C_PAGE_SIZE);
+  }
+  M24CByteNb++;
+
+  return SET;
+}
+
+/**
+  * @brief  Byte read by the master, at the address counter.
+  * @param  None
+  * @retval Byte of the memory
+  */
+static uint8_t M24C_Read(void)
+{
+  uint8_t data = M24CMemory[M24CAddress];
+
+  M24CAddress = (M24CAddress + 1) & (HOST_M24C_SIZE - 1);
+  M24CStatistics.ReadByteNb++;
+
+  return data;
+}
+
+/**
+  * @brief  End of the transfer: a write with data starts the write cycle.
+  * @param  None
+  * @retval None
+  */
+static void M24C_Stop(void)
+{
+  uint32_t page = 0, offset = 0;
+
+  if (M24CWriting == RESET)
+  {
+    return;
+  }
+  M24CWriting = RESET;
+
+  if (M24CByteNb <= M24C_ADDRESS_NB)
+  {
+    /* Address only (ACK poll, or random read set up) or incomplete */
+    if (M24CByteNb == 1)
+    {
+      M24CStatistics.ErrorNb++;
+    }
+    return;
+  }
+
+  page = M24CAddress & ~(HOST_M24C_PAGE_SIZE - 1);
+  for (offset = 0; offset < HOST_M24C_PAGE_SIZE; offset++)
+  {
+    if (M24CPageWritten[offset] != 0)
+    {
+      M24CMemory[page + offset] = M24CPage[offset];
+      M24CStatistics.WriteByteNb++;
+    }
+  }
+
+  M24CStatistics.WriteNb++;
+  M24CBusyEnd = HOST_GetTime() + M24CWriteTime;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
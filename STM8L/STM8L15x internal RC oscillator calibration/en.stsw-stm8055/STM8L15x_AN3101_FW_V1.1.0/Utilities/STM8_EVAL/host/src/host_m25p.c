@@ -0,0 +1,366 @@
+/**
+  ******************************************************************************
+  * @file    host_m25p.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of the M25P64 SPI FLASH, its memory being an image
+  *          file mapped by mmap().
+  *
+  *          @note The model runs the READ, FAST_READ, Page WRITE (PP), Sector
+  *                Erase (SE), Bulk Erase (BE), WREN, WRDI, RDSR and RDID
+  *                instructions as the M25P64 datasheet describes them:
+  *                - PP, SE and BE need a WREN first and start their cycle
+  *                  when the FLASH is deselected, after a whole number of
+  *                  bytes. The write enable latch is reset at the end of
+  *                  the cycle.
+  *                - The Page WRITE data wraps to the start of the page; only
+  *                  the last 256 bytes sent are programmed, ANDed with the
+  *                  memory.
+  *                - The Write In Progress bit of the status register is set
+  *                  for tPP, tSE or tBE of simulated time after the start of
+  *                  the cycle. The instructions other than RDSR sent during
+  *                  the cycle are ignored.
+  *                - The addresses wrap at the end of the memory.
+  *                The memory is updated at the start of the cycle. The
+  *                ignored instructions are counted as errors, with the
+  *                writes and erases without WREN or with a wrong length.
+  *
+  *          @note A new image file, or one of another size, is resized to the
+  *                FLASH size and erased (0xFF). The content is kept in the
+  *                file when the program ends.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Instructions */
+#define M25P_CMD_PP         ((uint8_t)0x02)
+#define M25P_CMD_READ       ((uint8_t)0x03)
+#define M25P_CMD_WRDI       ((uint8_t)0x04)
+#define M25P_CMD_RDSR       ((uint8_t)0x05)
+#define M25P_CMD_WREN       ((uint8_t)0x06)
+#define M25P_CMD_FAST_READ  ((uint8_t)0x0B)
+#define M25P_CMD_RDID       ((uint8_t)0x9F)
+#define M25P_CMD_SE         ((uint8_t)0xD8)
+#define M25P_CMD_BE         ((uint8_t)0xC7)
+
+/* Status register */
+#define M25P_SR_WIP         ((uint8_t)0x01)
+#define M25P_SR_WEL         ((uint8_t)0x02)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t* M25PMemory = 0;
+static HOST_M25PTiming_TypeDef M25PTiming;
+static HOST_M25PStatistics_TypeDef M25PStatistics;
+
+/* Instruction in progress: bytes received since the selection */
+static uint8_t M25PInstruction = 0;
+static FlagStatus M25PIgnored = RESET;
+static uint32_t M25PByteNb = 0;
+static uint32_t M25PAddress = 0;
+
+/* Write enable latch and end of the write cycle in progress */
+static FlagStatus M25PWEL = RESET;
+static HOST_Time_TypeDef M25PBusyEnd = 0;
+
+/* Page WRITE data, programmed at the deselection */
+static uint8_t M25PPage[HOST_M25P_PAGE_SIZE];
+static uint8_t M25PPageWritten[HOST_M25P_PAGE_SIZE];
+
+/* Private function prototypes -----------------------------------------------*/
+static void M25P_Select(void);
+static void M25P_Deselect(void);
+static uint8_t M25P_Exchange(uint8_t Data);
+static FlagStatus M25P_Busy(void);
+static void M25P_StartCycle(HOST_Time_TypeDef Time);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  M25P device of the SPI bus model
+  */
+const HOST_SPIDevice_TypeDef HOST_M25P =
+  {
+    M25P_Select, M25P_Deselect, M25P_Exchange
+  };
+
+/**
+  * @brief  Maps the FLASH memory to an image file.
+  * @param  FileName: Image file, created or resized if needed.
+  * @param  Timing: Write and erase cycle times, 0 for the M25P64 typical ones.
+  * @retval SUCCESS, or ERROR if the file can not be mapped
+  */
+ErrorStatus HOST_M25PInit(const char* FileName, const HOST_M25PTiming_TypeDef* Timing)
+{
+  HOST_M25PDeInit();
+
+  /* A new image is erased */
+  M25PMemory = HOST_FileMap(FileName, HOST_M25P_SIZE, 0xFF);
+  if (M25PMemory == 0)
+  {
+    return ERROR;
+  }
+
+  if (Timing != 0)
+  {
+    M25PTiming = *Timing;
+  }
+  else
+  {
+    M25PTiming.PageProgramTime = HOST_M25P_TPP;
+    M25PTiming.SectorEraseTime = HOST_M25P_TSE;
+    M25PTiming.BulkEraseTime = HOST_M25P_TBE;
+  }
+
+  memset(&M25PStatistics, 0, sizeof(M25PStatistics));
+  M25PWEL = RESET;
+  M25PBusyEnd = 0;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Unmaps the image file, its content being kept.
+  * @param  None
+  * @retval None
+  */
+void HOST_M25PDeInit(void)
+{
+  if (M25PMemory != 0)
+  {
+    HOST_FileUnmap(M25PMemory, HOST_M25P_SIZE);
+    M25PMemory = 0;
+  }
+}
+
+/**
+  * @brief  Gives the instructions counted since HOST_M25PInit().
+  * @param  Statistics: pointer to the counters.
+  * @retval None
+  */
+void HOST_M25PGetStatistics(HOST_M25PStatistics_TypeDef* Statistics)
+{
+  *Statistics = M25PStatistics;
+}
+
+/**
+  * @brief  Gives the FLASH memory, to check its content.
+  * @param  None
+  * @retval Pointer to the HOST_M25P_SIZE bytes of the memory
+  */
+uint8_t* HOST_M25PMemory(void)
+{
+  return M25PMemory;
+}
+
+/**
+  * @brief  Chip select falling edge: a new instruction starts.
+  * @param  None
+  * @retval None
+  */
+static void M25P_Select(void)
+{
+  if (M25PMemory == 0)
+  {
+    HOST_Fatal("M25P selected before HOST_M25PInit()");
+  }
+
+  M25PByteNb = 0;
+  M25PAddress = 0;
+  M25PIgnored = RESET;
+  memset(M25PPageWritten, 0, sizeof(M25PPageWritten));
+}
+
+/**
+  * @brief  Chip select rising edge: ends the instruction, the writes and
+  *         erases starting their cycle.
+  * @param  None
+  * @retval None
+  */
+static void M25P_Deselect(void)
+{
+  uint32_t page = 0, offset = 0;
+
+
+  if ((M25PByteNb == 0) || (M25PIgnored != RESET))
+  {
+    return;
+  }
+
+  switch (M25PInstruction)
+  {
+    case M25P_CMD_WREN:
+      M25PWEL = SET;
+      break;
+
+    case M25P_CMD_WRDI:
+      M25PWEL = RESET;
+      break;
+
+    case M25P_CMD_PP:
+      if ((M25PWEL == RESET) || (M25PByteNb < 5))
+      {
+        M25PStatistics.ErrorNb++;
+        break;
+      }
+      page = M25PAddress & ~(HOST_M25P_PAGE_SIZE - 1);
+      for (offset = 0; offset < HOST_M25P_PAGE_SIZE; offset++)
+      {
+        if (M25PPageWritten[offset] != 0)
+        {
+          M25PMemory[page + offset] &= M25PPage[offset];
+          M25PStatistics.ProgramByteNb++;
+        }
+      }
+      M25PStatistics.ProgramNb++;
+      M25P_StartCycle(M25PTiming.PageProgramTime);
+      break;
+
+    case M25P_CMD_SE:
+      if ((M25PWEL == RESET) || (M25PByteNb != 4))
+      {
+        M25PStatistics.ErrorNb++;
+        break;
+      }
+      memset(M25PMemory + (M25PAddress & ~(HOST_M25P_SECTOR_SIZE - 1)), 0xFF,
+             HOST_M25P_SECTOR_SIZE);
+      M25PStatistics.EraseNb++;
+      M25P_StartCycle(M25PTiming.SectorEraseTime);
+      break;
+
+    case M25P_CMD_BE:
+      if ((M25PWEL == RESET) || (M25PByteNb != 1))
+      {
+        M25PStatistics.ErrorNb++;
+        break;
+      }
+      memset(M25PMemory, 0xFF, HOST_M25P_SIZE);
+      M25PStatistics.EraseNb++;
+      M25P_StartCycle(M25PTiming.BulkEraseTime);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/**
+  * @brief  Byte exchange while the FLASH is selected.
+  * @param  Data: Byte received on D.
+  * @retval Byte sent on Q
+  */
+static uint8_t M25P_Exchange(uint8_t Data)
+{
+  uint8_t data = 0xFF;
+  uint32_t index = M25PByteNb++;
+
+  if (index == 0)
+  {
+    M25PInstruction = Data;
+    if ((M25P_Busy() != RESET) && (Data != M25P_CMD_RDSR))
+    {
+      M25PIgnored = SET;
+      M25PStatistics.ErrorNb++;
+    }
+    else if ((Data == M25P_CMD_READ) || (Data == M25P_CMD_FAST_READ))
+    {
+      M25PStatistics.ReadNb++;
+    }
+    return data;
+  }
+
+  if (M25PIgnored != RESET)
+  {
+    return data;
+  }
+
+  switch (M25PInstruction)
+  {
+    case M25P_CMD_RDSR:
+      /* The write enable latch is reset at the end of the cycle */
+      data = (uint8_t)((M25P_Busy() != RESET) ? (M25P_SR_WIP | M25P_SR_WEL) :
+                       ((M25PWEL != RESET) ? M25P_SR_WEL : 0));
+      M25PStatistics.StatusNb++;
+      break;
+
+    case M25P_CMD_RDID:
+      if (index <= 3)
+      {
+        data = (uint8_t)(HOST_M25P_ID >> (8 * (3 - index)));
+      }
+      break;
+
+    case M25P_CMD_READ:
+    case M25P_CMD_FAST_READ:
+    case M25P_CMD_PP:
+    case M25P_CMD_SE:
+      if (index <= 3)
+      {
+        M25PAddress = ((M25PAddress << 8) | Data) & (HOST_M25P_SIZE - 1);
+        break;
+      }
+      if (M25PInstruction == M25P_CMD_PP)
+      {
+        /* The data wraps in the page */
+        M25PPage[(M25PAddress + index - 4) % HOST_M25P_PAGE_SIZE] = Data;
+        M25PPageWritten[(M25PAddress + index - 4) % HOST_M25P_PAGE_SIZE] = 1;
+        break;
+      }
+      if ((M25PInstruction == M25P_CMD_FAST_READ) && (index == 4))
+      {
+        /* Dummy byte */
+        break;
+      }
+      if (M25PInstruction != M25P_CMD_SE)
+      {
+        data = M25PMemory[M25PAddress];
+        M25PAddress = (M25PAddress + 1) & (HOST_M25P_SIZE - 1);
+        M25PStatistics.ReadByteNb++;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return data;
+}
+
+/**
+  * @brief  Checks whether a write cycle is in progress.
+  * @param  None
+  * @retval SET during a write cycle, RESET otherwise
+  */
+static FlagStatus M25P_Busy(void)
+{
+  return (HOST_GetTime() < M25PBusyEnd) ? SET : RESET;
+}
+
+/**
+  * @brief  Starts a write cycle, the write enable latch being reset.
+  * @param  Time: Cycle time, in ns.
+  * @retval None
+  */
+static void M25P_StartCycle(HOST_Time_TypeDef Time)
+{
+  M25PBusyEnd = HOST_GetTime() + Time;
+  M25PWEL = RESET;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,912 @@
+/**
+  ******************************************************************************
+  * @file    host_sd.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of a SD card in SPI mode, its memory being an image
+  *          file mapped by mmap().
+  *
+  *          @note The model runs the commands used by the SD driver: CMD0,
+  *                CMD1, CMD8, CMD9, CMD10, CMD12, CMD13, CMD16, CMD17, CMD18,
+  *                CMD24, CMD25, CMD55, CMD58, CMD59, ACMD23 and ACMD41, as
+  *                the SD Physical Layer Simplified Specification describes
+  *                them in SPI mode:
+  *                - The responses follow the command after
+  *                  HOST_SDConfig_TypeDef.ResponseDelay bytes (NCR).
+  *                - The card type sets the commands accepted: CMD8 is
+  *                  rejected by the version 1.x cards and the MultiMediaCards,
+  *                  which also reject CMD55; ACMD41 needs HCS on the high
+  *                  capacity cards. The card leaves the idle state InitTime
+  *                  after the first ACMD41 or CMD1.
+  *                - The data token of a block read comes ReadAccessTime after
+  *                  the command, and MultiBlockReadTime after the previous
+  *                  block of a multiple block read. The blocks carry their
+  *                  CRC16. A multiple block read past the end of the memory
+  *                  gets the out of range data error token.
+  *                - The data response of a block written is followed by
+  *                  BlockWriteTime, or MultiBlockWriteTime, of busy signal
+  *                  (data output held low). The stop token of a multiple
+  *                  block write is followed by StopWriteTime of busy signal.
+  *                - CMD12 stops a multiple block read at once: a stuff byte
+  *                  is sent before its response.
+  *                - The CRC7 of CMD0 and CMD8 is always checked, the one of
+  *                  the other commands and the CRC16 of the blocks written
+  *                  after CMD59 turned the CRC on.
+  *                The commands rejected with another error than the illegal
+  *                command one are counted as errors, with the commands sent
+  *                while the card is busy or in a block read, which are
+  *                ignored, and the blocks written which are rejected.
+  *
+  *          @note A new image file, or one of another size, is resized to the
+  *                card capacity and filled with zeros, the file being left
+  *                sparse. The content is kept in the file when the program
+  *                ends.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <string.h>
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define SD_BLOCK                ((uint16_t)512)
+
+/* Commands */
+#define SD_CMD0                 ((uint8_t)0)
+#define SD_CMD1                 ((uint8_t)1)
+#define SD_CMD8                 ((uint8_t)8)
+#define SD_CMD9                 ((uint8_t)9)
+#define SD_CMD10                ((uint8_t)10)
+#define SD_CMD12                ((uint8_t)12)
+#define SD_CMD13                ((uint8_t)13)
+#define SD_CMD16                ((uint8_t)16)
+#define SD_CMD17                ((uint8_t)17)
+#define SD_CMD18                ((uint8_t)18)
+#define SD_CMD24                ((uint8_t)24)
+#define SD_CMD25                ((uint8_t)25)
+#define SD_CMD55                ((uint8_t)55)
+#define SD_CMD58                ((uint8_t)58)
+#define SD_CMD59                ((uint8_t)59)
+#define SD_ACMD23               ((uint8_t)23)
+#define SD_ACMD41               ((uint8_t)41)
+
+/* R1 response */
+#define SD_R1_IDLE              ((uint8_t)0x01)
+#define SD_R1_ILLEGAL_COMMAND   ((uint8_t)0x04)
+#define SD_R1_COM_CRC_ERROR     ((uint8_t)0x08)
+#define SD_R1_PARAMETER_ERROR   ((uint8_t)0x40)
+
+/* Data tokens and data responses */
+#define SD_TOKEN_START_BLOCK    ((uint8_t)0xFE)
+#define SD_TOKEN_START_MULTIPLE ((uint8_t)0xFC)
+#define SD_TOKEN_STOP           ((uint8_t)0xFD)
+#define SD_TOKEN_OUT_OF_RANGE   ((uint8_t)0x08)
+#define SD_DATA_ACCEPTED        ((uint8_t)0xE5)
+#define SD_DATA_CRC_REJECTED    ((uint8_t)0xEB)
+#define SD_DATA_WRITE_REJECTED  ((uint8_t)0xED)
+
+/* ACMD41 argument and OCR */
+#define SD_HCS                  ((uint32_t)0x40000000)
+#define SD_OCR_BUSY             ((uint32_t)0x80000000)
+#define SD_OCR_CCS              ((uint32_t)0x40000000)
+#define SD_OCR_VDD              ((uint32_t)0x00FF8000)
+
+/* States */
+#define SD_STATE_COMMAND        ((uint8_t)0x00) /*!< Waiting for a command */
+#define SD_STATE_READ_TOKEN     ((uint8_t)0x01) /*!< Data token of a block read */
+#define SD_STATE_READ_DATA      ((uint8_t)0x02) /*!< Data and CRC of a block read */
+#define SD_STATE_WRITE_TOKEN    ((uint8_t)0x03) /*!< Waiting for a data token */
+#define SD_STATE_WRITE_DATA     ((uint8_t)0x04) /*!< Data and CRC of a block written */
+
+#define SD_OUTPUT_SIZE          ((uint8_t)16)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t* SDMemory = 0;
+static HOST_SDConfig_TypeDef SDConfig;
+static HOST_SDStatistics_TypeDef SDStatistics;
+
+/* Card state */
+static FlagStatus SDSpiMode = RESET;
+static FlagStatus SDIdle = SET;
+static FlagStatus SDInitStarted = RESET;
+static HOST_Time_TypeDef SDInitStart = 0;
+static FlagStatus SDAppCommand = RESET;
+static FlagStatus SDCrcOn = RESET;
+static uint32_t SDBlockLength = SD_BLOCK;
+static HOST_Time_TypeDef SDBusyEnd = 0;
+
+/* Command being received */
+static uint8_t SDCommand[6];
+static uint8_t SDCommandIndex = 0;
+
+/* Response bytes waiting to be sent */
+static uint8_t SDOutput[SD_OUTPUT_SIZE];
+static uint8_t SDOutputIn = 0;
+static uint8_t SDOutputOut = 0;
+
+/* Data transfer in progress */
+static uint8_t SDState = SD_STATE_COMMAND;
+static FlagStatus SDMultiple = RESET;
+static FlagStatus SDRegisterRead = RESET;
+static uint32_t SDAddress = 0;
+static const uint8_t* SDData = 0;
+static uint16_t SDDataSize = 0;
+static uint16_t SDDataIndex = 0;
+static uint16_t SDDataCRC = 0;
+static HOST_Time_TypeDef SDAccessTime = 0;
+static FlagStatus SDAccessStarted = RESET;
+static HOST_Time_TypeDef SDAccessEnd = 0;
+static uint8_t SDRegister[16];
+static uint8_t SDBlock[SD_BLOCK + 2];
+
+/* Private function prototypes -----------------------------------------------*/
+static void SD_Select(void);
+static void SD_Deselect(void);
+static uint8_t SD_Exchange(uint8_t Data);
+static uint8_t SD_Output(void);
+static void SD_Command(void);
+static void SD_WriteEnd(void);
+static uint8_t SD_Initialize(void);
+static void SD_Respond(uint8_t R1, const uint8_t* Data, uint8_t Size);
+static void SD_Send(uint8_t Data);
+static void SD_StartRead(uint32_t Address, const uint8_t* Data, uint16_t Size,
+                         HOST_Time_TypeDef AccessTime);
+static uint32_t SD_Capacity(void);
+static void SD_CSD(uint8_t* CSD);
+static void SD_CID(uint8_t* CID);
+static uint8_t SD_CRC7(const uint8_t* Data, uint8_t Size);
+static uint16_t SD_CRC16(uint16_t CRC, uint8_t Data);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  SD card device of the SPI bus model
+  */
+const HOST_SPIDevice_TypeDef HOST_SD =
+  {
+    SD_Select, SD_Deselect, SD_Exchange
+  };
+
+/**
+  * @brief  Maps the card memory to an image file and powers the card up.
+  * @param  FileName: Image file, created or resized if needed.
+  * @param  Config: Card type, capacity and timings, 0 for the default ones
+  *         (HOST_SD_xxx).
+  * @retval SUCCESS, or ERROR if the file can not be mapped
+  */
+ErrorStatus HOST_SDInit(const char* FileName, const HOST_SDConfig_TypeDef* Config)
+{
+  HOST_SDDeInit();
+
+  if (Config != 0)
+  {
+    SDConfig = *Config;
+  }
+  else
+  {
+    SDConfig.Type = HOST_SD_TYPE_HC;
+    SDConfig.ResponseDelay = HOST_SD_NCR;
+    SDConfig.BlockNb = HOST_SD_BLOCK_NB;
+    SDConfig.InitTime = HOST_SD_INIT_TIME;
+    SDConfig.ReadAccessTime = HOST_SD_READ_ACCESS_TIME;
+    SDConfig.MultiBlockReadTime = HOST_SD_MULTI_READ_TIME;
+    SDConfig.BlockWriteTime = HOST_SD_WRITE_TIME;
+    SDConfig.MultiBlockWriteTime = HOST_SD_MULTI_WRITE_TIME;
+    SDConfig.StopWriteTime = HOST_SD_STOP_WRITE_TIME;
+  }
+
+  /* The standard capacity CSD counts 4096 units of 512 blocks at most, the
+     high capacity one units of 1024 blocks */
+  if ((SDConfig.Type == HOST_SD_TYPE_HC) ? ((SDConfig.BlockNb % 1024) != 0) :
+      (((SDConfig.BlockNb % 512) != 0) || (SDConfig.BlockNb > 4096 * 512)))
+  {
+    HOST_Fatal("HOST_SDInit: %lu blocks, not a capacity of the card type",
+               (unsigned long)SDConfig.BlockNb);
+  }
+  if (SDConfig.BlockNb > HOST_SD_BLOCK_NB_MAX)
+  {
+    HOST_Fatal("HOST_SDInit: %lu blocks, more than %lu",
+               (unsigned long)SDConfig.BlockNb, (unsigned long)HOST_SD_BLOCK_NB_MAX);
+  }
+  if (SDConfig.ResponseDelay > 8)
+  {
+    HOST_Fatal("HOST_SDInit: NCR of %u bytes, more than 8",
+               (unsigned)SDConfig.ResponseDelay);
+  }
+
+  /* A new image is zeroed, as an erased card */
+  SDMemory = HOST_FileMap(FileName, SD_Capacity(), 0x00);
+  if (SDMemory == 0)
+  {
+    return ERROR;
+  }
+
+  memset(&SDStatistics, 0, sizeof(SDStatistics));
+  SDSpiMode = RESET;
+  SDIdle = SET;
+  SDInitStarted = RESET;
+  SDAppCommand = RESET;
+  SDCrcOn = RESET;
+  SDBlockLength = SD_BLOCK;
+  SDBusyEnd = 0;
+  SDCommandIndex = 0;
+  SDOutputIn = 0;
+  SDOutputOut = 0;
+  SDState = SD_STATE_COMMAND;
+
+  return SUCCESS;
+}
+
+/**
+  * @brief  Unmaps the image file, its content being kept.
+  * @param  None
+  * @retval None
+  */
+void HOST_SDDeInit(void)
+{
+  if (SDMemory != 0)
+  {
+    HOST_FileUnmap(SDMemory, SD_Capacity());
+    SDMemory = 0;
+  }
+}
+
+/**
+  * @brief  Gives the commands and blocks counted since HOST_SDInit().
+  * @param  Statistics: pointer to the counters.
+  * @retval None
+  */
+void HOST_SDGetStatistics(HOST_SDStatistics_TypeDef* Statistics)
+{
+  *Statistics = SDStatistics;
+}
+
+/**
+  * @brief  Gives the card memory, to check its content.
+  * @param  None
+  * @retval Pointer to the BlockNb blocks of the memory
+  */
+uint8_t* HOST_SDMemory(void)
+{
+  return SDMemory;
+}
+
+/**
+  * @brief  Chip select falling edge.
+  * @param  None
+  * @retval None
+  */
+static void SD_Select(void)
+{
+  if (SDMemory == 0)
+  {
+    HOST_Fatal("SD selected before HOST_SDInit()");
+  }
+}
+
+/**
+  * @brief  Chip select rising edge: the command being received and the
+  *         response bytes not sent are lost.
+  * @param  None
+  * @retval None
+  */
+static void SD_Deselect(void)
+{
+  SDCommandIndex = 0;
+  SDOutputIn = 0;
+  SDOutputOut = 0;
+}
+
+/**
+  * @brief  Byte exchange while the card is selected.
+  * @param  Data: Byte received on DI.
+  * @retval Byte sent on DO
+  */
+static uint8_t SD_Exchange(uint8_t Data)
+{
+  uint8_t data = SD_Output();
+
+  switch (SDState)
+  {
+    case SD_STATE_WRITE_TOKEN:
+      if ((Data == SD_TOKEN_START_BLOCK) && (SDMultiple == RESET))
+      {
+        SDState = SD_STATE_WRITE_DATA;
+        SDDataIndex = 0;
+      }
+      else if ((Data == SD_TOKEN_START_MULTIPLE) && (SDMultiple != RESET))
+      {
+        SDState = SD_STATE_WRITE_DATA;
+        SDDataIndex = 0;
+      }
+      else if ((Data == SD_TOKEN_STOP) && (SDMultiple != RESET))
+      {
+        /* One byte before the busy signal */
+        SD_Send(0xFF);
+        SDBusyEnd = HOST_GetTime() + SDConfig.StopWriteTime;
+        SDState = SD_STATE_COMMAND;
+      }
+      break;
+
+    case SD_STATE_WRITE_DATA:
+      SDBlock[SDDataIndex++] = Data;
+      if (SDDataIndex == sizeof(SDBlock))
+      {
+        SD_WriteEnd();
+      }
+      break;
+
+    default:
+      /* The commands start with 01b */
+      if ((SDCommandIndex == 0) && ((Data & 0xC0) != 0x40))
+      {
+        break;
+      }
+      SDCommand[SDCommandIndex++] = Data;
+      if (SDCommandIndex == sizeof(SDCommand))
+      {
+        SDCommandIndex = 0;
+        SD_Command();
+      }
+      break;
+  }
+
+  return data;
+}
+
+/**
+  * @brief  Gives the next byte sent by the card: a response byte, a byte of
+  *         the block read, or the busy signal.
+  * @param  None
+  * @retval Byte sent on DO
+  */
+static uint8_t SD_Output(void)
+{
+  uint8_t data = 0xFF;
+
+  if (SDOutputOut != SDOutputIn)
+  {
+    return SDOutput[SDOutputOut++ % SD_OUTPUT_SIZE];
+  }
+
+  switch (SDState)
+  {
+    case SD_STATE_READ_TOKEN:
+      if (SDAccessStarted == RESET)
+      {
+        SDAccessStarted = SET;
+        SDAccessEnd = HOST_GetTime() + SDAccessTime;
+      }
+      if (HOST_GetTime() < SDAccessEnd)
+      {
+        break;
+      }
+      if ((SDRegisterRead == RESET) && (SDAddress >= SD_Capacity()))
+      {
+        /* Multiple block read past the end of the memory */
+        SDStatistics.ErrorNb++;
+        SDState = SD_STATE_COMMAND;
+        data = SD_TOKEN_OUT_OF_RANGE;
+        break;
+      }
+      SDState = SD_STATE_READ_DATA;
+      SDDataIndex = 0;
+      SDDataCRC = 0;
+      data = SD_TOKEN_START_BLOCK;
+      break;
+
+    case SD_STATE_READ_DATA:
+      if (SDDataIndex < SDDataSize)
+      {
+        data = SDData[SDDataIndex++];
+        SDDataCRC = SD_CRC16(SDDataCRC, data);
+        break;
+      }
+      if (SDDataIndex == SDDataSize)
+      {
+        SDDataIndex++;
+        data = (uint8_t)(SDDataCRC >> 8);
+        break;
+      }
+
+      /* Last byte of the CRC: the block is sent */
+      data = (uint8_t)SDDataCRC;
+      SDStatistics.ReadBlockNb++;
+      if (SDMultiple != RESET)
+      {
+        SD_StartRead(SDAddress + SDDataSize, SDMemory + SDAddress + SDDataSize,
+                     SDDataSize, SDConfig.MultiBlockReadTime);
+      }
+      else
+      {
+        SDState = SD_STATE_COMMAND;
+      }
+      break;
+
+    default:
+      /* Data output held low while the card is busy */
+      if (HOST_GetTime() < SDBusyEnd)
+      {
+        data = 0x00;
+      }
+      break;
+  }
+
+  return data;
+}
+
+/**
+  * @brief  Runs the command received.
+  * @param  None
+  * @retval None
+  */
+static void SD_Command(void)
+{
+  uint8_t command = (uint8_t)(SDCommand[0] & 0x3F), r1 = 0, data[4];
+  uint32_t argument = ((uint32_t)SDCommand[1] << 24) | ((uint32_t)SDCommand[2] << 16) |
+                      ((uint32_t)SDCommand[3] << 8) | SDCommand[4];
+  uint32_t address = 0, ocr = 0;
+  FlagStatus application = SDAppCommand;
+
+  SDAppCommand = RESET;
+  SDStatistics.CommandNb++;
+
+  if ((SDState == SD_STATE_READ_TOKEN) || (SDState == SD_STATE_READ_DATA))
+  {
+    /* Only CMD12 stops a multiple block read */
+    if ((command != SD_CMD12) || (SDMultiple == RESET))
+    {
+      SDStatistics.ErrorNb++;
+      return;
+    }
+    SDState = SD_STATE_COMMAND;
+    SD_Send(0xFF);
+    SD_Respond(0, 0, 0);
+    return;
+  }
+
+  if ((HOST_GetTime() < SDBusyEnd) || ((SDSpiMode == RESET) && (command != SD_CMD0)))
+  {
+    /* Ignored: card busy, or not in SPI mode yet */
+    SDStatistics.ErrorNb++;
+    return;
+  }
+
+  if (((SDCrcOn != RESET) || (command == SD_CMD0) || (command == SD_CMD8)) &&
+      (SD_CRC7(SDCommand, 5) != SDCommand[5]))
+  {
+    SDStatistics.ErrorNb++;
+    SD_Respond((uint8_t)(((SDIdle != RESET) ? SD_R1_IDLE : 0) | SD_R1_COM_CRC_ERROR), 0, 0);
+    return;
+  }
+
+  r1 = (SDIdle != RESET) ? SD_R1_IDLE : 0;
+
+  if (application != RESET)
+  {
+    if (command == SD_ACMD41)
+    {
+      /* A high capacity card stays idle without HCS */
+      if ((SDConfig.Type == HOST_SD_TYPE_HC) && ((argument & SD_HCS) == 0))
+      {
+        SD_Respond(r1, 0, 0);
+      }
+      else
+      {
+        SD_Respond(SD_Initialize(), 0, 0);
+      }
+      return;
+    }
+    if ((command == SD_ACMD23) && (SDIdle == RESET))
+    {
+      /* The blocks to pre-erase are only a hint */
+      SD_Respond(r1, 0, 0);
+      return;
+    }
+    SDStatistics.IllegalNb++;
+    SD_Respond((uint8_t)(r1 | SD_R1_ILLEGAL_COMMAND), 0, 0);
+    return;
+  }
+
+  switch (command)
+  {
+    case SD_CMD0:
+      SDSpiMode = SET;
+      SDIdle = SET;
+      SDInitStarted = RESET;
+      SDCrcOn = RESET;
+      SDBlockLength = SD_BLOCK;
+      SD_Respond(SD_R1_IDLE, 0, 0);
+      return;
+
+    case SD_CMD1:
+      if ((SDConfig.Type == HOST_SD_TYPE_MMC) || (SDConfig.Type == HOST_SD_TYPE_V1))
+      {
+        SD_Respond(SD_Initialize(), 0, 0);
+        return;
+      }
+      break;
+
+    case SD_CMD8:
+      if ((SDConfig.Type == HOST_SD_TYPE_V2) || (SDConfig.Type == HOST_SD_TYPE_HC))
+      {
+        /* R7: the voltage accepted and the check pattern are echoed */
+        data[0] = 0x00;
+        data[1] = 0x00;
+        data[2] = (uint8_t)((argument >> 8) & 0x0F);
+        data[3] = (uint8_t)argument;
+        SD_Respond(r1, data, 4);
+        return;
+      }
+      break;
+
+    case SD_CMD9:
+    case SD_CMD10:
+      if (SDIdle != RESET)
+      {
+        break;
+      }
+      if (command == SD_CMD9)
+      {
+        SD_CSD(SDRegister);
+      }
+      else
+      {
+        SD_CID(SDRegister);
+      }
+      SD_Respond(r1, 0, 0);
+      SDMultiple = RESET;
+      SDRegisterRead = SET;
+      SD_StartRead(0, SDRegister, sizeof(SDRegister), 0);
+      return;
+
+    case SD_CMD13:
+      /* R2: no error in the card status */
+      data[0] = 0x00;
+      SD_Respond(r1, data, 1);
+      return;
+
+    case SD_CMD16:
+      if (SDIdle != RESET)
+      {
+        break;
+      }
+      /* The high capacity cards have a fixed block length */
+      if ((argument == 0) || (argument > SD_BLOCK))
+      {
+        SDStatistics.ErrorNb++;
+        SD_Respond((uint8_t)(r1 | SD_R1_PARAMETER_ERROR), 0, 0);
+        return;
+      }
+      if (SDConfig.Type != HOST_SD_TYPE_HC)
+      {
+        SDBlockLength = argument;
+      }
+      SD_Respond(r1, 0, 0);
+      return;
+
+    case SD_CMD17:
+    case SD_CMD18:
+    case SD_CMD24:
+    case SD_CMD25:
+      if (SDIdle != RESET)
+      {
+        break;
+      }
+      address = (SDConfig.Type == HOST_SD_TYPE_HC) ? (argument * SD_BLOCK) : argument;
+      if (((SDConfig.Type == HOST_SD_TYPE_HC) && (argument >= SDConfig.BlockNb)) ||
+          (address > SD_Capacity() - SDBlockLength) ||
+          (((command == SD_CMD24) || (command == SD_CMD25)) && (SDBlockLength != SD_BLOCK)))
+      {
+        SDStatistics.ErrorNb++;
+        SD_Respond((uint8_t)(r1 | SD_R1_PARAMETER_ERROR), 0, 0);
+        return;
+      }
+      SD_Respond(r1, 0, 0);
+      SDMultiple = ((command == SD_CMD18) || (command == SD_CMD25)) ? SET : RESET;
+      SDRegisterRead = RESET;
+      if ((command == SD_CMD17) || (command == SD_CMD18))
+      {
+        SD_StartRead(address, SDMemory + address, (uint16_t)SDBlockLength,
+                     SDConfig.ReadAccessTime);
+      }
+      else
+      {
+        SDAddress = address;
+        SDState = SD_STATE_WRITE_TOKEN;
+      }
+      return;
+
+    case SD_CMD55:
+      if (SDConfig.Type != HOST_SD_TYPE_MMC)
+      {
+        SDAppCommand = SET;
+        SD_Respond(r1, 0, 0);
+        return;
+      }
+      break;
+
+    case SD_CMD58:
+      /* R3: the CCS bit is valid once the card is initialized */
+      ocr = SD_OCR_VDD;
+      if (SDIdle == RESET)
+      {
+        ocr |= SD_OCR_BUSY;
+        if (SDConfig.Type == HOST_SD_TYPE_HC)
+        {
+          ocr |= SD_OCR_CCS;
+        }
+      }
+      data[0] = (uint8_t)(ocr >> 24);
+      data[1] = (uint8_t)(ocr >> 16);
+      data[2] = (uint8_t)(ocr >> 8);
+      data[3] = (uint8_t)ocr;
+      SD_Respond(r1, data, 4);
+      return;
+
+    case SD_CMD59:
+      SDCrcOn = ((argument & 0x01) != 0) ? SET : RESET;
+      SD_Respond(r1, 0, 0);
+      return;
+
+    default:
+      break;
+  }
+
+  SDStatistics.IllegalNb++;
+  SD_Respond((uint8_t)(r1 | SD_R1_ILLEGAL_COMMAND), 0, 0);
+}
+
+/**
+  * @brief  Ends the reception of a block written: programs it and sends its
+  *         data response.
+  * @param  None
+  * @retval None
+  */
+static void SD_WriteEnd(void)
+{
+  uint16_t crc = 0, i = 0;
+
+  if (SDCrcOn != RESET)
+  {
+    for (i = 0; i < SD_BLOCK; i++)
+    {
+      crc = SD_CRC16(crc, SDBlock[i]);
+    }
+  }
+
+  if ((SDCrcOn != RESET) &&
+      (crc != (uint16_t)((SDBlock[SD_BLOCK] << 8) | SDBlock[SD_BLOCK + 1])))
+  {
+    SDStatistics.ErrorNb++;
+    SD_Send(SD_DATA_CRC_REJECTED);
+  }
+  else if (SDAddress + SD_BLOCK > SD_Capacity())
+  {
+    /* Multiple block write past the end of the memory */
+    SDStatistics.ErrorNb++;
+    SD_Send(SD_DATA_WRITE_REJECTED);
+  }
+  else
+  {
+    memcpy(SDMemory + SDAddress, SDBlock, SD_BLOCK);
+    SDStatistics.WriteBlockNb++;
+    SD_Send(SD_DATA_ACCEPTED);
+    SDBusyEnd = HOST_GetTime() +
+                ((SDMultiple != RESET) ? SDConfig.MultiBlockWriteTime : SDConfig.BlockWriteTime);
+    SDAddress += SD_BLOCK;
+  }
+
+  SDState = (SDMultiple != RESET) ? SD_STATE_WRITE_TOKEN : SD_STATE_COMMAND;
+}
+
+/**
+  * @brief  Runs the initialization process started by the first ACMD41 or
+  *         CMD1.
+  * @param  None
+  * @retval R1 response: idle until InitTime has elapsed
+  */
+static uint8_t SD_Initialize(void)
+{
+  if (SDInitStarted == RESET)
+  {
+    SDInitStarted = SET;
+    SDInitStart = HOST_GetTime();
+  }
+
+  if ((HOST_GetTime() - SDInitStart) >= SDConfig.InitTime)
+  {
+    SDIdle = RESET;
+  }
+
+  return (SDIdle != RESET) ? SD_R1_IDLE : 0;
+}
+
+/**
+  * @brief  Sends a response after the NCR bytes.
+  * @param  R1: R1 response.
+  * @param  Data: Bytes following R1 (R2, R3 or R7 responses), 0 if none.
+  * @param  Size: Number of bytes following R1.
+  * @retval None
+  */
+static void SD_Respond(uint8_t R1, const uint8_t* Data, uint8_t Size)
+{
+  uint8_t i = 0;
+
+  for (i = 0; i < SDConfig.ResponseDelay; i++)
+  {
+    SD_Send(0xFF);
+  }
+  SD_Send(R1);
+  for (i = 0; i < Size; i++)
+  {
+    SD_Send(Data[i]);
+  }
+}
+
+/**
+  * @brief  Queues a response byte.
+  * @param  Data: Byte.
+  * @retval None
+  */
+static void SD_Send(uint8_t Data)
+{
+  SDOutput[SDOutputIn++ % SD_OUTPUT_SIZE] = Data;
+}
+
+/**
+  * @brief  Starts sending a block: its data token comes after the access
+  *         time.
+  * @param  Address: Address of the block in the memory.
+  * @param  Data: Data of the block.
+  * @param  Size: Size of the block.
+  * @param  AccessTime: Time before the data token.
+  * @retval None
+  */
+static void SD_StartRead(uint32_t Address, const uint8_t* Data, uint16_t Size,
+                         HOST_Time_TypeDef AccessTime)
+{
+  SDAddress = Address;
+  SDData = Data;
+  SDDataSize = Size;
+  SDAccessTime = AccessTime;
+  SDAccessStarted = RESET;
+  SDState = SD_STATE_READ_TOKEN;
+}
+
+/**
+  * @brief  Gives the card capacity.
+  * @param  None
+  * @retval Capacity, in bytes
+  */
+static uint32_t SD_Capacity(void)
+{
+  return SDConfig.BlockNb * SD_BLOCK;
+}
+
+/**
+  * @brief  Builds the CSD register: version 2.0 for the high capacity cards,
+  *         version 1.0 with 512-byte blocks for the others.
+  * @param  CSD: 16 bytes of the register.
+  * @retval None
+  */
+static void SD_CSD(uint8_t* CSD)
+{
+  uint32_t size = 0;
+
+  memset(CSD, 0, 16);
+
+  if (SDConfig.Type == HOST_SD_TYPE_HC)
+  {
+    /* Capacity: (C_SIZE + 1) * 512 Kbytes */
+    size = SDConfig.BlockNb / 1024 - 1;
+    CSD[0] = 0x40;
+    CSD[1] = 0x0E;                        /* TAAC: 1 ms */
+    CSD[3] = 0x32;                        /* TRAN_SPEED: 25 MHz */
+    CSD[4] = 0x5B;
+    CSD[5] = 0x59;                        /* CCC, READ_BL_LEN: 512 */
+    CSD[7] = (uint8_t)((size >> 16) & 0x3F);
+    CSD[8] = (uint8_t)(size >> 8);
+    CSD[9] = (uint8_t)size;
+    CSD[10] = 0x7F;                       /* ERASE_BLK_EN, SECTOR_SIZE */
+    CSD[11] = 0x80;
+    CSD[12] = 0x0A;                       /* R2W_FACTOR, WRITE_BL_LEN: 512 */
+    CSD[13] = 0x40;
+  }
+  else
+  {
+    /* Capacity: (C_SIZE + 1) * 2^(C_SIZE_MULT + 2) * 2^READ_BL_LEN bytes,
+       C_SIZE_MULT being 7 */
+    size = SDConfig.BlockNb / 512 - 1;
+    CSD[1] = 0x26;                        /* TAAC: 1.5 ms */
+    CSD[3] = 0x32;                        /* TRAN_SPEED: 25 MHz */
+    CSD[4] = 0x5F;
+    CSD[5] = 0x59;                        /* CCC, READ_BL_LEN: 512 */
+    CSD[6] = (uint8_t)(0x80 | ((size >> 10) & 0x03)); /* READ_BL_PARTIAL */
+    CSD[7] = (uint8_t)(size >> 2);
+    CSD[8] = (uint8_t)(((size & 0x03) << 6) | 0x2D);  /* VDD_R_CURR */
+    CSD[9] = 0xB7;                        /* VDD_W_CURR, C_SIZE_MULT */
+    CSD[10] = 0xFF;                       /* ERASE_BLK_EN, SECTOR_SIZE */
+    CSD[11] = 0x80;
+    CSD[12] = 0x16;                       /* R2W_FACTOR, WRITE_BL_LEN: 512 */
+    CSD[13] = 0x40;
+  }
+
+  CSD[15] = SD_CRC7(CSD, 15);
+}
+
+/**
+  * @brief  Builds the CID register.
+  * @param  CID: 16 bytes of the register.
+  * @retval None
+  */
+static void SD_CID(uint8_t* CID)
+{
+  static const uint8_t cid[15] =
+    {
+      0x02, 'S', 'T', 'H', 'O', 'S', 'T', '8', /* MID, OID, PNM */
+      0x10, 0x00, 0x00, 0x20, 0x10,            /* PRV, PSN */
+      0x00, 0xA9                               /* MDT: 09/2010 */
+    };
+
+  memcpy(CID, cid, sizeof(cid));
+  CID[15] = SD_CRC7(CID, 15);
+}
+
+/**
+  * @brief  Computes the CRC7 of a command or of a register.
+  * @param  Data: Bytes.
+  * @param  Size: Number of bytes.
+  * @retval CRC7 in the 7 upper bits, followed by the end bit
+  */
+static uint8_t SD_CRC7(const uint8_t* Data, uint8_t Size)
+{
+  uint8_t crc = 0, i = 0, bit = 0;
+
+  for (i = 0; i < Size; i++)
+  {
+    crc ^= Data[i];
+    for (bit = 0; bit < 8; bit++)
+    {
+      /* Polynomial x^7 + x^3 + 1, shifted left by one */
+      crc = (uint8_t)(((crc & 0x80) != 0) ? ((crc << 1) ^ 0x12) : (crc << 1));
+    }
+  }
+
+  return (uint8_t)(crc | 0x01);
+}
+
+/**
+  * @brief  Adds a byte to the CRC16 of a block.
+  * @param  CRC: CRC of the previous bytes.
+  * @param  Data: Byte.
+  * @retval CRC
+  */
+static uint16_t SD_CRC16(uint16_t CRC, uint8_t Data)
+{
+  uint8_t bit = 0;
+
+  CRC ^= (uint16_t)((uint16_t)Data << 8);
+  for (bit = 0; bit < 8; bit++)
+  {
+    /* Polynomial x^16 + x^12 + x^5 + 1 */
+    CRC = (uint16_t)(((CRC & 0x8000) != 0) ? ((CRC << 1) ^ 0x1021) : (CRC << 1));
+  }
+
+  return CRC;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,417 @@
+/**
+  ******************************************************************************
+  * @file    host_spi.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host model of the SPI buses, built instead of stm8l15x_spi.c.
+  *
+  *          @note The registers are the ones of HostIO[], written as the
+  *                library does. SPI_SendData() exchanges the byte at once
+  *                with the devices selected on the bus and advances the
+  *                simulated time by the byte time of the SPI clock: TXE is
+  *                always set, RXNE is set until the data is read, and OVR
+  *                when a byte is received while RXNE is set. A bus without
+  *                device selected reads 0xFF. The hardware CRC is computed
+  *                on the bytes transmitted and received while CRCEN is set.
+  *
+  *          @note The devices are attached to a bus with the GPIO pin that
+  *                selects them, driven low: HOST_SPIPinChange(), called by
+  *                the GPIO model on each output change, gives them the edges
+  *                of their chip select.
+  *
+  *          @note The DMA requests are served by the DMA model (host_dma.c):
+  *                SPI_DMACmd() runs the transfers of the channels enabled.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "host.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Device attached to a SPI bus
+  */
+typedef struct
+{
+  SPI_TypeDef* SPIx;                    /*!< Bus */
+  GPIO_TypeDef* GPIOx;                  /*!< Port of the chip select */
+  uint8_t GPIO_Pin;                     /*!< Pin of the chip select */
+  const HOST_SPIDevice_TypeDef* Device; /*!< Device model */
+  FlagStatus Selected;                  /*!< SET while the pin is driven low */
+}SPI_Slave_TypeDef;
+
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static SPI_Slave_TypeDef SPISlave[HOST_SPI_DEVICE_NB];
+static uint8_t SPISlaveNb = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static uint8_t SPI_CRC(uint8_t CRC, uint8_t Data, uint8_t Polynomial);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Deinitializes the SPI peripheral registers to their default reset values.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @retval None
+  */
+void SPI_DeInit(SPI_TypeDef* SPIx)
+{
+  SPIx->CR1    = SPI_CR1_RESET_VALUE;
+  SPIx->CR2    = SPI_CR2_RESET_VALUE;
+  SPIx->CR3    = SPI_CR3_RESET_VALUE;
+  SPIx->SR     = SPI_SR_RESET_VALUE;
+  SPIx->CRCPR  = SPI_CRCPR_RESET_VALUE;
+}
+
+/**
+  * @brief  Initializes the SPI according to the specified parameters.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  SPI_FirstBit: This parameter can be any of the SPI_FirstBit_TypeDef.
+  * @param  SPI_BaudRatePrescaler: This parameter can be any of the
+  *         SPI_BaudRatePrescaler_TypeDef.
+  * @param  SPI_Mode: This parameter can be any of the SPI_Mode_TypeDef.
+  * @param  SPI_CPOL: This parameter can be any of the SPI_CPOL_TypeDef.
+  * @param  SPI_CPHA: This parameter can be any of the SPI_CPHA_TypeDef.
+  * @param  SPI_Data_Direction: This parameter can be any of the
+  *         SPI_DirectionMode_TypeDef.
+  * @param  SPI_Slave_Management: This parameter can be any of the SPI_NSS_TypeDef.
+  * @param  CRCPolynomial: Configures the CRC polynomial.
+  * @retval None
+  */
+void SPI_Init(SPI_TypeDef* SPIx, SPI_FirstBit_TypeDef SPI_FirstBit,
+              SPI_BaudRatePrescaler_TypeDef SPI_BaudRatePrescaler,
+              SPI_Mode_TypeDef SPI_Mode, SPI_CPOL_TypeDef SPI_CPOL,
+              SPI_CPHA_TypeDef SPI_CPHA, SPI_DirectionMode_TypeDef SPI_Data_Direction,
+              SPI_NSS_TypeDef SPI_Slave_Management, uint8_t CRCPolynomial)
+{
+  SPIx->CR1 = (uint8_t)((uint8_t)((uint8_t)SPI_FirstBit |
+                                  (uint8_t)SPI_BaudRatePrescaler) |
+                        (uint8_t)((uint8_t)SPI_CPOL |
+                                  SPI_CPHA));
+
+  SPIx->CR2 = (uint8_t)((uint8_t)(SPI_Data_Direction) | (uint8_t)(SPI_Slave_Management));
+
+  if (SPI_Mode == SPI_Mode_Master)
+  {
+    SPIx->CR2 |= (uint8_t)SPI_CR2_SSI;
+  }
+  else
+  {
+    SPIx->CR2 &= (uint8_t)~(SPI_CR2_SSI);
+  }
+
+  SPIx->CR1 |= (uint8_t)(SPI_Mode);
+
+  SPIx->CRCPR = (uint8_t)CRCPolynomial;
+}
+
+/**
+  * @brief  Enables or disables the SPI peripheral.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  NewState New state of the SPI peripheral.
+  * @retval None
+  */
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState NewState)
+{
+  if (NewState != DISABLE)
+  {
+    SPIx->CR1 |= SPI_CR1_SPE;
+    SPIx->SR |= SPI_SR_TXE;
+  }
+  else
+  {
+    SPIx->CR1 &= (uint8_t)(~SPI_CR1_SPE);
+  }
+}
+
+/**
+  * @brief  Transmits a byte, exchanged at once with the selected devices.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  Data: Byte to be transmitted.
+  * @retval None
+  */
+void SPI_SendData(SPI_TypeDef* SPIx, uint8_t Data)
+{
+  uint8_t data = 0xFF, slave = 0;
+
+  if ((SPIx->CR1 & SPI_CR1_SPE) == 0)
+  {
+    /* The byte would never be received: the driver would wait forever */
+    HOST_Fatal("SPI at 0x%04X: byte sent while the SPI is disabled",
+               (unsigned)((uint8_t*)SPIx - HostIO));
+  }
+
+  for (slave = 0; slave < SPISlaveNb; slave++)
+  {
+    if ((SPISlave[slave].SPIx == SPIx) && (SPISlave[slave].Selected != RESET))
+    {
+      data &= SPISlave[slave].Device->Exchange(Data);
+    }
+  }
+
+  HOST_Wait(HOST_SPIByteTime(SPIx));
+
+  if ((SPIx->CR2 & SPI_CR2_CRCEN) != 0)
+  {
+    SPIx->TXCRCR = SPI_CRC(SPIx->TXCRCR, Data, SPIx->CRCPR);
+    SPIx->RXCRCR = SPI_CRC(SPIx->RXCRCR, data, SPIx->CRCPR);
+  }
+
+  if ((SPIx->SR & SPI_SR_RXNE) != 0)
+  {
+    /* The received byte is lost */
+    SPIx->SR |= SPI_SR_OVR;
+  }
+  else
+  {
+    SPIx->DR = data;
+    SPIx->SR |= SPI_SR_RXNE;
+  }
+}
+
+/**
+  * @brief  Returns the most recent received data by the SPI peripheral.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @retval The value of the received data.
+  */
+uint8_t SPI_ReceiveData(SPI_TypeDef* SPIx)
+{
+  SPIx->SR &= (uint8_t)(~SPI_SR_RXNE);
+
+  return ((uint8_t)SPIx->DR);
+}
+
+/**
+  * @brief  Enables or disables the SPI CRC calculation, the CRC registers
+  *         being reset when it is enabled.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  NewState: Indicates if the CRC calculation is enabled or disabled.
+  * @retval None
+  */
+void SPI_CalculateCRCCmd(SPI_TypeDef* SPIx, FunctionalState NewState)
+{
+  SPI_Cmd(SPIx, DISABLE);
+
+  if (NewState != DISABLE)
+  {
+    SPIx->CR2 |= SPI_CR2_CRCEN;
+    SPIx->TXCRCR = 0;
+    SPIx->RXCRCR = 0;
+  }
+  else
+  {
+    SPIx->CR2 &= (uint8_t)(~SPI_CR2_CRCEN);
+  }
+}
+
+/**
+  * @brief  Returns the transmit or the receive CRC register value.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  SPI_CRC: Specifies the CRC register to be read.
+  * @retval The selected CRC register value.
+  */
+uint8_t SPI_GetCRC(SPI_TypeDef* SPIx, SPI_CRC_TypeDef SPI_CRC)
+{
+  if (SPI_CRC != SPI_CRC_RX)
+  {
+    return SPIx->TXCRCR;
+  }
+
+  return SPIx->RXCRCR;
+}
+
+/**
+  * @brief  Reset the Rx CRCR and Tx CRCR registers.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @retval None
+  */
+void SPI_ResetCRC(SPI_TypeDef* SPIx)
+{
+  SPI_CalculateCRCCmd(SPIx, ENABLE);
+
+  SPI_Cmd(SPIx, ENABLE);
+}
+
+/**
+  * @brief  Returns the CRC Polynomial register value.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @retval The CRC Polynomial register value.
+  */
+uint8_t SPI_GetCRCPolynomial(SPI_TypeDef* SPIx)
+{
+  return SPIx->CRCPR;
+}
+
+/**
+  * @brief  Enables or disables the SPI DMA interface.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  SPI_DMAReq Specifies the SPI DMA transfer request to be enabled or disabled.
+  * @param  NewState Indicates the new state of the SPI DMA request.
+  * @retval None
+  */
+void SPI_DMACmd(SPI_TypeDef* SPIx, SPI_DMAReq_TypeDef SPI_DMAReq, FunctionalState NewState)
+{
+  if (NewState != DISABLE)
+  {
+    SPIx->CR3 |= (uint8_t) SPI_DMAReq;
+
+    /* The DMA channels enabled run at once */
+    HOST_DMARequest();
+  }
+  else
+  {
+    SPIx->CR3 &= (uint8_t)~SPI_DMAReq;
+  }
+}
+
+/**
+  * @brief  Checks whether the specified SPI flag is set or not: reading OVR
+  *         clears it, the data register having been read.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  SPI_FLAG: Specifies the flag to check.
+  * @retval Indicates the state of SPI_FLAG.
+  */
+FlagStatus SPI_GetFlagStatus(SPI_TypeDef* SPIx, SPI_FLAG_TypeDef SPI_FLAG)
+{
+  FlagStatus status = RESET;
+
+  if ((SPIx->SR & (uint8_t)SPI_FLAG) != (uint8_t)RESET)
+  {
+    status = SET;
+  }
+
+  if (SPI_FLAG == SPI_FLAG_OVR)
+  {
+    SPIx->SR &= (uint8_t)(~SPI_SR_OVR);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Clears the SPI flags.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  SPI_FLAG: Specifies the flag to clear.
+  * @retval None
+  */
+void SPI_ClearFlag(SPI_TypeDef* SPIx, SPI_FLAG_TypeDef SPI_FLAG)
+{
+  SPIx->SR &= (uint8_t)(~SPI_FLAG);
+}
+
+/**
+  * @brief  Attaches a device to a SPI bus.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @param  GPIOx: Port of the chip select of the device.
+  * @param  GPIO_Pin: Pin of the chip select of the device, driven low to
+  *         select it.
+  * @param  Device: Device model.
+  * @retval None
+  */
+void HOST_SPIAttach(SPI_TypeDef* SPIx, GPIO_TypeDef* GPIOx, uint8_t GPIO_Pin,
+                    const HOST_SPIDevice_TypeDef* Device)
+{
+  if (SPISlaveNb == HOST_SPI_DEVICE_NB)
+  {
+    HOST_Fatal("HOST_SPIAttach: more than %u devices", (unsigned)HOST_SPI_DEVICE_NB);
+  }
+
+  SPISlave[SPISlaveNb].SPIx = SPIx;
+  SPISlave[SPISlaveNb].GPIOx = GPIOx;
+  SPISlave[SPISlaveNb].GPIO_Pin = GPIO_Pin;
+  SPISlave[SPISlaveNb].Device = Device;
+  SPISlave[SPISlaveNb].Selected = RESET;
+  SPISlaveNb++;
+
+  HOST_SPIPinChange(GPIOx);
+}
+
+/**
+  * @brief  Gives the edges of their chip select to the devices selected by a
+  *         GPIO port, after a change of its registers.
+  * @param  GPIOx: Select the GPIO peripheral number (x = A to I).
+  * @retval None
+  */
+void HOST_SPIPinChange(GPIO_TypeDef* GPIOx)
+{
+  uint8_t slave = 0;
+  FlagStatus selected = RESET;
+
+  for (slave = 0; slave < SPISlaveNb; slave++)
+  {
+    if (SPISlave[slave].GPIOx != GPIOx)
+    {
+      continue;
+    }
+
+    /* Selected by an output driven low */
+    selected = RESET;
+    if (((GPIOx->DDR & SPISlave[slave].GPIO_Pin) != 0) &&
+        ((GPIOx->ODR & SPISlave[slave].GPIO_Pin) == 0))
+    {
+      selected = SET;
+    }
+
+    if (selected != SPISlave[slave].Selected)
+    {
+      SPISlave[slave].Selected = selected;
+      if (selected != RESET)
+      {
+        SPISlave[slave].Device->Select();
+      }
+      else
+      {
+        SPISlave[slave].Device->Deselect();
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Gives the time of a byte transfer at the SPI clock.
+  * @param  SPIx: where x can be 1 or 2 to select the specified SPI peripheral.
+  * @retval Byte time, in ns
+  */
+HOST_Time_TypeDef HOST_SPIByteTime(SPI_TypeDef* SPIx)
+{
+  uint8_t prescaler = (uint8_t)((SPIx->CR1 & SPI_CR1_BR) >> 3);
+
+  return ((HOST_Time_TypeDef)8 * ((HOST_Time_TypeDef)2 << prescaler) * 1000000000ULL) /
+         HOST_SYSCLK;
+}
+
+/**
+  * @brief  Adds a byte to a CRC, as the SPI does: MSB first, the polynomial
+  *         x^8 term being implicit.
+  * @param  CRC: CRC of the previous bytes.
+  * @param  Data: Byte.
+  * @param  Polynomial: CRC polynomial register.
+  * @retval CRC
+  */
+static uint8_t SPI_CRC(uint8_t CRC, uint8_t Data, uint8_t Polynomial)
+{
+  uint8_t bit = 0;
+
+  CRC ^= Data;
+  for (bit = 0; bit < 8; bit++)
+  {
+    CRC = (uint8_t)(((CRC & 0x80) != 0) ? ((CRC << 1) ^ Polynomial) : (CRC << 1));
+  }
+
+  return CRC;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
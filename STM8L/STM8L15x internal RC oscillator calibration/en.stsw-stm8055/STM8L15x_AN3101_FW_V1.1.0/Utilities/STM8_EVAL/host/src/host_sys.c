@@ -0,0 +1,227 @@
+/**
+  ******************************************************************************
+  * @file    host_sys.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host system services used by the models: image files mapped by
+  *          mmap(), STM8 RAM addresses, timer interrupt and the errors that
+  *          stop the program.
+  *
+  *          @note The STM8 drivers give the DMA the 16-bit address of their
+  *                buffers, which are static variables: HOST_RAMAddress()
+  *                finds the host address in the static data of the program,
+  *                which must then be smaller than 64 Kbytes.
+  *
+  *          @note The driver functions which wait in a loop for their
+  *                interrupt routines are run with HOST_TimerStart(): the
+  *                routine is called from the SIGALRM handler, as from a
+  *                timer interrupt.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include "host_sys.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+/* Static data of the program, given by the linker */
+extern char __data_start[];
+extern char _end[];
+
+/* Routine of the timer interrupt */
+static void (*HostTimerHandler)(void) = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void HOST_TimerSignal(int Signal);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Maps an image file to memory, its changes being written to the
+  *         file. A new file, or one of another size, is resized and filled:
+  *         a file filled with zeros is left sparse.
+  * @param  FileName: Image file.
+  * @param  Size: Image size, in bytes.
+  * @param  Fill: Value of the bytes of a new image.
+  * @retval Pointer to the image, 0 if the file can not be mapped
+  */
+unsigned char* HOST_FileMap(const char* FileName, unsigned long Size,
+                            unsigned char Fill)
+{
+  struct stat status;
+  unsigned char* memory = 0;
+  int file = 0, fill = 0;
+
+  file = open(FileName, O_RDWR | O_CREAT, 0644);
+  if ((file < 0) || (fstat(file, &status) != 0))
+  {
+    perror(FileName);
+    return 0;
+  }
+
+  if (status.st_size != (off_t)Size)
+  {
+    /* The file is emptied first: the bytes added by ftruncate() read zero */
+    if ((ftruncate(file, 0) != 0) || (ftruncate(file, (off_t)Size) != 0))
+    {
+      perror(FileName);
+      close(file);
+      return 0;
+    }
+    fill = (Fill != 0) ? 1 : 0;
+  }
+
+  memory = (unsigned char*)mmap(0, Size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  /* The mapping stays valid once the file is closed */
+  close(file);
+  if (memory == (unsigned char*)MAP_FAILED)
+  {
+    perror(FileName);
+    return 0;
+  }
+
+  if (fill != 0)
+  {
+    memset(memory, Fill, Size);
+  }
+
+  return memory;
+}
+
+/**
+  * @brief  Unmaps an image file, its content being kept.
+  * @param  Memory: Pointer to the image.
+  * @param  Size: Image size, in bytes.
+  * @retval None
+  */
+void HOST_FileUnmap(unsigned char* Memory, unsigned long Size)
+{
+  munmap(Memory, Size);
+}
+
+/**
+  * @brief  Gives the host address of a static variable from its 16-bit STM8
+  *         address, as given to the DMA.
+  * @param  Address: Address truncated to 16 bits.
+  * @retval Pointer to the variable
+  */
+unsigned char* HOST_RAMAddress(unsigned short Address)
+{
+  uintptr_t start = (uintptr_t)__data_start, end = (uintptr_t)_end;
+  uintptr_t address = 0;
+
+  if ((end - start) > 0x10000)
+  {
+    HOST_Fatal("HOST_RAMAddress: %lu bytes of static data, more than 64 Kbytes",
+               (unsigned long)(end - start));
+  }
+
+  address = (start & ~(uintptr_t)0xFFFF) | Address;
+  if (address < start)
+  {
+    address += 0x10000;
+  }
+  if (address >= end)
+  {
+    HOST_Fatal("HOST_RAMAddress: 0x%04X is not a static variable", (unsigned)Address);
+  }
+
+  return (unsigned char*)address;
+}
+
+/**
+  * @brief  Starts calling a routine periodically, as a timer interrupt, until
+  *         HOST_TimerStop().
+  * @param  Handler: Interrupt routine.
+  * @param  Period: Period, in us of real time.
+  * @retval None
+  */
+void HOST_TimerStart(void (*Handler)(void), unsigned long Period)
+{
+  struct sigaction action;
+  struct itimerval timer;
+
+  HostTimerHandler = Handler;
+
+  memset(&action, 0, sizeof(action));
+  action.sa_handler = HOST_TimerSignal;
+  sigemptyset(&action.sa_mask);
+  sigaction(SIGALRM, &action, 0);
+
+  timer.it_value.tv_sec = (time_t)(Period / 1000000);
+  timer.it_value.tv_usec = (suseconds_t)(Period % 1000000);
+  timer.it_interval = timer.it_value;
+  setitimer(ITIMER_REAL, &timer, 0);
+}
+
+/**
+  * @brief  Stops the timer interrupt started by HOST_TimerStart().
+  * @param  None
+  * @retval None
+  */
+void HOST_TimerStop(void)
+{
+  struct itimerval timer;
+
+  memset(&timer, 0, sizeof(timer));
+  setitimer(ITIMER_REAL, &timer, 0);
+  HostTimerHandler = 0;
+}
+
+/**
+  * @brief  Reports an error that prevents the program to go on, and stops it.
+  * @param  Format: printf() format of the message, followed by its arguments.
+  * @retval None
+  */
+void HOST_Fatal(const char* Format, ...)
+{
+  va_list arguments;
+
+  va_start(arguments, Format);
+  vfprintf(stderr, Format, arguments);
+  va_end(arguments);
+  fputc('\n', stderr);
+
+  exit(1);
+}
+
+/**
+  * @brief  SIGALRM handler: calls the routine of the timer interrupt.
+  * @param  Signal: Signal number.
+  * @retval None
+  */
+static void HOST_TimerSignal(int Signal)
+{
+  (void)Signal;
+
+  if (HostTimerHandler != 0)
+  {
+    HostTimerHandler();
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,261 @@
+/**
+  ******************************************************************************
+  * @file    glass_char_test.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host test of the characters of the 1526 and 1528 glass LCD
+  *          drivers: the LCD RAM written by LCD_GLASS_WriteChar() through
+  *          GlyphMap[] is compared, bit for bit and in both banks, with the
+  *          one written by the reference LCD_GLASS_WriteChar() built on
+  *          LetterMap[] and NumberMap[].
+  *
+  *          @note Every character code is written at every position, the one
+  *                out of the glass included, with every point and apostrophe
+  *                (double point) combination. The characters are written one
+  *                over the other, so that the segments of the previous
+  *                character are cleared. The printable characters other than
+  *                the upper case letters, the numbers and the space have no
+  *                reference glyph: the reference displays them blank, they
+  *                are written but not compared.
+  *          @note The cells of a position are the LCD RAM bits cleared by the
+  *                reference when it writes a space there, and the ones it
+  *                sets for the point and the apostrophe (double point). They
+  *                are compared with the reference, the other bits must stay
+  *                blank. The 1528 'W' coding of the former letter map sets
+  *                the SEG(n) COM1 bit, which is not a segment and that the
+  *                reference never clears: the reference leaves it set in the
+  *                LCD RAM, the driver does not write it.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#ifdef USE_STM8L1526_EVAL
+ #include "stm8l1526_eval_glass_lcd.h"
+#else
+ #include "stm8l1528_eval_glass_lcd.h"
+#endif /* USE_STM8L1526_EVAL */
+
+/* Reference functions, renamed */
+#define LCD_GLASS_WriteChar REF_WriteChar
+#ifdef USE_STM8L1526_EVAL
+ #define BOARD_NAME      "1526"
+ #define EXTRA_ON        APOSTROPHE_ON
+ #define EXTRA_OFF       APOSTROPHE_OFF
+ typedef Apostrophe_Typedef Extra_TypeDef;
+ void REF_WriteChar(uint8_t* ch, Point_Typedef point,
+                    Apostrophe_Typedef apostrophe, uint8_t position);
+ #include "stm8l1526_eval_glass_char.c"
+#else
+ #define BOARD_NAME      "1528"
+ #define EXTRA_ON        DOUBLEPOINT_ON
+ #define EXTRA_OFF       DOUBLEPOINT_OFF
+ typedef DoublePoint_Typedef Extra_TypeDef;
+ void REF_WriteChar(uint8_t* ch, Point_Typedef Point,
+                    DoublePoint_Typedef DoublePoint, uint8_t Position);
+ #include "stm8l1528_eval_glass_char.c"
+#endif /* USE_STM8L1526_EVAL */
+#undef LCD_GLASS_WriteChar
+
+/* Private typedef -----------------------------------------------------------*/
+typedef uint8_t LCDImage_TypeDef[HOST_LCD_PAGE_NB][HOST_LCD_RAM_NB];
+
+/* Private define ------------------------------------------------------------*/
+/* Positions tried, one out of the glass */
+#define POSITION_NB     ((uint8_t)(LCD_GLASS_CHAR_NB + 1))
+#define CODE_NB         256
+
+/* Private macro -------------------------------------------------------------*/
+/* Character with a reference glyph */
+#define IS_REFERENCE_CHAR(c) ((((c) >= 'A') && ((c) <= 'Z')) || \
+                              (((c) >= '0') && ((c) <= '9')) || \
+                              ((c) == ' ') || ((c) < 0x20) || ((c) > 0x7E))
+
+/* Private variables ---------------------------------------------------------*/
+static LCDImage_TypeDef DriverImage[CODE_NB];
+static LCDImage_TypeDef ReferenceImage[CODE_NB];
+static LCDImage_TypeDef CellMask;
+static uint32_t CaseNb = 0;
+static uint32_t ErrorNb = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void WriteAll(uint8_t Reference, Point_Typedef Point,
+                     Extra_TypeDef Extra, uint8_t Position,
+                     LCDImage_TypeDef* Image);
+static void GetCells(uint8_t Position);
+static void Compare(uint8_t Code, Point_Typedef Point, Extra_TypeDef Extra,
+                    uint8_t Position);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Test entry point.
+  * @param  None
+  * @retval 0 when the driver matches the reference, 1 otherwise
+  */
+int main(void)
+{
+  uint8_t position = 0, flags = 0;
+  uint16_t code = 0;
+  Point_Typedef point = POINT_OFF;
+  Extra_TypeDef extra = EXTRA_OFF;
+
+  LCD_GLASS_Init();
+
+  for (position = 0; position < POSITION_NB; position++)
+  {
+    GetCells(position);
+
+    for (flags = 0; flags < 4; flags++)
+    {
+      point = ((flags & 0x01) != 0) ? POINT_ON : POINT_OFF;
+      extra = ((flags & 0x02) != 0) ? EXTRA_ON : EXTRA_OFF;
+
+      WriteAll(0, point, extra, position, DriverImage);
+      WriteAll(1, point, extra, position, ReferenceImage);
+
+      for (code = 0; code < CODE_NB; code++)
+      {
+        if (IS_REFERENCE_CHAR(code))
+        {
+          Compare((uint8_t)code, point, extra, position);
+        }
+      }
+    }
+  }
+
+  printf("glass_char_test (" BOARD_NAME "): %lu cases, %lu errors\n",
+         (unsigned long)CaseNb, (unsigned long)ErrorNb);
+
+  return (ErrorNb == 0) ? 0 : 1;
+}
+
+/**
+  * @brief  Writes all the character codes, one over the other, at a position
+  *         of a blank glass and copies the LCD RAM after each one.
+  * @param  Reference: 1 to use the reference function, 0 to use the driver.
+  * @param  Point: Point flag.
+  * @param  Extra: Apostrophe or double point flag.
+  * @param  Position: Position of the characters.
+  * @param  Image: Copies of the LCD RAM, one per character code.
+  * @retval None
+  */
+static void WriteAll(uint8_t Reference, Point_Typedef Point,
+                     Extra_TypeDef Extra, uint8_t Position,
+                     LCDImage_TypeDef* Image)
+{
+  uint16_t code = 0;
+  uint8_t ch = 0, page = 0, reg = 0;
+
+  HOST_LCDReset();
+  if (Reference == 0)
+  {
+    LCD_GLASS_Clear();
+  }
+
+  for (code = 0; code < CODE_NB; code++)
+  {
+    ch = (uint8_t)code;
+    if (Reference != 0)
+    {
+      REF_WriteChar(&ch, Point, Extra, Position);
+    }
+    else
+    {
+      LCD_GLASS_WriteChar(&ch, Point, Extra, Position);
+    }
+
+    for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+    {
+      for (reg = 0; reg < HOST_LCD_RAM_NB; reg++)
+      {
+        Image[code][page][reg] = HOST_LCDRead(page, reg);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Gets the LCD RAM cells of a position: the bits that the reference
+  *         clears when it writes a space there, and the ones it sets for the
+  *         point and the apostrophe (double point).
+  * @param  Position: Position of the characters.
+  * @retval None
+  */
+static void GetCells(uint8_t Position)
+{
+  uint8_t ch = ' ', page = 0, reg = 0;
+
+  HOST_LCDReset();
+  HOST_LCDFill(0xFF);
+  REF_WriteChar(&ch, POINT_OFF, EXTRA_OFF, Position);
+
+  for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+  {
+    for (reg = 0; reg < HOST_LCD_RAM_NB; reg++)
+    {
+      CellMask[page][reg] = (uint8_t)~HOST_LCDRead(page, reg);
+    }
+  }
+
+  HOST_LCDReset();
+  REF_WriteChar(&ch, POINT_ON, EXTRA_ON, Position);
+
+  for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+  {
+    for (reg = 0; reg < HOST_LCD_RAM_NB; reg++)
+    {
+      CellMask[page][reg] |= HOST_LCDRead(page, reg);
+    }
+  }
+}
+
+/**
+  * @brief  Compares the LCD RAM written by the driver and by the reference:
+  *         the cells of the position are the reference ones, the other bits
+  *         are blank.
+  * @param  Code: Character code.
+  * @param  Point: Point flag.
+  * @param  Extra: Apostrophe or double point flag.
+  * @param  Position: Position of the character.
+  * @retval None
+  */
+static void Compare(uint8_t Code, Point_Typedef Point, Extra_TypeDef Extra,
+                    uint8_t Position)
+{
+  uint8_t page = 0, reg = 0, expected = 0, error = 0;
+
+  CaseNb++;
+  for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+  {
+    for (reg = 0; reg < HOST_LCD_RAM_NB; reg++)
+    {
+      expected = (uint8_t)(ReferenceImage[Code][page][reg] &
+                           CellMask[page][reg]);
+      if (DriverImage[Code][page][reg] != expected)
+      {
+        printf("char 0x%02X point %u extra %u position %u: bank %u register "
+               "%u is 0x%02X, expected 0x%02X\n", Code, (unsigned)Point,
+               (unsigned)Extra, Position, page, reg,
+               DriverImage[Code][page][reg], expected);
+        error = 1;
+      }
+    }
+  }
+  ErrorNb += error;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,185 @@
+/**
+  ******************************************************************************
+  * @file    glass_matrix_test.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host test of the matrix pixel functions of the 1528 glass LCD
+  *          driver: the LCD RAM written by LCD_GLASS_WriteMatrixPixel() and
+  *          LCD_GLASS_ClearMatrixPixel() through MatrixPixelMap[] is compared,
+  *          bit for bit and in both banks, with the one written by the switch
+  *          based reference functions, for every row and column, the ones out
+  *          of the matrix included.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "stm8l1528_eval_glass_lcd.h"
+
+/* Reference functions, renamed */
+#define LCD_GLASS_WriteMatrixPixel REF_WriteMatrixPixel
+#define LCD_GLASS_ClearMatrixPixel REF_ClearMatrixPixel
+void REF_WriteMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn);
+void REF_ClearMatrixPixel(PixelRow_TypeDef PixelRow, PixelColumn_TypeDef PixelColumn);
+#include "stm8l1528_eval_glass_matrix.c"
+#undef LCD_GLASS_WriteMatrixPixel
+#undef LCD_GLASS_ClearMatrixPixel
+
+/* Private typedef -----------------------------------------------------------*/
+typedef uint8_t LCDImage_TypeDef[HOST_LCD_PAGE_NB][HOST_LCD_RAM_NB];
+
+/* Private define ------------------------------------------------------------*/
+/* Rows and columns tried, one out of the matrix on each side */
+#define ROW_FIRST       0
+#define ROW_LAST        11
+#define COLUMN_FIRST    0
+#define COLUMN_LAST     20
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static LCDImage_TypeDef DriverImage;
+static LCDImage_TypeDef ReferenceImage;
+static uint32_t CaseNb = 0;
+static uint32_t ErrorNb = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void Snapshot(LCDImage_TypeDef Image);
+static void FillMatrix(uint8_t Reference);
+static void Compare(const char* Name, uint8_t Row, uint8_t Column);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Test entry point.
+  * @param  None
+  * @retval 0 when the driver matches the reference, 1 otherwise
+  */
+int main(void)
+{
+  uint8_t row = 0, column = 0;
+
+  LCD_GLASS_Init();
+
+  for (row = ROW_FIRST; row <= ROW_LAST; row++)
+  {
+    for (column = COLUMN_FIRST; column <= COLUMN_LAST; column++)
+    {
+      /* Pixel set on a blank matrix */
+      HOST_LCDReset();
+      LCD_GLASS_Clear();
+      LCD_GLASS_WriteMatrixPixel((PixelRow_TypeDef)row, (PixelColumn_TypeDef)column);
+      Snapshot(DriverImage);
+      HOST_LCDReset();
+      REF_WriteMatrixPixel((PixelRow_TypeDef)row, (PixelColumn_TypeDef)column);
+      Snapshot(ReferenceImage);
+      Compare("set", row, column);
+
+      /* Pixel cleared on a full matrix */
+      HOST_LCDReset();
+      LCD_GLASS_Clear();
+      FillMatrix(0);
+      LCD_GLASS_ClearMatrixPixel((PixelRow_TypeDef)row, (PixelColumn_TypeDef)column);
+      Snapshot(DriverImage);
+      HOST_LCDReset();
+      FillMatrix(1);
+      REF_ClearMatrixPixel((PixelRow_TypeDef)row, (PixelColumn_TypeDef)column);
+      Snapshot(ReferenceImage);
+      Compare("clear", row, column);
+    }
+  }
+
+  printf("glass_matrix_test: %lu cases, %lu errors\n",
+         (unsigned long)CaseNb, (unsigned long)ErrorNb);
+
+  return (ErrorNb == 0) ? 0 : 1;
+}
+
+/**
+  * @brief  Copies both banks of the LCD RAM.
+  * @param  Image: Copy of the LCD RAM.
+  * @retval None
+  */
+static void Snapshot(LCDImage_TypeDef Image)
+{
+  uint8_t page = 0, reg = 0;
+
+  for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+  {
+    for (reg = 0; reg < HOST_LCD_RAM_NB; reg++)
+    {
+      Image[page][reg] = HOST_LCDRead(page, reg);
+    }
+  }
+}
+
+/**
+  * @brief  Sets all the pixels of the matrix.
+  * @param  Reference: 1 to use the reference function, 0 to use the driver.
+  * @retval None
+  */
+static void FillMatrix(uint8_t Reference)
+{
+  uint8_t row = 0, column = 0;
+
+  for (row = PIXELROW_1; row <= PIXELROW_10; row++)
+  {
+    for (column = PIXELCOLUMN_1; column <= PIXELCOLUMN_19; column++)
+    {
+      if (Reference != 0)
+      {
+        REF_WriteMatrixPixel((PixelRow_TypeDef)row, (PixelColumn_TypeDef)column);
+      }
+      else
+      {
+        LCD_GLASS_WriteMatrixPixel((PixelRow_TypeDef)row, (PixelColumn_TypeDef)column);
+      }
+    }
+  }
+}
+
+/**
+  * @brief  Compares the LCD RAM written by the driver and by the reference.
+  * @param  Name: Operation tested.
+  * @param  Row: Matrix row.
+  * @param  Column: Matrix column.
+  * @retval None
+  */
+static void Compare(const char* Name, uint8_t Row, uint8_t Column)
+{
+  uint8_t page = 0, reg = 0;
+
+  CaseNb++;
+  if (memcmp(DriverImage, ReferenceImage, sizeof(LCDImage_TypeDef)) == 0)
+  {
+    return;
+  }
+
+  ErrorNb++;
+  for (page = 0; page < HOST_LCD_PAGE_NB; page++)
+  {
+    for (reg = 0; reg < HOST_LCD_RAM_NB; reg++)
+    {
+      if (DriverImage[page][reg] != ReferenceImage[page][reg])
+      {
+        printf("%s row %u column %u: bank %u register %u is 0x%02X, "
+               "expected 0x%02X\n", Name, Row, Column, page, reg,
+               DriverImage[page][reg], ReferenceImage[page][reg]);
+      }
+    }
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
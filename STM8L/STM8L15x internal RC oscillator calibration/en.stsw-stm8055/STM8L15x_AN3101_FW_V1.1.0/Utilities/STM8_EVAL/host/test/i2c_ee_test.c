@@ -0,0 +1,293 @@
+/**
+  ******************************************************************************
+  * @file    i2c_ee_test.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host test of the I2C EEPROM driver, run on the M24C64 and LM75
+  *          models sharing the I2C bus model.
+  *
+  *          @note The test checks:
+  *                - bulk:   sEE_WriteBuffer() of TEST_PAGE_NB pages takes
+  *                          within TEST_TOLERANCE of the ideal pipeline,
+  *                          (tW + page transfer) x pages, each page being
+  *                          written in one write cycle,
+  *                - read:   sEE_ReadBuffer() of 1, 2, 3, 4, 5 and 100 bytes,
+  *                          after an unaligned sEE_WriteBuffer(), gives the
+  *                          data written,
+  *                - tick:   sEE_StartWriteBuffer() goes on with sEE_Tick()
+  *                          called every TEST_TICK ns, the LM75 temperature
+  *                          being read on the shared bus meanwhile.
+  *                The EEPROM content is compared with the data written, and
+  *                the models must not have counted any error.
+  *
+  *          @note The simulated time only counts the I2C bits and the write
+  *                cycles, not the CPU time of the driver: the bus runs at
+  *                I2CM_SPEED, the page transfer being the START condition,
+  *                35 bytes (slave address, memory address and 32 data
+  *                bytes) of 9 bits and the STOP condition. The page sent
+  *                again at the end of the write cycle may be acknowledged
+  *                during its slave address, the pipeline being then faster
+  *                than the ideal one.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "stm8_eval_i2c_ee.h"
+#include "stm8_eval_i2c_tsensor.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/* Private define ------------------------------------------------------------*/
+#define TEST_IMAGE          "build/m24c.img"
+#define TEST_PAGE_NB        ((uint16_t)126)
+#define TEST_BULK_ADDRESS   ((uint16_t)0x0040)
+#define TEST_READ_ADDRESS   ((uint16_t)0x1013)
+#define TEST_READ_SIZE      ((uint16_t)100)
+#define TEST_TICK_ADDRESS   ((uint16_t)0x1800)
+#define TEST_TICK_PAGE_NB   ((uint16_t)4)
+#define TEST_TICK           ((HOST_Time_TypeDef)1000000) /* 1 ms */
+#define TEST_TEMPERATURE    ((uint16_t)0x1980)           /* 25.5 C */
+
+/* Bits of a page transfer: START, 35 bytes and their ACK, STOP */
+#define TEST_PAGE_BITS      ((uint32_t)(1 + (1 + sEE_ADDRESS_NB + sEE_PAGESIZE) * 9 + 1))
+
+/* Bulk write time allowed off the ideal pipeline, in 1/1000 */
+#define TEST_TOLERANCE      ((uint32_t)2)
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t Expected[HOST_M24C_SIZE];
+static uint8_t Buffer[TEST_READ_SIZE];
+static uint32_t ErrorNb = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void TestBulk(void);
+static void TestRead(void);
+static void TestTick(void);
+static void CheckMemory(const char* Name, uint16_t Address, uint16_t Size);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Test entry point.
+  * @param  argc: Argument count.
+  * @param  argv: Arguments: the image file, optional.
+  * @retval 0 when the checks pass, 1 otherwise
+  */
+int main(int argc, char** argv)
+{
+  HOST_I2CStatistics_TypeDef bus;
+  HOST_M24CStatistics_TypeDef eeprom;
+  uint32_t index = 0;
+
+  if (HOST_M24CInit((argc > 1) ? argv[1] : TEST_IMAGE, 0) != SUCCESS)
+  {
+    return 1;
+  }
+  HOST_I2CAttach(I2CM_I2C, sEE_HW_ADDRESS, &HOST_M24C);
+  HOST_I2CAttach(I2CM_I2C, LM75_ADDR, &HOST_LM75);
+  HOST_I2CAttachIRQ(I2CM_I2C, I2CM_IRQHandler);
+  HOST_LM75Init();
+  HOST_LM75SetTemperature(TEST_TEMPERATURE);
+
+  sEE_Init();
+  LM75_Init();
+
+  /* Data of the writes */
+  for (index = 0; index < HOST_M24C_SIZE; index++)
+  {
+    Expected[index] = (uint8_t)((index * 13) ^ (index >> 8));
+  }
+
+  printf("i2c_ee_test: I2C %lu kHz, tW %lu us\n",
+         (unsigned long)(1000000ULL / HOST_I2CBitTime(I2CM_I2C)),
+         (unsigned long)(HOST_M24C_TW / 1000));
+
+  TestBulk();
+  TestRead();
+  TestTick();
+
+  HOST_I2CGetStatistics(&bus);
+  HOST_M24CGetStatistics(&eeprom);
+  if ((bus.ErrorNb != 0) || (eeprom.ErrorNb != 0))
+  {
+    printf("models: %lu bus errors, %lu EEPROM errors\n",
+           (unsigned long)bus.ErrorNb, (unsigned long)eeprom.ErrorNb);
+    ErrorNb++;
+  }
+
+  sEE_DeInit();
+  HOST_M24CDeInit();
+
+  printf("i2c_ee_test: %lu errors\n", (unsigned long)ErrorNb);
+
+  return (ErrorNb == 0) ? 0 : 1;
+}
+
+/**
+  * @brief  Writes TEST_PAGE_NB pages and compares the time with the ideal
+  *         pipeline.
+  * @param  None
+  * @retval None
+  */
+static void TestBulk(void)
+{
+  HOST_M24CStatistics_TypeDef start, end;
+  HOST_Time_TypeDef time = 0, ideal = 0, delta = 0;
+  uint16_t size = (uint16_t)(TEST_PAGE_NB * sEE_PAGESIZE);
+
+  HOST_M24CGetStatistics(&start);
+  time = HOST_GetTime();
+
+  sEE_WriteBuffer(&Expected[TEST_BULK_ADDRESS], TEST_BULK_ADDRESS, size);
+
+  time = HOST_GetTime() - time;
+  HOST_M24CGetStatistics(&end);
+
+  ideal = (HOST_M24C_TW + TEST_PAGE_BITS * HOST_I2CBitTime(I2CM_I2C)) * TEST_PAGE_NB;
+  delta = (time > ideal) ? (time - ideal) : (ideal - time);
+  printf("bulk: %u pages in %lu us, ideal %lu us (%c%lu.%02lu%%), %lu polls\n",
+         TEST_PAGE_NB, (unsigned long)(time / 1000), (unsigned long)(ideal / 1000),
+         (time < ideal) ? '-' : '+', (unsigned long)(delta * 100 / ideal),
+         (unsigned long)(delta * 10000 / ideal % 100),
+         (unsigned long)(end.BusyNb - start.BusyNb));
+
+  if (delta * 1000 > ideal * TEST_TOLERANCE)
+  {
+    printf("bulk: not within %lu/1000 of the ideal pipeline\n",
+           (unsigned long)TEST_TOLERANCE);
+    ErrorNb++;
+  }
+  if ((end.WriteNb - start.WriteNb) != TEST_PAGE_NB)
+  {
+    printf("bulk: %lu write cycles\n", (unsigned long)(end.WriteNb - start.WriteNb));
+    ErrorNb++;
+  }
+  if (sEE_GetStatus() != I2CM_OK)
+  {
+    printf("bulk: status %u\n", sEE_GetStatus());
+    ErrorNb++;
+  }
+  CheckMemory("bulk", TEST_BULK_ADDRESS, size);
+}
+
+/**
+  * @brief  Reads back an unaligned write, with the byte counts handled apart
+  *         by the I2C master.
+  * @param  None
+  * @retval None
+  */
+static void TestRead(void)
+{
+  static const uint16_t Sizes[] = {1, 2, 3, 4, 5, TEST_READ_SIZE};
+  uint16_t number = 0;
+  uint8_t index = 0;
+
+  sEE_WriteBuffer(&Expected[TEST_READ_ADDRESS], TEST_READ_ADDRESS, TEST_READ_SIZE);
+  CheckMemory("read", TEST_READ_ADDRESS, TEST_READ_SIZE);
+
+  for (index = 0; index < (sizeof(Sizes) / sizeof(Sizes[0])); index++)
+  {
+    memset(Buffer, 0, sizeof(Buffer));
+    number = Sizes[index];
+    sEE_ReadBuffer(Buffer, TEST_READ_ADDRESS, &number);
+
+    /* The transfer ends in the I2C interrupt */
+    while (number != 0)
+    {}
+
+    if ((sEE_GetStatus() != I2CM_OK)
+        || (memcmp(Buffer, &Expected[TEST_READ_ADDRESS], Sizes[index]) != 0)
+        || ((Sizes[index] < TEST_READ_SIZE) && (Buffer[Sizes[index]] != 0)))
+    {
+      printf("read %u bytes: status %u, wrong data\n", Sizes[index], sEE_GetStatus());
+      ErrorNb++;
+    }
+  }
+}
+
+/**
+  * @brief  Runs a sEE_StartWriteBuffer() write from a TEST_TICK loop reading
+  *         the LM75 temperature.
+  * @param  None
+  * @retval None
+  */
+static void TestTick(void)
+{
+  HOST_Time_TypeDef time = 0;
+  uint16_t size = (uint16_t)(TEST_TICK_PAGE_NB * sEE_PAGESIZE), temperature = 0;
+  uint32_t tickNb = 0;
+
+  time = HOST_GetTime();
+  sEE_StartWriteBuffer(&Expected[TEST_TICK_ADDRESS], TEST_TICK_ADDRESS, size);
+
+  while (sEE_GetWriteState() != sEE_STATE_READY)
+  {
+    HOST_Wait(TEST_TICK);
+    sEE_Tick();
+    tickNb++;
+
+    temperature = LM75_ReadTemp();
+    if (temperature != (uint16_t)(TEST_TEMPERATURE >> 7))
+    {
+      printf("tick: temperature 0x%03X\n", temperature);
+      ErrorNb++;
+    }
+  }
+  time = HOST_GetTime() - time;
+
+  printf("tick: %u pages in %lu us, %lu ticks\n", TEST_TICK_PAGE_NB,
+         (unsigned long)(time / 1000), (unsigned long)tickNb);
+
+  /* Each write cycle ends before its sixth tick */
+  if (tickNb > (uint32_t)(TEST_TICK_PAGE_NB + 1) * (HOST_M24C_TW / TEST_TICK + 1))
+  {
+    printf("tick: too many ticks\n");
+    ErrorNb++;
+  }
+  if (sEE_GetStatus() != I2CM_OK)
+  {
+    printf("tick: status %u\n", sEE_GetStatus());
+    ErrorNb++;
+  }
+  CheckMemory("tick", TEST_TICK_ADDRESS, size);
+}
+
+/**
+  * @brief  Compares the EEPROM content with the data written.
+  * @param  Name: Check name.
+  * @param  Address: EEPROM address.
+  * @param  Size: Number of bytes.
+  * @retval None
+  */
+static void CheckMemory(const char* Name, uint16_t Address, uint16_t Size)
+{
+  const uint8_t* memory = HOST_M24CMemory();
+  uint16_t index = 0;
+
+  for (index = 0; index < Size; index++)
+  {
+    if (memory[Address + index] != Expected[Address + index])
+    {
+      printf("%s: 0x%04X is 0x%02X, expected 0x%02X\n", Name, Address + index,
+             memory[Address + index], Expected[Address + index]);
+      ErrorNb++;
+      return;
+    }
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
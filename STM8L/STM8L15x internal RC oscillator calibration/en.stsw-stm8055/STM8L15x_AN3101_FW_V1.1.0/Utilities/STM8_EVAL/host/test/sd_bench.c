@@ -0,0 +1,624 @@
+/**
+  ******************************************************************************
+  * @file    sd_bench.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host benchmark of the SD driver, run on the SD card model.
+  *
+  *          @note SD_Init() is first run on each card type of the model, the
+  *                card being checked with a few blocks written and read. The
+  *                workloads then run on BENCH_SIZE bytes of the SDHC card and
+  *                are reported with their bytes per simulated second, and
+  *                the commands, blocks and waits counted by the driver
+  *                (SD_USE_STATISTICS). The overhead per block is the time
+  *                which is not the transfer of the data bytes at the SPI
+  *                clock: commands, tokens, CRC, access and busy times.
+  *                - write 1:  SD_WriteSectors() of one sector,
+  *                - read 1:   SD_ReadSectors() of one sector,
+  *                - write N:  SD_WriteSectors() of BENCH_MULTI_NB sectors,
+  *                - read N:   SD_ReadSectors() of BENCH_MULTI_NB sectors,
+  *                - wbuf N:   SD_WriteBuffer() of BENCH_MULTI_NB sectors,
+  *                - rbuf N:   SD_ReadBuffer() of BENCH_MULTI_NB sectors,
+  *                - stream w: SD_StreamWriteBlock() of each sector,
+  *                - stream r: SD_StreamReadGetBlock() up to the end,
+  *                SD_StreamTick() being called every BENCH_TICK ns while no
+  *                buffer or block is available. The stop functions, which
+  *                wait for SD_StreamTick(), run with a timer interrupt.
+  *                The data read is compared with the data written, the card
+  *                content with the expected one after each write, and the
+  *                model must count the commands and blocks the driver
+  *                counted, without error. The transfers of several sectors
+  *                must be multiple block ones: one CMD25 per write (with
+  *                CMD55 and ACMD23 when SD_USE_PRE_ERASE is defined), one
+  *                CMD18 and CMD12 per read.
+  *
+  *          @note The simulated time only counts the SPI transfers and the
+  *                card times, not the CPU time of the driver: the SPI clock
+  *                is fSYSCLK / 2 for the transfers, fSYSCLK being 16 MHz.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "stm8_eval_spi_sd.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Counters of a workload
+  */
+typedef struct
+{
+  HOST_Time_TypeDef Time;           /*!< Simulated time at the start */
+  SD_Statistics_TypeDef Driver;     /*!< Driver counters at the start */
+  HOST_SDStatistics_TypeDef Model;  /*!< Model counters at the start */
+}Bench_TypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_IMAGE        "build/sd.img"
+#define BENCH_SECTOR       ((uint32_t)2048)
+#define BENCH_SIZE         ((uint32_t)0x40000)   /* 512 sectors */
+#define BENCH_SECTOR_NB    (BENCH_SIZE / SD_BLOCK_SIZE)
+#define BENCH_MULTI_NB     ((uint32_t)16)
+#define BENCH_CHECK_SECTOR ((uint32_t)16)
+#define BENCH_CHECK_NB     ((uint32_t)4)
+#define BENCH_TICK         ((HOST_Time_TypeDef)100000) /* 100 us */
+#define BENCH_TIMER        ((unsigned long)1000)       /* 1 ms of real time */
+
+/* Commands per multiple block transfer */
+#define BENCH_MULTI_READ_CMD_NB   ((uint32_t)2)
+#ifdef SD_USE_PRE_ERASE
+#define BENCH_MULTI_WRITE_CMD_NB  ((uint32_t)3)
+#else
+#define BENCH_MULTI_WRITE_CMD_NB  ((uint32_t)1)
+#endif /* SD_USE_PRE_ERASE */
+
+/* Private macro -------------------------------------------------------------*/
+/* Private variables ---------------------------------------------------------*/
+static uint8_t Buffer[BENCH_MULTI_NB * SD_BLOCK_SIZE];
+static const char* Image = BENCH_IMAGE;
+static uint32_t ErrorNb = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void BenchInit(uint8_t Type, const char* Name);
+static void BenchStart(Bench_TypeDef* Bench);
+static uint32_t BenchEnd(Bench_TypeDef* Bench, const char* Name, uint32_t ByteNb);
+static void BenchWrite(const char* Name, uint32_t SectorNb, FunctionalState Buffered,
+                       uint8_t Seed);
+static void BenchRead(const char* Name, uint32_t SectorNb, FunctionalState Buffered,
+                      uint8_t Seed);
+static void CheckCommands(const char* Name, uint32_t CommandNb, uint32_t CallNb,
+                          uint32_t SectorNb, uint32_t MultiCommandNb);
+static void BenchStreamWrite(uint8_t Seed);
+static void BenchStreamRead(uint8_t Seed);
+static void BenchTick(void);
+static void BenchInterrupt(void);
+static void FillData(uint8_t* Data, uint32_t Sector, uint32_t SectorNb, uint8_t Seed);
+static uint8_t CheckData(const uint8_t* Data, uint32_t Sector, uint32_t SectorNb,
+                         uint8_t Seed);
+static void CheckMemory(const char* Name, uint32_t Sector, uint32_t SectorNb,
+                        uint8_t Seed);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Benchmark entry point.
+  * @param  argc: Number of arguments.
+  * @param  argv: Image file, build/sd.img by default.
+  * @retval 0 when the data and the card accesses are right, 1 otherwise
+  */
+int main(int argc, char** argv)
+{
+  if (argc > 1)
+  {
+    Image = argv[1];
+  }
+
+  HOST_SPIAttach(SD_SPI, SD_CS_GPIO_PORT, SD_CS_PIN, &HOST_SD);
+  HOST_DMAAttachIRQ(SD_SPI_DMA_CHANNEL_RX, SD_SPI_DMA_RX_IRQHandler);
+  HOST_DMAAttachIRQ(SD_SPI_DMA_CHANNEL_TX, SD_SPI_DMA_TX_IRQHandler);
+
+  /* Card in the slot: detect pin low */
+  HOST_GPIOSetInput(SD_DETECT_GPIO_PORT, SD_DETECT_PIN, RESET);
+
+  printf("sd_bench: SD_Init() and %lu blocks on each card type\n",
+         (unsigned long)BENCH_CHECK_NB);
+  printf("%-8s %10s %8s %6s\n", "", "init ms", "commands", "blocks");
+
+  BenchInit(HOST_SD_TYPE_MMC, "MMC");
+  BenchInit(HOST_SD_TYPE_V1, "SD V1");
+  BenchInit(HOST_SD_TYPE_V2, "SD V2");
+  BenchInit(HOST_SD_TYPE_HC, "SDHC");
+
+  /* Workloads on the default card */
+  if ((HOST_SDInit(Image, 0) != SUCCESS) || (SD_Init() != SD_RESPONSE_NO_ERROR))
+  {
+    printf("sd_bench: SD_Init failed\n");
+    return 1;
+  }
+
+  printf("sd_bench: %lu bytes at sector %lu, SPI %lu kHz, %lu sectors per "
+         "multiple block transfer\n",
+         (unsigned long)BENCH_SIZE, (unsigned long)BENCH_SECTOR,
+         (unsigned long)(8000000ULL / HOST_SPIByteTime(SD_SPI)),
+         (unsigned long)BENCH_MULTI_NB);
+  printf("%-8s %10s %10s %8s %6s %6s %6s %9s\n", "", "bytes/s", "time ms",
+         "commands", "blocks", "waits", "busy", "us/block");
+
+  BenchWrite("write 1", 1, DISABLE, 1);
+  BenchRead("read 1", 1, DISABLE, 1);
+  BenchWrite("write N", BENCH_MULTI_NB, DISABLE, 2);
+  BenchRead("read N", BENCH_MULTI_NB, DISABLE, 2);
+  BenchWrite("wbuf N", BENCH_MULTI_NB, ENABLE, 4);
+  BenchRead("rbuf N", BENCH_MULTI_NB, ENABLE, 4);
+  BenchStreamWrite(3);
+  BenchStreamRead(3);
+
+  SD_DeInit();
+  HOST_SDDeInit();
+
+  printf("sd_bench: %lu errors\n", (unsigned long)ErrorNb);
+
+  return (ErrorNb == 0) ? 0 : 1;
+}
+
+/**
+  * @brief  Initializes a card of the given type, then writes and reads a few
+  *         blocks, with single and multiple block transfers.
+  * @param  Type: Card type of the model, HOST_SD_TYPE_xxx, the value of the
+  *         SD_CARD_xxx type found by SD_Init().
+  * @param  Name: Card type name.
+  * @retval None
+  */
+static void BenchInit(uint8_t Type, const char* Name)
+{
+  HOST_SDConfig_TypeDef config;
+  HOST_SDStatistics_TypeDef model;
+  SD_CardInfo info;
+  HOST_Time_TypeDef time = 0;
+  uint32_t sector = 0;
+
+  config.Type = Type;
+  config.ResponseDelay = HOST_SD_NCR;
+  config.BlockNb = HOST_SD_BLOCK_NB;
+  config.InitTime = HOST_SD_INIT_TIME;
+  config.ReadAccessTime = HOST_SD_READ_ACCESS_TIME;
+  config.MultiBlockReadTime = HOST_SD_MULTI_READ_TIME;
+  config.BlockWriteTime = HOST_SD_WRITE_TIME;
+  config.MultiBlockWriteTime = HOST_SD_MULTI_WRITE_TIME;
+  config.StopWriteTime = HOST_SD_STOP_WRITE_TIME;
+  if (HOST_SDInit(Image, &config) != SUCCESS)
+  {
+    ErrorNb++;
+    return;
+  }
+
+  if (SD_Detect() != SD_PRESENT)
+  {
+    printf("%s: card not detected\n", Name);
+    ErrorNb++;
+  }
+
+  time = HOST_GetTime();
+  if (SD_Init() != SD_RESPONSE_NO_ERROR)
+  {
+    printf("%s: SD_Init failed\n", Name);
+    ErrorNb++;
+    return;
+  }
+  time = HOST_GetTime() - time;
+
+  if (SD_GetCardType() != Type)
+  {
+    printf("%s: card type %u found\n", Name, (unsigned)SD_GetCardType());
+    ErrorNb++;
+  }
+  if ((SD_GetCardInfo(&info) != SD_RESPONSE_NO_ERROR) || (info.CardBlockNb != config.BlockNb))
+  {
+    printf("%s: %lu blocks found\n", Name, (unsigned long)info.CardBlockNb);
+    ErrorNb++;
+  }
+
+  /* Multiple block write, single block reads */
+  FillData(Buffer, BENCH_CHECK_SECTOR, BENCH_CHECK_NB, Type);
+  if (SD_WriteSectors(Buffer, BENCH_CHECK_SECTOR, BENCH_CHECK_NB) != SD_RESPONSE_NO_ERROR)
+  {
+    printf("%s: SD_WriteSectors failed\n", Name);
+    ErrorNb++;
+  }
+  CheckMemory(Name, BENCH_CHECK_SECTOR, BENCH_CHECK_NB, Type);
+  for (sector = 0; sector < BENCH_CHECK_NB; sector++)
+  {
+    memset(Buffer, 0, SD_BLOCK_SIZE);
+    if ((SD_ReadSectors(Buffer, BENCH_CHECK_SECTOR + sector, 1) != SD_RESPONSE_NO_ERROR) ||
+        (CheckData(Buffer, BENCH_CHECK_SECTOR + sector, 1, Type) != 0))
+    {
+      printf("%s: wrong sector %lu\n", Name, (unsigned long)(BENCH_CHECK_SECTOR + sector));
+      ErrorNb++;
+    }
+  }
+
+  /* Single block write, multiple block read */
+  FillData(Buffer, BENCH_CHECK_SECTOR, 1, (uint8_t)~Type);
+  if (SD_WriteSectors(Buffer, BENCH_CHECK_SECTOR, 1) != SD_RESPONSE_NO_ERROR)
+  {
+    printf("%s: SD_WriteSectors failed\n", Name);
+    ErrorNb++;
+  }
+  memset(Buffer, 0, BENCH_CHECK_NB * SD_BLOCK_SIZE);
+  if ((SD_ReadSectors(Buffer, BENCH_CHECK_SECTOR, BENCH_CHECK_NB) != SD_RESPONSE_NO_ERROR) ||
+      (CheckData(Buffer, BENCH_CHECK_SECTOR, 1, (uint8_t)~Type) != 0) ||
+      (CheckData(Buffer + SD_BLOCK_SIZE, BENCH_CHECK_SECTOR + 1, BENCH_CHECK_NB - 1, Type) != 0))
+  {
+    printf("%s: wrong sectors read\n", Name);
+    ErrorNb++;
+  }
+
+  HOST_SDGetStatistics(&model);
+  printf("%-8s %10.3f %8lu %6lu\n", Name, (double)time / 1e6,
+         (unsigned long)model.CommandNb,
+         (unsigned long)(model.ReadBlockNb + model.WriteBlockNb));
+  if (model.ErrorNb != 0)
+  {
+    printf("%s: %lu card errors\n", Name, (unsigned long)model.ErrorNb);
+    ErrorNb++;
+  }
+
+  SD_DeInit();
+}
+
+/**
+  * @brief  Starts a workload.
+  * @param  Bench: pointer to the counters of the workload.
+  * @retval None
+  */
+static void BenchStart(Bench_TypeDef* Bench)
+{
+  Bench->Time = HOST_GetTime();
+  SD_GetStatistics(&Bench->Driver);
+  HOST_SDGetStatistics(&Bench->Model);
+}
+
+/**
+  * @brief  Ends a workload and prints its counters.
+  * @param  Bench: pointer to the counters of the workload.
+  * @param  Name: Workload name.
+  * @param  ByteNb: Bytes of the workload.
+  * @retval Commands sent by the driver during the workload
+  */
+static uint32_t BenchEnd(Bench_TypeDef* Bench, const char* Name, uint32_t ByteNb)
+{
+  HOST_Time_TypeDef time = HOST_GetTime() - Bench->Time;
+  HOST_Time_TypeDef data = (HOST_Time_TypeDef)ByteNb * HOST_SPIByteTime(SD_SPI);
+  SD_Statistics_TypeDef driver;
+  HOST_SDStatistics_TypeDef model;
+  uint32_t blocks = 0;
+
+  SD_GetStatistics(&driver);
+  HOST_SDGetStatistics(&model);
+
+  blocks = (driver.ReadBlockNb - Bench->Driver.ReadBlockNb) +
+           (driver.WriteBlockNb - Bench->Driver.WriteBlockNb);
+
+  printf("%-8s %10.0f %10.3f %8lu %6lu %6lu %6lu %9.1f\n", Name,
+         (double)ByteNb * 1e9 / (double)time, (double)time / 1e6,
+         (unsigned long)(driver.CommandNb - Bench->Driver.CommandNb),
+         (unsigned long)blocks,
+         (unsigned long)(driver.WaitNb - Bench->Driver.WaitNb),
+         (unsigned long)(driver.BusyNb - Bench->Driver.BusyNb),
+         (blocks != 0) ? ((double)(time - data) / 1e3 / (double)blocks) : 0.0);
+
+  if (model.ErrorNb != Bench->Model.ErrorNb)
+  {
+    printf("%s: %lu card errors\n", Name,
+           (unsigned long)(model.ErrorNb - Bench->Model.ErrorNb));
+    ErrorNb++;
+  }
+  if ((model.CommandNb - Bench->Model.CommandNb) != (driver.CommandNb - Bench->Driver.CommandNb))
+  {
+    printf("%s: %lu commands received, the driver counted %lu\n", Name,
+           (unsigned long)(model.CommandNb - Bench->Model.CommandNb),
+           (unsigned long)(driver.CommandNb - Bench->Driver.CommandNb));
+    ErrorNb++;
+  }
+  if (((model.ReadBlockNb - Bench->Model.ReadBlockNb) != (driver.ReadBlockNb - Bench->Driver.ReadBlockNb)) ||
+      ((model.WriteBlockNb - Bench->Model.WriteBlockNb) != (driver.WriteBlockNb - Bench->Driver.WriteBlockNb)))
+  {
+    printf("%s: %lu blocks read and %lu written, the driver counted %lu and %lu\n", Name,
+           (unsigned long)(model.ReadBlockNb - Bench->Model.ReadBlockNb),
+           (unsigned long)(model.WriteBlockNb - Bench->Model.WriteBlockNb),
+           (unsigned long)(driver.ReadBlockNb - Bench->Driver.ReadBlockNb),
+           (unsigned long)(driver.WriteBlockNb - Bench->Driver.WriteBlockNb));
+    ErrorNb++;
+  }
+
+  return driver.CommandNb - Bench->Driver.CommandNb;
+}
+
+/**
+  * @brief  Writes the sectors by SD_WriteSectors() or SD_WriteBuffer() calls.
+  * @param  Name: Workload name.
+  * @param  SectorNb: Sectors per call.
+  * @param  Buffered: ENABLE for SD_WriteBuffer(), DISABLE for
+  *         SD_WriteSectors().
+  * @param  Seed: Seed of the data.
+  * @retval None
+  */
+static void BenchWrite(const char* Name, uint32_t SectorNb, FunctionalState Buffered,
+                       uint8_t Seed)
+{
+  Bench_TypeDef bench;
+  uint32_t sector = 0, commands = 0;
+  uint8_t status = SD_RESPONSE_NO_ERROR;
+
+  BenchStart(&bench);
+  for (sector = 0; sector < BENCH_SECTOR_NB; sector += SectorNb)
+  {
+    FillData(Buffer, BENCH_SECTOR + sector, SectorNb, Seed);
+    if (Buffered != DISABLE)
+    {
+      status = SD_WriteBuffer(Buffer, (BENCH_SECTOR + sector) * SD_BLOCK_SIZE,
+                              SectorNb * SD_BLOCK_SIZE);
+    }
+    else
+    {
+      status = SD_WriteSectors(Buffer, BENCH_SECTOR + sector, SectorNb);
+    }
+    if (status != SD_RESPONSE_NO_ERROR)
+    {
+      printf("%s: write failed at sector %lu\n", Name,
+             (unsigned long)(BENCH_SECTOR + sector));
+      ErrorNb++;
+    }
+  }
+  commands = BenchEnd(&bench, Name, BENCH_SIZE);
+
+  CheckCommands(Name, commands, BENCH_SECTOR_NB / SectorNb, SectorNb,
+                BENCH_MULTI_WRITE_CMD_NB);
+  CheckMemory(Name, BENCH_SECTOR, BENCH_SECTOR_NB, Seed);
+}
+
+/**
+  * @brief  Reads the sectors by SD_ReadSectors() or SD_ReadBuffer() calls.
+  * @param  Name: Workload name.
+  * @param  SectorNb: Sectors per call.
+  * @param  Buffered: ENABLE for SD_ReadBuffer(), DISABLE for
+  *         SD_ReadSectors().
+  * @param  Seed: Seed of the data written.
+  * @retval None
+  */
+static void BenchRead(const char* Name, uint32_t SectorNb, FunctionalState Buffered,
+                      uint8_t Seed)
+{
+  Bench_TypeDef bench;
+  uint32_t sector = 0, commands = 0;
+  uint8_t status = SD_RESPONSE_NO_ERROR;
+
+  BenchStart(&bench);
+  for (sector = 0; sector < BENCH_SECTOR_NB; sector += SectorNb)
+  {
+    if (Buffered != DISABLE)
+    {
+      status = SD_ReadBuffer(Buffer, (BENCH_SECTOR + sector) * SD_BLOCK_SIZE,
+                             SectorNb * SD_BLOCK_SIZE);
+    }
+    else
+    {
+      status = SD_ReadSectors(Buffer, BENCH_SECTOR + sector, SectorNb);
+    }
+    if ((status != SD_RESPONSE_NO_ERROR) ||
+        (CheckData(Buffer, BENCH_SECTOR + sector, SectorNb, Seed) != 0))
+    {
+      printf("%s: wrong data at sector %lu\n", Name, (unsigned long)(BENCH_SECTOR + sector));
+      ErrorNb++;
+    }
+  }
+  commands = BenchEnd(&bench, Name, BENCH_SIZE);
+
+  CheckCommands(Name, commands, BENCH_SECTOR_NB / SectorNb, SectorNb,
+                BENCH_MULTI_READ_CMD_NB);
+}
+
+/**
+  * @brief  Writes the sectors with the write stream.
+  * @param  Seed: Seed of the data.
+  * @retval None
+  */
+static void BenchStreamWrite(uint8_t Seed)
+{
+  Bench_TypeDef bench;
+  uint32_t sector = 0;
+  uint8_t* buffer = 0;
+  uint8_t status = SD_RESPONSE_NO_ERROR;
+
+  BenchStart(&bench);
+  status = SD_StreamWriteStart(BENCH_SECTOR * SD_BLOCK_SIZE);
+  for (sector = 0; (sector < BENCH_SECTOR_NB) && (status == SD_RESPONSE_NO_ERROR); sector++)
+  {
+    while (((buffer = SD_StreamWriteGetBuffer()) == 0) &&
+           ((status = SD_StreamGetStatus()) == SD_RESPONSE_NO_ERROR))
+    {
+      BenchTick();
+    }
+    if (buffer != 0)
+    {
+      FillData(buffer, BENCH_SECTOR + sector, 1, Seed);
+      SD_StreamWriteBlock();
+    }
+  }
+  HOST_TimerStart(BenchInterrupt, BENCH_TIMER);
+  if (SD_StreamWriteStop() != SD_RESPONSE_NO_ERROR)
+  {
+    status = SD_RESPONSE_FAILURE;
+  }
+  HOST_TimerStop();
+  BenchEnd(&bench, "stream w", BENCH_SIZE);
+
+  if (status != SD_RESPONSE_NO_ERROR)
+  {
+    printf("stream w: failed at sector %lu\n", (unsigned long)(BENCH_SECTOR + sector));
+    ErrorNb++;
+  }
+  CheckMemory("stream w", BENCH_SECTOR, BENCH_SECTOR_NB, Seed);
+}
+
+/**
+  * @brief  Reads the sectors with the read stream.
+  * @param  Seed: Seed of the data written.
+  * @retval None
+  */
+static void BenchStreamRead(uint8_t Seed)
+{
+  Bench_TypeDef bench;
+  uint32_t sector = 0;
+  uint8_t* block = 0;
+  uint8_t status = SD_RESPONSE_NO_ERROR;
+
+  BenchStart(&bench);
+  status = SD_StreamReadStart(BENCH_SECTOR * SD_BLOCK_SIZE);
+  for (sector = 0; (sector < BENCH_SECTOR_NB) && (status == SD_RESPONSE_NO_ERROR); sector++)
+  {
+    while (((block = SD_StreamReadGetBlock()) == 0) &&
+           ((status = SD_StreamGetStatus()) == SD_RESPONSE_NO_ERROR))
+    {
+      BenchTick();
+    }
+    if ((block != 0) && (CheckData(block, BENCH_SECTOR + sector, 1, Seed) != 0))
+    {
+      printf("stream r: wrong data at sector %lu\n", (unsigned long)(BENCH_SECTOR + sector));
+      ErrorNb++;
+    }
+  }
+  HOST_TimerStart(BenchInterrupt, BENCH_TIMER);
+  if (SD_StreamReadStop() != SD_RESPONSE_NO_ERROR)
+  {
+    status = SD_RESPONSE_FAILURE;
+  }
+  HOST_TimerStop();
+  BenchEnd(&bench, "stream r", BENCH_SIZE);
+
+  if (status != SD_RESPONSE_NO_ERROR)
+  {
+    printf("stream r: failed at sector %lu\n", (unsigned long)(BENCH_SECTOR + sector));
+    ErrorNb++;
+  }
+}
+
+/**
+  * @brief  Checks the commands sent for the transfers: one per single block
+  *         transfer, MultiCommandNb per multiple block one.
+  * @param  Name: Workload name.
+  * @param  CommandNb: Commands sent by the driver.
+  * @param  CallNb: Transfers.
+  * @param  SectorNb: Sectors per transfer.
+  * @param  MultiCommandNb: Commands per multiple block transfer.
+  * @retval None
+  */
+static void CheckCommands(const char* Name, uint32_t CommandNb, uint32_t CallNb,
+                          uint32_t SectorNb, uint32_t MultiCommandNb)
+{
+  uint32_t expected = CallNb * ((SectorNb > 1) ? MultiCommandNb : 1);
+
+  if (CommandNb != expected)
+  {
+    printf("%s: %lu commands for %lu transfers of %lu sectors, %lu expected\n",
+           Name, (unsigned long)CommandNb, (unsigned long)CallNb,
+           (unsigned long)SectorNb, (unsigned long)expected);
+    ErrorNb++;
+  }
+}
+
+/**
+  * @brief  Waits for the next period of SD_StreamTick() and calls it.
+  * @param  None
+  * @retval None
+  */
+static void BenchTick(void)
+{
+  HOST_Wait(BENCH_TICK);
+  SD_StreamTick();
+}
+
+/**
+  * @brief  Timer interrupt routine, while a stream stop function waits.
+  * @param  None
+  * @retval None
+  */
+static void BenchInterrupt(void)
+{
+  BenchTick();
+}
+
+/**
+  * @brief  Fills sectors with their data.
+  * @param  Data: Data of the sectors.
+  * @param  Sector: First sector.
+  * @param  SectorNb: Number of sectors.
+  * @param  Seed: Seed of the data.
+  * @retval None
+  */
+static void FillData(uint8_t* Data, uint32_t Sector, uint32_t SectorNb, uint8_t Seed)
+{
+  uint32_t index = 0, offset = Sector * SD_BLOCK_SIZE;
+
+  for (index = 0; index < SectorNb * SD_BLOCK_SIZE; index++)
+  {
+    Data[index] = (uint8_t)(((offset + index) * 7) ^ ((offset + index) >> 9) ^ (Seed * 0x5B));
+  }
+}
+
+/**
+  * @brief  Compares sectors with their data.
+  * @param  Data: Data of the sectors.
+  * @param  Sector: First sector.
+  * @param  SectorNb: Number of sectors.
+  * @param  Seed: Seed of the data.
+  * @retval 0 if the data is right, 1 otherwise
+  */
+static uint8_t CheckData(const uint8_t* Data, uint32_t Sector, uint32_t SectorNb,
+                         uint8_t Seed)
+{
+  uint32_t index = 0, offset = Sector * SD_BLOCK_SIZE;
+
+  for (index = 0; index < SectorNb * SD_BLOCK_SIZE; index++)
+  {
+    if (Data[index] != (uint8_t)(((offset + index) * 7) ^ ((offset + index) >> 9) ^ (Seed * 0x5B)))
+    {
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+/**
+  * @brief  Compares the card content with the expected data.
+  * @param  Name: Workload name.
+  * @param  Sector: First sector.
+  * @param  SectorNb: Number of sectors.
+  * @param  Seed: Seed of the data.
+  * @retval None
+  */
+static void CheckMemory(const char* Name, uint32_t Sector, uint32_t SectorNb,
+                        uint8_t Seed)
+{
+  if (CheckData(HOST_SDMemory() + Sector * SD_BLOCK_SIZE, Sector, SectorNb, Seed) != 0)
+  {
+    printf("%s: wrong card content\n", Name);
+    ErrorNb++;
+  }
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
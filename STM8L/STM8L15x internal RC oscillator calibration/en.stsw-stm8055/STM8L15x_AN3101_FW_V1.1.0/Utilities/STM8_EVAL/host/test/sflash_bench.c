@@ -0,0 +1,391 @@
+/**
+  ******************************************************************************
+  * @file    sflash_bench.c
+  * @author  MCD Application Team
+  * @version V2.1.0
+  * @date    09/24/2010
+  * @brief   Host benchmark of the SPI FLASH driver, run on the M25P64 model.
+  *
+  *          @note Each workload runs on BENCH_SIZE bytes of the FLASH and is
+  *                reported with its bytes per simulated second, the time the
+  *                driver spends in its functions, and the FLASH operations
+  *                counted by the driver (sFLASH_USE_STATISTICS) and by the
+  *                model:
+  *                - erase:  sFLASH_EraseSector() of the sectors,
+  *                - write:  sFLASH_WriteBuffer() of BENCH_RECORD_SIZE byte
+  *                          records, as a data logger does,
+  *                - read:   sFLASH_ReadBuffer() of BENCH_READ_SIZE bytes,
+  *                - stream: sFLASH_StreamGetChunk() up to the end,
+  *                - queue:  sFLASH_QueueEraseSector() of the sectors, then
+  *                          sFLASH_QueueWriteBuffer() of BENCH_QUEUE_SIZE
+  *                          bytes, sFLASH_QueueTick() being called every
+  *                          BENCH_TICK ns.
+  *                The data read is compared with the data written, the FLASH
+  *                content with the expected one after each write, and the
+  *                model must not have ignored any instruction.
+  *
+  *          @note The simulated time only counts the SPI transfers and the
+  *                FLASH cycles, not the CPU time of the driver: the SPI
+  *                clock is fSYSCLK / 4 for the instructions and fSYSCLK / 2
+  *                for the stream, fSYSCLK being 16 MHz.
+  ******************************************************************************
+  * @copy
+  *
+  * THE PRESENT FIRMWARE WHICH IS FOR GUIDANCE ONLY AIMS AT PROVIDING CUSTOMERS
+  * WITH CODING INFORMATION REGARDING THEIR PRODUCTS IN ORDER FOR THEM TO SAVE
+  * TIME. AS A RESULT, STMICROELECTRONICS SHALL NOT BE HELD LIABLE FOR ANY
+  * DIRECT, INDIRECT OR CONSEQUENTIAL DAMAGES WITH RESPECT TO ANY CLAIMS ARISING
+  * FROM THE CONTENT OF SUCH FIRMWARE AND/OR THE USE MADE BY CUSTOMERS OF THE
+  * CODING INFORMATION CONTAINED HEREIN IN CONNECTION WITH THEIR PRODUCTS.
+  *
+  * <h2><center>&copy; COPYRIGHT 2010 STMicroelectronics</center></h2>
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "host.h"
+#include "stm8_eval_spi_flash.h"
+
+/* Private typedef -----------------------------------------------------------*/
+/**
+  * @brief  Counters of a workload
+  */
+typedef struct
+{
+  HOST_Time_TypeDef Time;            /*!< Simulated time at the start */
+  HOST_Time_TypeDef DriverTime;      /*!< Time spent in the driver */
+  sFLASH_Statistics_TypeDef Driver;  /*!< Driver counters at the start */
+  HOST_M25PStatistics_TypeDef Model; /*!< Model counters at the start */
+}Bench_TypeDef;
+
+/* Private define ------------------------------------------------------------*/
+#define BENCH_IMAGE        "build/sflash.img"
+#define BENCH_ADDRESS      ((uint32_t)0x100000)
+#define BENCH_SIZE         ((uint32_t)0x40000)   /* 4 sectors */
+#define BENCH_RECORD_SIZE  ((uint16_t)48)
+#define BENCH_READ_SIZE    ((uint16_t)512)
+#define BENCH_QUEUE_SIZE   ((uint16_t)0x1000)
+#define BENCH_TICK         ((HOST_Time_TypeDef)100000) /* 100 us */
+
+/* Private macro -------------------------------------------------------------*/
+/* Runs a driver function, its time being counted as driver time */
+#define BENCH_DRIVER(Bench, Call)                                  \
+  do                                                               \
+  {                                                                \
+    HOST_Time_TypeDef start = HOST_GetTime();                      \
+    Call;                                                          \
+    (Bench)->DriverTime += HOST_GetTime() - start;                 \
+  } while (0)
+
+/* Private variables ---------------------------------------------------------*/
+static uint8_t Expected[BENCH_SIZE];
+static uint8_t Buffer[BENCH_READ_SIZE];
+static uint32_t ErrorNb = 0;
+static uint32_t QueueDoneNb = 0;
+static uint32_t QueueLatency = 0;
+
+/* Private function prototypes -----------------------------------------------*/
+static void BenchStart(Bench_TypeDef* Bench);
+static void BenchEnd(Bench_TypeDef* Bench, const char* Name, uint32_t ByteNb);
+static void BenchErase(void);
+static void BenchWrite(void);
+static void BenchRead(void);
+static void BenchStream(void);
+static void BenchQueue(void);
+static void CheckMemory(const char* Name);
+static void QueueCallback(uint16_t Latency);
+
+/* Private functions ---------------------------------------------------------*/
+
+/**
+  * @brief  Benchmark entry point.
+  * @param  argc: Number of arguments.
+  * @param  argv: Image file, build/sflash.img by default.
+  * @retval 0 when the data and the FLASH instructions are right, 1 otherwise
+  */
+int main(int argc, char** argv)
+{
+  uint32_t index = 0;
+
+  if (HOST_M25PInit((argc > 1) ? argv[1] : BENCH_IMAGE, 0) != SUCCESS)
+  {
+    return 1;
+  }
+  HOST_SPIAttach(sFLASH_SPI, sFLASH_CS_GPIO_PORT, sFLASH_CS_PIN, &HOST_M25P);
+
+  sFLASH_Init();
+  if (sFLASH_ReadID() != HOST_M25P_ID)
+  {
+    printf("sFLASH_ReadID: 0x%06lX\n", (unsigned long)sFLASH_ReadID());
+    ErrorNb++;
+  }
+
+  /* Data of the write workloads */
+  for (index = 0; index < BENCH_SIZE; index++)
+  {
+    Expected[index] = (uint8_t)((index * 7) ^ (index >> 8));
+  }
+
+  printf("sflash_bench: %lu bytes at 0x%06lX, SPI %lu kHz, stream %lu kHz\n",
+         (unsigned long)BENCH_SIZE, (unsigned long)BENCH_ADDRESS,
+         (unsigned long)(8000000ULL / HOST_SPIByteTime(sFLASH_SPI)),
+         (unsigned long)(8000000ULL / (HOST_SPIByteTime(sFLASH_SPI) / 2)));
+  printf("%-8s %12s %10s %10s %6s %8s %6s %7s\n", "", "bytes/s", "time ms",
+         "driver ms", "reads", "programs", "erases", "polls");
+
+  BenchErase();
+  BenchWrite();
+  BenchRead();
+  BenchStream();
+  BenchQueue();
+
+  sFLASH_DeInit();
+  HOST_M25PDeInit();
+
+  printf("sflash_bench: %lu errors\n", (unsigned long)ErrorNb);
+
+  return (ErrorNb == 0) ? 0 : 1;
+}
+
+/**
+  * @brief  Starts a workload.
+  * @param  Bench: pointer to the counters of the workload.
+  * @retval None
+  */
+static void BenchStart(Bench_TypeDef* Bench)
+{
+  Bench->Time = HOST_GetTime();
+  Bench->DriverTime = 0;
+  sFLASH_GetStatistics(&Bench->Driver);
+  HOST_M25PGetStatistics(&Bench->Model);
+}
+
+/**
+  * @brief  Ends a workload and prints its counters.
+  * @param  Bench: pointer to the counters of the workload.
+  * @param  Name: Workload name.
+  * @param  ByteNb: Bytes of the workload.
+  * @retval None
+  */
+static void BenchEnd(Bench_TypeDef* Bench, const char* Name, uint32_t ByteNb)
+{
+  HOST_Time_TypeDef time = HOST_GetTime() - Bench->Time;
+  sFLASH_Statistics_TypeDef driver;
+  HOST_M25PStatistics_TypeDef model;
+
+  sFLASH_GetStatistics(&driver);
+  HOST_M25PGetStatistics(&model);
+
+  printf("%-8s %12.0f %10.3f %10.3f %6lu %8lu %6lu %7lu\n", Name,
+         (double)ByteNb * 1e9 / (double)time, (double)time / 1e6,
+         (double)Bench->DriverTime / 1e6,
+         (unsigned long)(driver.ReadNb - Bench->Driver.ReadNb),
+         (unsigned long)(driver.ProgramNb - Bench->Driver.ProgramNb),
+         (unsigned long)(driver.EraseNb - Bench->Driver.EraseNb),
+         (unsigned long)(driver.BusyNb - Bench->Driver.BusyNb));
+
+  if (model.ErrorNb != Bench->Model.ErrorNb)
+  {
+    printf("%s: %lu FLASH instructions ignored\n", Name,
+           (unsigned long)(model.ErrorNb - Bench->Model.ErrorNb));
+    ErrorNb++;
+  }
+  if ((model.ProgramNb - Bench->Model.ProgramNb) != (driver.ProgramNb - Bench->Driver.ProgramNb))
+  {
+    printf("%s: %lu Page WRITE cycles, the driver counted %lu\n", Name,
+           (unsigned long)(model.ProgramNb - Bench->Model.ProgramNb),
+           (unsigned long)(driver.ProgramNb - Bench->Driver.ProgramNb));
+    ErrorNb++;
+  }
+}
+
+/**
+  * @brief  Erases the sectors of the workloads one by one.
+  * @param  None
+  * @retval None
+  */
+static void BenchErase(void)
+{
+  Bench_TypeDef bench;
+  uint32_t addr = 0;
+
+  BenchStart(&bench);
+  for (addr = 0; addr < BENCH_SIZE; addr += HOST_M25P_SECTOR_SIZE)
+  {
+    BENCH_DRIVER(&bench, sFLASH_EraseSector(BENCH_ADDRESS + addr));
+  }
+  BenchEnd(&bench, "erase", BENCH_SIZE);
+
+  for (addr = 0; addr < BENCH_SIZE; addr++)
+  {
+    if (HOST_M25PMemory()[BENCH_ADDRESS + addr] != 0xFF)
+    {
+      printf("erase: 0x%06lX not erased\n", (unsigned long)(BENCH_ADDRESS + addr));
+      ErrorNb++;
+      break;
+    }
+  }
+}
+
+/**
+  * @brief  Writes the data in records, as a data logger does.
+  * @param  None
+  * @retval None
+  */
+static void BenchWrite(void)
+{
+  Bench_TypeDef bench;
+  uint32_t addr = 0;
+  uint16_t count = 0;
+
+  BenchStart(&bench);
+  for (addr = 0; addr < BENCH_SIZE; addr += count)
+  {
+    count = (uint16_t)(((BENCH_SIZE - addr) < BENCH_RECORD_SIZE) ?
+                       (BENCH_SIZE - addr) : BENCH_RECORD_SIZE);
+    BENCH_DRIVER(&bench, sFLASH_WriteBuffer(&Expected[addr], BENCH_ADDRESS + addr, count));
+  }
+#ifdef sFLASH_USE_PAGE_CACHE
+  BENCH_DRIVER(&bench, sFLASH_CacheFlush());
+#endif /* sFLASH_USE_PAGE_CACHE */
+  BENCH_DRIVER(&bench, sFLASH_WaitForWriteEnd());
+  BenchEnd(&bench, "write", BENCH_SIZE);
+
+  CheckMemory("write");
+}
+
+/**
+  * @brief  Reads the data in blocks.
+  * @param  None
+  * @retval None
+  */
+static void BenchRead(void)
+{
+  Bench_TypeDef bench;
+  uint32_t addr = 0;
+
+  BenchStart(&bench);
+  for (addr = 0; addr < BENCH_SIZE; addr += BENCH_READ_SIZE)
+  {
+    BENCH_DRIVER(&bench, sFLASH_ReadBuffer(Buffer, BENCH_ADDRESS + addr, BENCH_READ_SIZE));
+    if (memcmp(Buffer, &Expected[addr], BENCH_READ_SIZE) != 0)
+    {
+      printf("read: wrong data at 0x%06lX\n", (unsigned long)(BENCH_ADDRESS + addr));
+      ErrorNb++;
+    }
+  }
+  BenchEnd(&bench, "read", BENCH_SIZE);
+}
+
+/**
+  * @brief  Reads the data with the stream functions.
+  * @param  None
+  * @retval None
+  */
+static void BenchStream(void)
+{
+  Bench_TypeDef bench;
+  uint32_t addr = 0;
+  uint8_t* chunk = 0;
+
+  BenchStart(&bench);
+  BENCH_DRIVER(&bench, sFLASH_StreamStart(BENCH_ADDRESS));
+  for (addr = 0; addr < BENCH_SIZE; addr += sFLASH_STREAM_CHUNK_SIZE)
+  {
+    BENCH_DRIVER(&bench, chunk = sFLASH_StreamGetChunk());
+    if (memcmp(chunk, &Expected[addr], sFLASH_STREAM_CHUNK_SIZE) != 0)
+    {
+      printf("stream: wrong data at 0x%06lX\n", (unsigned long)(BENCH_ADDRESS + addr));
+      ErrorNb++;
+    }
+  }
+  BENCH_DRIVER(&bench, sFLASH_StreamStop());
+  BenchEnd(&bench, "stream", BENCH_SIZE);
+}
+
+/**
+  * @brief  Erases the sectors and writes the data inverted through the queue,
+  *         the queue being kept full.
+  * @param  None
+  * @retval None
+  */
+static void BenchQueue(void)
+{
+  Bench_TypeDef bench;
+  uint32_t addr = 0, index = 0;
+  ErrorStatus status = ERROR;
+
+  for (index = 0; index < BENCH_SIZE; index++)
+  {
+    Expected[index] = (uint8_t)~Expected[index];
+  }
+
+  QueueDoneNb = 0;
+  QueueLatency = 0;
+
+  BenchStart(&bench);
+  for (addr = 0; addr < BENCH_SIZE; addr += HOST_M25P_SECTOR_SIZE)
+  {
+    do
+    {
+      BENCH_DRIVER(&bench, status = sFLASH_QueueEraseSector(BENCH_ADDRESS + addr, QueueCallback));
+      if (status != SUCCESS)
+      {
+        HOST_Wait(BENCH_TICK);
+        BENCH_DRIVER(&bench, sFLASH_QueueTick());
+      }
+    } while (status != SUCCESS);
+  }
+  for (addr = 0; addr < BENCH_SIZE; addr += BENCH_QUEUE_SIZE)
+  {
+    do
+    {
+      BENCH_DRIVER(&bench, status = sFLASH_QueueWriteBuffer(&Expected[addr], BENCH_ADDRESS + addr,
+                                                            BENCH_QUEUE_SIZE, QueueCallback));
+      if (status != SUCCESS)
+      {
+        HOST_Wait(BENCH_TICK);
+        BENCH_DRIVER(&bench, sFLASH_QueueTick());
+      }
+    } while (status != SUCCESS);
+  }
+  while (sFLASH_QueueGetPending() != 0)
+  {
+    HOST_Wait(BENCH_TICK);
+    BENCH_DRIVER(&bench, sFLASH_QueueTick());
+  }
+  BenchEnd(&bench, "queue", BENCH_SIZE);
+
+  printf("queue: %lu operations, %lu ticks of latency on average\n",
+         (unsigned long)QueueDoneNb,
+         (unsigned long)((QueueDoneNb != 0) ? (QueueLatency / QueueDoneNb) : 0));
+  CheckMemory("queue");
+}
+
+/**
+  * @brief  Compares the FLASH content with the expected data.
+  * @param  Name: Workload name.
+  * @retval None
+  */
+static void CheckMemory(const char* Name)
+{
+  if (memcmp(HOST_M25PMemory() + BENCH_ADDRESS, Expected, BENCH_SIZE) != 0)
+  {
+    printf("%s: wrong FLASH content\n", Name);
+    ErrorNb++;
+  }
+}
+
+/**
+  * @brief  End of a queued operation.
+  * @param  Latency: sFLASH_QueueTick() periods since its queuing.
+  * @retval None
+  */
+static void QueueCallback(uint16_t Latency)
+{
+  QueueDoneNb++;
+  QueueLatency += Latency;
+}
+
+/******************* (C) COPYRIGHT 2010 STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Generates GlyphMap[] of the 1526 and 1528 glass LCD drivers.
+
+GlyphMap[] holds the LCD digits of the printable ascii characters, ' ' (0x20)
+to '~' (0x7E), two 4-bit digits per byte, the first one in the high nibble.
+
+- The upper case letters and the numbers are the LetterMap[] and NumberMap[]
+  codings of the reference file (ref/stm8l152x_eval_glass_char.c), split into
+  digits as the former Convert() did.
+- The space is blank.
+- The other characters are drawn below with the segment names of the 14
+  segment characters, placed in the digits by the mapping of each glass.
+
+Usage:
+  glyph_map.py 1526|1528 REFERENCE           print the GlyphMap[] definition
+  glyph_map.py 1526|1528 REFERENCE --check DRIVER
+                                             compare it with the one of DRIVER
+"""
+
+import re
+import sys
+
+# Segment names: a top, b upper right, c lower right, d bottom, e lower left,
+# f upper left, g1 middle left, g2 middle right, h upper left diagonal,
+# i upper vertical, j upper right diagonal, k lower left diagonal,
+# l lower vertical, m lower right diagonal, dp point, col colon.
+GLYPHS = {
+    '!': 'i', '"': 'f i', '#': 'b c d g1 g2 i l', '$': 'a f g1 g2 c d i l',
+    '%': 'f c j k g1 g2', '&': 'a d e h i m g1', "'": 'i', '(': 'j m',
+    ')': 'h k', '*': 'g1 g2 h i j k l m', '+': 'g1 g2 i l', ',': 'k',
+    '-': 'g1 g2', '.': 'dp', '/': 'j k', ':': 'col', ';': 'i k', '<': 'j m',
+    '=': 'g1 g2 d', '>': 'h k', '?': 'a b g2 l', '@': 'a b d e f i g2',
+    '[': 'a d e f', '\\': 'h m', ']': 'a b c d', '^': 'k m', '_': 'd',
+    '`': 'h', '{': 'a d g1 i l', '|': 'i l', '}': 'a d g2 i l', '~': 'g1 j',
+    'a': 'd e g1 l', 'b': 'f e d c g1 g2', 'c': 'e d g1 g2',
+    'd': 'b c d e g1 g2', 'e': 'e d g1 k', 'f': 'a i l g1 g2',
+    'g': 'a b c d f g1 g2', 'h': 'f e c g1 g2', 'i': 'l', 'j': 'c d',
+    'k': 'i l j m', 'l': 'i l', 'm': 'e c g1 g2 l', 'n': 'e c g1 g2',
+    'o': 'e d c g1 g2', 'p': 'a b f e g1 g2', 'q': 'a b f c g1 g2',
+    'r': 'e g1', 's': 'g2 m d', 't': 'f e d g1', 'u': 'e d c', 'v': 'e k',
+    'w': 'e c k m', 'x': 'h j k m', 'y': 'b c d f g1 g2', 'z': 'g1 k d',
+}
+
+# Glass mappings: segment name -> (digit, bit), as described in the drivers.
+BOARDS = {
+    # Digit n is column n of { X F E D / I J K N / A B C DP / H G L M }, bit
+    # b its row b (the driver segment letters differ from the names above).
+    '1526': {
+        'digits': 4,
+        'segments': {
+            'a': (0, 4), 'h': (0, 8), 'i': (0, 2),
+            'f': (1, 1), 'j': (1, 2), 'b': (1, 4), 'g1': (1, 8),
+            'e': (2, 1), 'g2': (2, 2), 'c': (2, 4), 'k': (2, 8),
+            'd': (3, 1), 'm': (3, 2), 'dp': (3, 4), 'l': (3, 8),
+        },
+        'colon': 'i l',
+    },
+    # Digits are COM0 COM1 COM4 COM5 COM6 COM7, bit b SEG(n + log2(b)) of
+    # SEG(n) { 0 0 I B C J }, SEG(n+1) { D K A H M N }, SEG(n+2) { Q L G F P E }
+    '1528': {
+        'digits': 6,
+        'segments': {
+            'd': (0, 2), 'dp': (0, 4), 'l': (1, 2), 'k': (1, 4),
+            'j': (2, 1), 'a': (2, 2), 'h': (2, 4),
+            'b': (3, 1), 'i': (3, 2), 'f': (3, 4),
+            'c': (4, 1), 'g1': (4, 2), 'col': (4, 4),
+            'm': (5, 1), 'g2': (5, 2), 'e': (5, 4),
+        },
+        'colon': 'col dp',
+    },
+}
+
+HEADER = """/* Glyph map of the printable ascii characters, from ' ' (0x20) to '~' (0x7E):
+   LCD digits of the character, two digits per byte, the first one in the high
+   nibble. Letters in upper case and numbers keep the coding of the former
+   letter and number maps. */
+__CONST uint8_t GlyphMap[95][%d] =
+"""
+
+
+def reference_map(source, name):
+    match = re.search(name + r"\[\d+\]\s*=\s*\{(.*?)\};", source, re.S)
+    body = re.sub(r"/\*.*?\*/", "", match.group(1))
+    return [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", body)]
+
+
+def word_digits(word, number):
+    return [(word >> (4 * (number - 1 - k))) & 0xF for k in range(number)]
+
+
+def glyph_digits(board, names):
+    digits = [0] * board['digits']
+    names = names.replace('col', board['colon'])
+    for name in names.split():
+        digit, bit = board['segments'][name]
+        digits[digit] |= bit
+    return digits
+
+
+def literal(char):
+    return "'\\%s'" % char if char in "\\'" else "'%s'" % char
+
+
+def generate(board_name, reference):
+    board = BOARDS[board_name]
+    source = open(reference, encoding="latin-1").read()
+    letters = reference_map(source, "LetterMap")
+    numbers = reference_map(source, "NumberMap")
+    glyphs = []
+    for code in range(0x20, 0x7F):
+        char = chr(code)
+        if 'A' <= char <= 'Z':
+            digits = word_digits(letters[code - 0x41], board['digits'])
+        elif '0' <= char <= '9':
+            digits = word_digits(numbers[code - 0x30], board['digits'])
+        elif char == ' ':
+            digits = [0] * board['digits']
+        else:
+            digits = glyph_digits(board, GLYPHS[char])
+        glyphs.append((char, ["0x%02X" % ((digits[k] << 4) | digits[k + 1])
+                              for k in range(0, board['digits'], 2)]))
+    text = HEADER % (board['digits'] // 2) + "  {\n"
+    for first in range(0, len(glyphs), 4):
+        group = glyphs[first:first + 4]
+        text += "    /* %s */\n" % "   ".join(
+            literal(char).ljust(4) for char, _ in group).rstrip()
+        text += "    %s" % ", ".join(
+            "{" + ", ".join(values) + "}" for _, values in group)
+        text += ",\n" if first + 4 < len(glyphs) else "\n"
+    return text + "  };\n"
+
+
+def main():
+    if (len(sys.argv) not in (3, 5) or sys.argv[1] not in BOARDS
+            or (len(sys.argv) == 5 and sys.argv[3] != "--check")):
+        sys.exit(__doc__)
+    table = generate(sys.argv[1], sys.argv[2])
+    if len(sys.argv) == 3:
+        sys.stdout.write(table)
+        return
+    driver = open(sys.argv[4], encoding="latin-1").read()
+    if table not in driver:
+        sys.exit("%s: GlyphMap[] differs from the generated one" % sys.argv[4])
+    print("%s: GlyphMap[] matches the generated one" % sys.argv[4])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Generates MatrixPixelMap[] of the 1528 glass LCD driver.
+
+The location of each pixel of the 10x19 matrix is read from the switch based
+LCD_GLASS_WriteMatrixPixel() and LCD_GLASS_ClearMatrixPixel() of the reference
+file (ref/stm8l1528_eval_glass_matrix.c): LCD RAM bank, register and bit. Both
+functions must agree on every pixel.
+
+Usage:
+  matrix_pixel_map.py REFERENCE              print the MatrixPixelMap[] definition
+  matrix_pixel_map.py REFERENCE --check DRIVER
+                                             compare it with the one of DRIVER
+"""
+
+import re
+import sys
+
+ROW_NB = 10
+COLUMN_NB = 19
+GLASS_PAGE2 = 0x80
+
+HEADER = ("/* Location of the pixels of the 10x19 matrix, indexed by "
+          "[row - 1][column - 1] */\n"
+          "__CONST GLASS_Segment_TypeDef MatrixPixelMap[10][19] =\n")
+
+
+def function_body(source, name):
+    start = source.index("void " + name + "(")
+    return source[start:source.index("\n}\n", start)]
+
+
+def parse(source, name):
+    """Returns {(row, column): (page, register, mask)} of a reference function."""
+    pixels = {}
+    row = column = page = None
+    for line in function_body(source, name).split("\n"):
+        match = re.search(r"case\s+PIXELROW_(\d+)\s*:", line)
+        if match:
+            row = int(match.group(1))
+            continue
+        match = re.search(r"case\s+PIXELCOLUMN_(\d+)\s*:", line)
+        if match:
+            column = int(match.group(1))
+            page = None
+            continue
+        if "LCD_CR4_PAGECOM" in line:
+            page = 0 if "&=" in line else 1
+            continue
+        match = re.search(r"LCD->RAM\[LCD_RAMRegister_(\d+)\]\s*(\|=|&=)\s*"
+                          r"\(uint8_t\)\s*(~?)\s*\(?\s*(0x[0-9A-Fa-f]+)", line)
+        if match:
+            if page is None or (row, column) in pixels:
+                sys.exit("%s: unexpected access for row %d column %d"
+                         % (name, row, column))
+            mask = int(match.group(4), 16)
+            if match.group(2) == "&=" and match.group(3) == "":
+                mask = ~mask & 0xFF
+            pixels[(row, column)] = (page, int(match.group(1)), mask)
+        elif "LCD->RAM" in line:
+            sys.exit("%s: unparsed line: %s" % (name, line.strip()))
+    return pixels
+
+
+def generate(reference):
+    source = open(reference, encoding="latin-1").read()
+    write = parse(source, "LCD_GLASS_WriteMatrixPixel")
+    clear = parse(source, "LCD_GLASS_ClearMatrixPixel")
+    text = HEADER + "  {\n"
+    for row in range(1, ROW_NB + 1):
+        entries = []
+        for column in range(1, COLUMN_NB + 1):
+            if write.get((row, column)) is None:
+                sys.exit("no pixel at row %d column %d" % (row, column))
+            if write[(row, column)] != clear.get((row, column)):
+                sys.exit("set and clear differ at row %d column %d"
+                         % (row, column))
+            page, register, mask = write[(row, column)]
+            entries.append("{0x%02X, 0x%02X}"
+                           % (register | (GLASS_PAGE2 if page else 0), mask))
+        lines = ["      " + ", ".join(entries[i:i + 5])
+                 for i in range(0, COLUMN_NB, 5)]
+        text += "    /* Row %d: columns 1 to 19 */\n" % row
+        text += "    {\n" + ",\n".join(lines) + "\n    }"
+        text += ",\n" if row < ROW_NB else "\n"
+    return text + "  };\n"
+
+
+def main():
+    if len(sys.argv) not in (2, 4) or (len(sys.argv) == 4
+                                       and sys.argv[2] != "--check"):
+        sys.exit(__doc__)
+    table = generate(sys.argv[1])
+    if len(sys.argv) == 2:
+        sys.stdout.write(table)
+        return
+    driver = open(sys.argv[3], encoding="latin-1").read()
+    if table not in driver:
+        sys.exit("%s: MatrixPixelMap[] differs from the generated one"
+                 % sys.argv[3])
+    print("%s: MatrixPixelMap[] matches the generated one" % sys.argv[3])
+
+
+if __name__ == "__main__":
+    main()